@@ -0,0 +1,147 @@
+/**
+ * cursor_predictor.c - 커서 위치 예측 구현
+ */
+
+#include "cursor_predictor.h"
+#include <math.h>
+#include <string.h>
+
+// 예측 강도를 곱한 속도가 이보다 느리면 멈춘 것으로 봄 (픽셀/밀리초)
+#define REST_SPEED 0.02
+
+/**
+ * 초기화
+ */
+void CursorPredictor_Reset(CursorPredictor* predictor, double smoothingMs, double gain)
+{
+    memset(predictor, 0, sizeof(CursorPredictor));
+    predictor->smoothingMs = smoothingMs > 0.0 ? smoothingMs : 0.0;
+    predictor->gain = gain < 0.0 ? 0.0 : (gain > 1.0 ? 1.0 : gain);
+}
+
+/**
+ * 오차 하나 누적
+ */
+static void AddError(CursorPredictionStats* s, double error, double lag)
+{
+    s->checks++;
+    s->meanErrorPx += (error - s->meanErrorPx) / (double)s->checks;
+    s->meanLagPx += (lag - s->meanLagPx) / (double)s->checks;
+    if (error > s->maxErrorPx) s->maxErrorPx = error;
+    if (lag > s->maxLagPx) s->maxLagPx = lag;
+}
+
+/**
+ * 직전 샘플과 새 샘플 사이를 겨냥한 예측 채점 (그 사이 커서는 직선으로 움직였다고 봄)
+ */
+static void GradePending(CursorPredictor* predictor, double nowMs, double x, double y)
+{
+    double span = nowMs - predictor->lastMs;
+    int kept = 0;
+
+    for (int i = 0; i < predictor->pendingCount; i++) {
+        const CursorPrediction* p = &predictor->pending[i];
+        if (p->timeMs > nowMs) {
+            predictor->pending[kept++] = *p;
+            continue;
+        }
+
+        double t = span > 0.0 ? (p->timeMs - predictor->lastMs) / span : 1.0;
+        if (t < 0.0) t = 0.0;
+        double actualX = predictor->lastX + (x - predictor->lastX) * t;
+        double actualY = predictor->lastY + (y - predictor->lastY) * t;
+
+        AddError(&predictor->stats,
+                 hypot(p->x - actualX, p->y - actualY),
+                 hypot(p->lastX - actualX, p->lastY - actualY));
+    }
+
+    predictor->pendingCount = kept;
+}
+
+/**
+ * 커서 샘플 추가
+ */
+void CursorPredictor_AddSample(CursorPredictor* predictor, double nowMs, double x, double y)
+{
+    if (!predictor->hasSample) {
+        predictor->hasSample = true;
+        predictor->lastMs = nowMs;
+        predictor->lastX = x;
+        predictor->lastY = y;
+        return;
+    }
+
+    double dt = nowMs - predictor->lastMs;
+    if (dt <= 0.0) {
+        predictor->lastX = x;
+        predictor->lastY = y;
+        return;
+    }
+
+    GradePending(predictor, nowMs, x, y);
+
+    if (dt > CURSOR_PREDICT_GAP_MS) {
+        // 오래 멈췄다 움직이면 예전 속도는 의미 없음
+        predictor->velocityX = 0.0;
+        predictor->velocityY = 0.0;
+    } else {
+        // 샘플 간격이 고르지 않아도 같은 시간 상수가 되도록 간격에 맞춘 평활 계수
+        double alpha = predictor->smoothingMs > 0.0 ? 1.0 - exp(-dt / predictor->smoothingMs) : 1.0;
+        predictor->velocityX += alpha * ((x - predictor->lastX) / dt - predictor->velocityX);
+        predictor->velocityY += alpha * ((y - predictor->lastY) / dt - predictor->velocityY);
+    }
+
+    predictor->lastMs = nowMs;
+    predictor->lastX = x;
+    predictor->lastY = y;
+}
+
+/**
+ * 위치 예측
+ */
+bool CursorPredictor_Predict(CursorPredictor* predictor, double targetMs, double* x, double* y)
+{
+    if (!predictor->hasSample) {
+        return false;
+    }
+
+    double ahead = targetMs - predictor->lastMs;
+    if (ahead < 0.0) ahead = 0.0;
+    if (ahead > CURSOR_PREDICT_MAX_MS) ahead = CURSOR_PREDICT_MAX_MS;
+
+    *x = predictor->lastX + predictor->velocityX * ahead * predictor->gain;
+    *y = predictor->lastY + predictor->velocityY * ahead * predictor->gain;
+
+    // 채점 대기열 (가득 차면 가장 오래된 것을 버림)
+    if (predictor->pendingCount == CURSOR_PREDICT_PENDING) {
+        memmove(&predictor->pending[0], &predictor->pending[1],
+                sizeof(CursorPrediction) * (CURSOR_PREDICT_PENDING - 1));
+        predictor->pendingCount--;
+    }
+
+    CursorPrediction* p = &predictor->pending[predictor->pendingCount++];
+    p->timeMs = targetMs;
+    p->x = *x;
+    p->y = *y;
+    p->lastX = predictor->lastX;
+    p->lastY = predictor->lastY;
+    return true;
+}
+
+/**
+ * 예측이 마지막 샘플에서 벗어나 있는지
+ */
+bool CursorPredictor_IsMoving(const CursorPredictor* predictor)
+{
+    double speed = hypot(predictor->velocityX, predictor->velocityY) * predictor->gain;
+    return speed > REST_SPEED;
+}
+
+/**
+ * 오차 통계 가져오기
+ */
+void CursorPredictor_GetStats(const CursorPredictor* predictor, CursorPredictionStats* stats)
+{
+    *stats = predictor->stats;
+}
@@ -0,0 +1,82 @@
+/**
+ * cursor_predictor.h - 커서 위치 예측 (확대 지연 줄이기)
+ *
+ * 확대 프레임은 커서를 읽은 뒤 확대/표시까지 한두 주기가 걸려 빠르게 움직이는 커서를 늘 뒤따른다.
+ * 시각이 붙은 커서 샘플로 속도를 지수 평활해 표시될 시각의 위치를 외삽한다.
+ * 새 샘플이 들어오면 그 시각을 겨냥했던 예측과 실제 위치를 비교해 오차를 잰다. (플랫폼 독립)
+ */
+
+#ifndef LETSZOOM_CURSOR_PREDICTOR_H
+#define LETSZOOM_CURSOR_PREDICTOR_H
+
+#include <stdbool.h>
+
+// 이보다 먼 미래는 예측하지 않음 (밀리초)
+#define CURSOR_PREDICT_MAX_MS 50.0
+
+// 샘플 간격이 이보다 길면 멈췄다 다시 움직인 것으로 보고 속도를 버림 (밀리초)
+#define CURSOR_PREDICT_GAP_MS 100.0
+
+// 채점을 기다리는 예측 수
+#define CURSOR_PREDICT_PENDING 8
+
+// 예측 오차 (표시 시각의 실제 커서 위치 기준, 픽셀)
+typedef struct {
+    unsigned long long checks;      // 채점한 예측 수
+    double meanErrorPx;             // 예측 위치 오차 평균
+    double maxErrorPx;              // 예측 위치 오차 최대
+    double meanLagPx;               // 예측 없이 마지막 샘플을 쓸 때의 오차 평균 (비교용)
+    double maxLagPx;
+} CursorPredictionStats;
+
+// 채점을 기다리는 예측 하나
+typedef struct {
+    double timeMs;                  // 예측이 겨냥한 시각
+    double x, y;                    // 예측 위치
+    double lastX, lastY;            // 예측할 때의 마지막 샘플 (예측 없을 때 쓰였을 위치)
+} CursorPrediction;
+
+typedef struct {
+    // 설정
+    double smoothingMs;             // 속도 평활 시간 상수 (클수록 떨림이 적고 방향 전환에 느림)
+    double gain;                    // 예측 강도 (0 = 끔, 1 = 속도 그대로 외삽)
+
+    // 상태
+    bool hasSample;
+    double lastMs;
+    double lastX, lastY;
+    double velocityX, velocityY;    // 평활한 속도 (픽셀/밀리초)
+
+    CursorPrediction pending[CURSOR_PREDICT_PENDING];
+    int pendingCount;
+    CursorPredictionStats stats;
+} CursorPredictor;
+
+/**
+ * 초기화 (smoothingMs: 속도 평활 시간 상수, gain: 0-1 예측 강도)
+ */
+void CursorPredictor_Reset(CursorPredictor* predictor, double smoothingMs, double gain);
+
+/**
+ * 커서 샘플 추가 (nowMs: 샘플 시각, 단조 증가)
+ * 이 시각까지 겨냥한 예측을 채점한다.
+ */
+void CursorPredictor_AddSample(CursorPredictor* predictor, double nowMs, double x, double y);
+
+/**
+ * targetMs 시각의 커서 위치 예측 (샘플이 없으면 false)
+ * 예측은 채점 대기열에 들어가고, 예측을 끄면 마지막 샘플을 돌려준다.
+ */
+bool CursorPredictor_Predict(CursorPredictor* predictor, double targetMs, double* x, double* y);
+
+/**
+ * 예측이 아직 마지막 샘플에서 벗어나 있는지 (멈춘 뒤 제자리로 돌아올 프레임이 더 필요한지)
+ */
+bool CursorPredictor_IsMoving(const CursorPredictor* predictor);
+
+/**
+ * 오차 통계 가져오기
+ */
+void CursorPredictor_GetStats(const CursorPredictor* predictor, CursorPredictionStats* stats);
+
+#endif // LETSZOOM_CURSOR_PREDICTOR_H
@@ -0,0 +1,88 @@
+/**
+ * dib_buffer.c - 32비트 DIB 섹션 버퍼 구현
+ */
+
+#include "dib_buffer.h"
+#include <string.h>
+
+// 살아 있는 버퍼 (여러 스레드에서 만들고 해제)
+static volatile LONG g_liveCount = 0;
+static volatile LONG64 g_liveBytes = 0;
+
+/**
+ * DIB 버퍼 생성
+ */
+bool DibBuffer_Create(DibBuffer* buffer, int width, int height)
+{
+    if (!buffer || width <= 0 || height <= 0) {
+        return false;
+    }
+
+    memset(buffer, 0, sizeof(DibBuffer));
+
+    buffer->hdc = CreateCompatibleDC(NULL);
+    if (!buffer->hdc) {
+        OutputDebugStringW(L"[DibBuffer] Failed to create memory DC\n");
+        return false;
+    }
+
+    BITMAPINFO bmi = {0};
+    bmi.bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
+    bmi.bmiHeader.biWidth = width;
+    bmi.bmiHeader.biHeight = -height;  // top-down
+    bmi.bmiHeader.biPlanes = 1;
+    bmi.bmiHeader.biBitCount = 32;
+    bmi.bmiHeader.biCompression = BI_RGB;
+
+    void* bits = NULL;
+    buffer->hbm = CreateDIBSection(buffer->hdc, &bmi, DIB_RGB_COLORS, &bits, NULL, 0);
+    if (!buffer->hbm || !bits) {
+        OutputDebugStringW(L"[DibBuffer] Failed to create DIB section\n");
+        DibBuffer_Destroy(buffer);
+        return false;
+    }
+
+    buffer->hbmOld = (HBITMAP)SelectObject(buffer->hdc, buffer->hbm);
+    PixelBuffer_Wrap(&buffer->pixels, bits, width, height, width * 4);
+
+    InterlockedIncrement(&g_liveCount);
+    InterlockedExchangeAdd64(&g_liveBytes, (LONG64)height * width * 4);
+    return true;
+}
+
+/**
+ * DIB 버퍼 해제
+ */
+void DibBuffer_Destroy(DibBuffer* buffer)
+{
+    if (!buffer) return;
+
+    if (buffer->hbmOld) {
+        SelectObject(buffer->hdc, buffer->hbmOld);
+    }
+
+    if (buffer->hbm) {
+        DeleteObject(buffer->hbm);
+    }
+
+    // 생성에 성공한 버퍼만 집계됨
+    if (buffer->pixels.pixels) {
+        InterlockedDecrement(&g_liveCount);
+        InterlockedExchangeAdd64(&g_liveBytes, -(LONG64)buffer->pixels.height * buffer->pixels.stride);
+    }
+
+    if (buffer->hdc) {
+        DeleteDC(buffer->hdc);
+    }
+
+    memset(buffer, 0, sizeof(DibBuffer));
+}
+
+/**
+ * 살아 있는 DIB 버퍼 사용량
+ */
+void DibBuffer_GetUsage(int* count, size_t* bytes)
+{
+    if (count) *count = (int)InterlockedCompareExchange(&g_liveCount, 0, 0);
+    if (bytes) *bytes = (size_t)InterlockedCompareExchange64(&g_liveBytes, 0, 0);
+}
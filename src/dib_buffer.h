@@ -0,0 +1,38 @@
+/**
+ * dib_buffer.h - 32비트 DIB 섹션 버퍼 (GDI와 PixelBuffer 공유)
+ *
+ * 캡처, 확대 백 버퍼, 그리기 레이어처럼 GDI와 CPU가 함께 쓰는 버퍼는 모두 여기서 만든다.
+ * GDI로 그린 뒤 pixels로 바로 읽고 쓸 수 있어 GetDIBits/SetDIBits 복사가 필요 없다.
+ */
+
+#ifndef LETSZOOM_DIB_BUFFER_H
+#define LETSZOOM_DIB_BUFFER_H
+
+#include <windows.h>
+#include <stdbool.h>
+#include "pixel_buffer.h"
+
+// 메모리 DC에 선택된 top-down DIB 섹션
+typedef struct {
+    HDC hdc;
+    HBITMAP hbm;
+    HBITMAP hbmOld;
+    PixelBuffer pixels;     // DIB 픽셀 (GDI 그리기 후에는 GdiFlush 필요)
+} DibBuffer;
+
+/**
+ * DIB 버퍼 생성
+ */
+bool DibBuffer_Create(DibBuffer* buffer, int width, int height);
+
+/**
+ * DIB 버퍼 해제 (빈 버퍼에도 안전)
+ */
+void DibBuffer_Destroy(DibBuffer* buffer);
+
+/**
+ * 살아 있는 DIB 버퍼 수와 픽셀 메모리 (바이트, 누수/유휴 해제 확인용)
+ */
+void DibBuffer_GetUsage(int* count, size_t* bytes);
+
+#endif // LETSZOOM_DIB_BUFFER_H
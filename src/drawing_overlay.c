@@ -3,6 +3,8 @@
  */
 
 #include "drawing_overlay.h"
+#include "dib_buffer.h"
+#include "residency.h"
 #include <gdiplus.h>
 #include <stdio.h>
 
@@ -42,7 +44,7 @@ static int g_penWidth = 3;
 static int g_penOpacity = 255;
 
 // 스트로크 배열
-static Stroke* g_strokes = NULL;
+static Stroke** g_strokes = NULL;
 static int g_strokeCount = 0;
 static int g_strokeCapacity = 0;
 
@@ -54,10 +56,11 @@ static bool g_bDrawing = false;
 static int g_screenWidth = 0;
 static int g_screenHeight = 0;
 
-// 렌더링용 메모리 DC
-static HDC g_hdcMem = NULL;
-static HBITMAP g_hbmMem = NULL;
-static HBITMAP g_hbmOld = NULL;
+// 렌더링용 레이어 (DIB 섹션, 픽셀 직접 접근 가능)
+static DibBuffer g_layer = {0};
+
+// 닫은 뒤 창과 메모리 DC를 남겨 두는 상주 관리
+static ResidencyClient g_residency = {0};
 
 /**
  * 스트로크 생성
@@ -163,16 +166,11 @@ static bool CreateRenderResources(void)
     g_screenWidth = GetSystemMetrics(SM_CXSCREEN);
     g_screenHeight = GetSystemMetrics(SM_CYSCREEN);
 
-    // 메모리 DC 생성
-    HDC hdcScreen = GetDC(NULL);
-    g_hdcMem = CreateCompatibleDC(hdcScreen);
-    g_hbmMem = CreateCompatibleBitmap(hdcScreen, g_screenWidth, g_screenHeight);
-    g_hbmOld = (HBITMAP)SelectObject(g_hdcMem, g_hbmMem);
-    ReleaseDC(NULL, hdcScreen);
-
-    // 초기 배경 (투명)
-    RECT rect = {0, 0, g_screenWidth, g_screenHeight};
-    FillRect(g_hdcMem, &rect, (HBRUSH)GetStockObject(BLACK_BRUSH));
+    // 레이어 DIB 생성 (0으로 초기화되어 처음부터 투명)
+    if (!DibBuffer_Create(&g_layer, g_screenWidth, g_screenHeight)) {
+        OutputDebugStringW(L"[DrawingOverlay] Failed to create layer buffer\n");
+        return false;
+    }
 
     return true;
 }
@@ -182,20 +180,7 @@ static bool CreateRenderResources(void)
  */
 static void DestroyRenderResources(void)
 {
-    if (g_hbmOld) {
-        SelectObject(g_hdcMem, g_hbmOld);
-        g_hbmOld = NULL;
-    }
-
-    if (g_hbmMem) {
-        DeleteObject(g_hbmMem);
-        g_hbmMem = NULL;
-    }
-
-    if (g_hdcMem) {
-        DeleteDC(g_hdcMem);
-        g_hdcMem = NULL;
-    }
+    DibBuffer_Destroy(&g_layer);
 }
 
 /**
@@ -239,9 +224,9 @@ static void RenderStroke(HDC hdc, const Stroke* stroke)
  */
 static void RenderAllStrokes(HDC hdc)
 {
-    // 배경 지우기 (투명)
-    RECT rect = {0, 0, g_screenWidth, g_screenHeight};
-    FillRect(hdc, &rect, (HBRUSH)GetStockObject(BLACK_BRUSH));
+    // 배경 지우기 (투명, 이전 GDI 그리기가 끝난 뒤 픽셀을 직접 채움)
+    GdiFlush();
+    PixelBuffer_Fill(&g_layer.pixels, 0);
 
     // 모든 스트로크 렌더링
     for (int i = 0; i < g_strokeCount; i++) {
@@ -262,6 +247,36 @@ static void RenderAllStrokes(HDC hdc)
     DrawTextW(hdc, hintText, -1, &hintRect, DT_CENTER | DT_VCENTER | DT_SINGLELINE);
 }
 
+/**
+ * 스트로크를 그려 레이어드 윈도우 갱신
+ */
+static void UpdateLayer(HDC hdc)
+{
+    // 메모리 DC에 렌더링
+    RenderAllStrokes(g_layer.hdc);
+
+    // 레이어드 윈도우 업데이트
+    POINT ptSrc = {0, 0};
+    SIZE sizeWnd = {g_screenWidth, g_screenHeight};
+    BLENDFUNCTION blend = {AC_SRC_OVER, 0, 255, 0};
+
+    UpdateLayeredWindow(g_hwndDraw, hdc, NULL, &sizeWnd, g_layer.hdc, &ptSrc, 0, &blend, ULW_ALPHA);
+}
+
+/**
+ * 남겨 둔 창과 메모리 DC 해제 (유휴 시간이 지났거나 종료할 때)
+ */
+static void ReleaseResidentResources(void)
+{
+    if (g_hwndDraw) {
+        DestroyWindow(g_hwndDraw);
+        g_hwndDraw = NULL;
+    }
+
+    DestroyRenderResources();
+    OutputDebugStringW(L"[DrawingOverlay] Resident resources released\n");
+}
+
 /**
  * 그리기 윈도우 프로시저
  */
@@ -275,18 +290,11 @@ static LRESULT CALLBACK DrawWndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM l
         case WM_PAINT: {
             PAINTSTRUCT ps;
             HDC hdc = BeginPaint(hwnd, &ps);
-
-            // 메모리 DC에 렌더링
-            RenderAllStrokes(g_hdcMem);
-
-            // 레이어드 윈도우 업데이트
-            POINT ptSrc = {0, 0};
-            SIZE sizeWnd = {g_screenWidth, g_screenHeight};
-            BLENDFUNCTION blend = {AC_SRC_OVER, 0, 255, 0};
-
-            UpdateLayeredWindow(hwnd, hdc, NULL, &sizeWnd, g_hdcMem, &ptSrc, 0, &blend, ULW_ALPHA);
-
+            UpdateLayer(hdc);
             EndPaint(hwnd, &ps);
+
+            // 단축키 → 첫 프레임 지연 (활성화 후 처음 한 번만 기록)
+            Residency_FrameShown(&g_residency);
             return 0;
         }
 
@@ -411,6 +419,9 @@ bool DrawingOverlay_Initialize(HINSTANCE hInstance)
         return false;
     }
 
+    g_residency.name = L"drawing";
+    g_residency.release = ReleaseResidentResources;
+
     OutputDebugStringW(L"[DrawingOverlay] Initialized\n");
     return true;
 }
@@ -426,6 +437,9 @@ void DrawingOverlay_Shutdown(void)
 
     ClearAllStrokes();
 
+    // 남겨 둔 창/메모리 DC 해제 (클래스 등록 해제 전에 창부터)
+    Residency_ReleaseNow(&g_residency);
+
     if (g_hInstance) {
         UnregisterClassW(DRAW_CLASS_NAME, g_hInstance);
         GdiplusShutdown(g_gdiplusToken);
@@ -450,8 +464,29 @@ bool DrawingOverlay_Show(COLORREF penColor, int penWidth, int penOpacity)
     g_penWidth = penWidth;
     g_penOpacity = penOpacity;
 
+    // 남겨 둔 창은 화면 크기가 그대로일 때만 재사용
+    if (g_hwndDraw && (GetSystemMetrics(SM_CXSCREEN) != g_screenWidth ||
+                       GetSystemMetrics(SM_CYSCREEN) != g_screenHeight)) {
+        Residency_ReleaseNow(&g_residency);
+    }
+    Residency_Activate(&g_residency, g_hwndDraw != NULL);
+
+    if (g_hwndDraw) {
+        // 지난 세션의 스트로크가 비치지 않도록 빈 레이어로 갱신한 뒤 표시
+        UpdateLayer(NULL);
+        ShowWindow(g_hwndDraw, SW_SHOW);
+        SetForegroundWindow(g_hwndDraw);
+        Residency_FrameShown(&g_residency);
+
+        g_bActive = true;
+
+        OutputDebugStringW(L"[DrawingOverlay] Drawing overlay shown (resident window)\n");
+        return true;
+    }
+
     // 렌더링 리소스 생성
     if (!CreateRenderResources()) {
+        DestroyRenderResources();
         return false;
     }
 
@@ -504,15 +539,14 @@ void DrawingOverlay_Hide(void)
 
     OutputDebugStringW(L"[DrawingOverlay] Hiding drawing overlay\n");
 
-    // 윈도우 파괴
+    // 윈도우는 숨기기만 (다음 활성화에 재사용, 유휴 시간이 지나면 상주 관리가 해제)
+    if (g_bDrawing) {
+        ReleaseCapture();
+    }
     if (g_hwndDraw) {
-        DestroyWindow(g_hwndDraw);
-        g_hwndDraw = NULL;
+        ShowWindow(g_hwndDraw, SW_HIDE);
     }
 
-    // 렌더링 리소스 해제
-    DestroyRenderResources();
-
     // 스트로크 지우기
     ClearAllStrokes();
 
@@ -520,6 +554,9 @@ void DrawingOverlay_Hide(void)
     g_bDrawing = false;
     g_currentStroke = NULL;
 
+    // 유지 시간 뒤 창/메모리 DC 해제 예약 (유지 시간이 0이면 바로 해제)
+    Residency_Deactivate(&g_residency);
+
     OutputDebugStringW(L"[DrawingOverlay] Drawing overlay hidden\n");
 }
 
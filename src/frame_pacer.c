@@ -0,0 +1,195 @@
+/**
+ * frame_pacer.c - 디스플레이 주기에 맞춘 프레임 신호 구현
+ */
+
+#include "frame_pacer.h"
+#include "monitor.h"
+#include <stdlib.h>
+
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+
+// 주사율을 알 수 없을 때
+#define DEFAULT_REFRESH_HZ 60
+
+struct FramePacer {
+    HWND hwnd;
+    UINT message;
+    HANDLE timer;
+    HANDLE stopEvent;
+    HANDLE wakeEvent;           // 쉬는 중에 신호 요청
+    HANDLE thread;
+    double periodMs;
+    volatile LONG pending;      // 보낸 신호를 창이 아직 처리하지 않음
+    volatile LONG continuous;   // 매 주기 신호
+    volatile LONG requested;    // 다음 주기에 한 번 신호
+};
+
+/**
+ * 현재 시각
+ */
+double FramePacer_Now(void)
+{
+    static LARGE_INTEGER frequency = {0};
+    if (frequency.QuadPart == 0) {
+        QueryPerformanceFrequency(&frequency);
+    }
+
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart * 1000.0 / (double)frequency.QuadPart;
+}
+
+/**
+ * 페이서 스레드
+ * 다음 마감 시각을 주기만큼 더해 가며 계산하므로 오차가 쌓이지 않는다.
+ * 연속 모드도 요청도 없으면 깨울 때까지 잠든다 (CPU 사용 없음).
+ */
+static DWORD WINAPI PacerThread(LPVOID param)
+{
+    FramePacer* pacer = (FramePacer*)param;
+    HANDLE timerHandles[2] = {pacer->stopEvent, pacer->timer};
+    HANDLE wakeHandles[2] = {pacer->stopEvent, pacer->wakeEvent};
+    double deadline = FramePacer_Now() + pacer->periodMs;
+
+    for (;;) {
+        if (!pacer->continuous && !pacer->requested) {
+            if (WaitForMultipleObjects(2, wakeHandles, FALSE, INFINITE) != WAIT_OBJECT_0 + 1) {
+                break;
+            }
+
+            // 쉬고 난 뒤에는 한 주기 뒤가 아니라 바로 다음 주기 경계에 맞춤
+            double now = FramePacer_Now();
+            if (deadline < now) {
+                deadline += pacer->periodMs * (double)(long long)((now - deadline) / pacer->periodMs + 1.0);
+            }
+            continue;
+        }
+
+        double remaining = deadline - FramePacer_Now();
+        if (remaining < 0.0) remaining = 0.0;
+
+        // 상대 시간 (100ns 단위, 음수)
+        LARGE_INTEGER due;
+        due.QuadPart = -(LONGLONG)(remaining * 10000.0);
+        SetWaitableTimer(pacer->timer, &due, 0, NULL, NULL, FALSE);
+
+        if (WaitForMultipleObjects(2, timerHandles, FALSE, INFINITE) != WAIT_OBJECT_0 + 1) {
+            break;
+        }
+
+        bool signal = InterlockedExchange(&pacer->requested, 0) != 0 || pacer->continuous;
+        if (signal && InterlockedExchange(&pacer->pending, 1) == 0) {
+            PostMessageW(pacer->hwnd, pacer->message, 0, 0);
+        }
+
+        // 밀렸으면 건너뛴 주기는 버리고 다음 주기에 맞춤
+        deadline += pacer->periodMs;
+        double now = FramePacer_Now();
+        if (deadline < now) {
+            deadline = now + pacer->periodMs;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * 페이서 생성
+ */
+FramePacer* FramePacer_Create(HWND hwnd, UINT message)
+{
+    FramePacer* pacer = (FramePacer*)calloc(1, sizeof(FramePacer));
+    if (!pacer) return NULL;
+
+    pacer->hwnd = hwnd;
+    pacer->message = message;
+    // 창이 있는 모니터의 주사율
+    MonitorInfo monitor;
+    int refreshRate = Monitor_FromWindow(hwnd, &monitor) ? monitor.refreshRate : DEFAULT_REFRESH_HZ;
+    pacer->periodMs = 1000.0 / refreshRate;
+
+    // 고해상도 타이머 (Windows 10 1803+), 없으면 일반 타이머
+    pacer->timer = CreateWaitableTimerExW(NULL, NULL, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+    if (!pacer->timer) {
+        pacer->timer = CreateWaitableTimerExW(NULL, NULL, 0, TIMER_ALL_ACCESS);
+    }
+    pacer->stopEvent = CreateEventW(NULL, TRUE, FALSE, NULL);
+    pacer->wakeEvent = CreateEventW(NULL, FALSE, FALSE, NULL);
+
+    if (pacer->timer && pacer->stopEvent && pacer->wakeEvent) {
+        pacer->thread = CreateThread(NULL, 0, PacerThread, pacer, 0, NULL);
+    }
+
+    if (!pacer->thread) {
+        OutputDebugStringW(L"[FramePacer] Failed to start pacer\n");
+        FramePacer_Destroy(pacer);
+        return NULL;
+    }
+
+    SetThreadPriority(pacer->thread, THREAD_PRIORITY_ABOVE_NORMAL);
+    return pacer;
+}
+
+/**
+ * 페이서 파괴
+ */
+void FramePacer_Destroy(FramePacer* pacer)
+{
+    if (!pacer) return;
+
+    if (pacer->thread) {
+        SetEvent(pacer->stopEvent);
+        WaitForSingleObject(pacer->thread, INFINITE);
+        CloseHandle(pacer->thread);
+    }
+
+    if (pacer->timer) CloseHandle(pacer->timer);
+    if (pacer->stopEvent) CloseHandle(pacer->stopEvent);
+    if (pacer->wakeEvent) CloseHandle(pacer->wakeEvent);
+    free(pacer);
+}
+
+/**
+ * 연속 모드 설정
+ */
+void FramePacer_SetContinuous(FramePacer* pacer, bool continuous)
+{
+    if (!pacer) return;
+
+    LONG previous = InterlockedExchange(&pacer->continuous, continuous ? 1 : 0);
+    if (continuous && !previous) {
+        SetEvent(pacer->wakeEvent);
+    }
+}
+
+/**
+ * 다음 주기에 한 번 신호 요청
+ */
+void FramePacer_RequestFrame(FramePacer* pacer)
+{
+    if (!pacer) return;
+
+    if (InterlockedExchange(&pacer->requested, 1) == 0) {
+        SetEvent(pacer->wakeEvent);
+    }
+}
+
+/**
+ * 프레임 처리 완료
+ */
+void FramePacer_FrameDone(FramePacer* pacer)
+{
+    if (pacer) {
+        InterlockedExchange(&pacer->pending, 0);
+    }
+}
+
+/**
+ * 프레임 주기
+ */
+double FramePacer_GetPeriodMs(const FramePacer* pacer)
+{
+    return pacer ? pacer->periodMs : 1000.0 / DEFAULT_REFRESH_HZ;
+}
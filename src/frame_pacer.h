@@ -0,0 +1,53 @@
+/**
+ * frame_pacer.h - 디스플레이 주기에 맞춘 프레임 신호
+ *
+ * 고해상도 대기 타이머로 디스플레이 주기마다 창에 메시지를 보낸다.
+ * SetTimer(16ms)보다 간격이 고르고 창이 있는 모니터의 주사율(120/144Hz 등)을 따른다.
+ * 연속 모드가 아니면 요청이 있을 때만 다음 주기 경계에 한 번 보낸다.
+ */
+
+#ifndef LETSZOOM_FRAME_PACER_H
+#define LETSZOOM_FRAME_PACER_H
+
+#include <windows.h>
+#include <stdbool.h>
+
+typedef struct FramePacer FramePacer;
+
+/**
+ * 페이서 생성 (hwnd에 message를 PostMessage, 처음에는 요청이 있을 때만)
+ * 창이 메시지를 처리하고 FramePacer_FrameDone을 부르기 전까지는 다음 메시지를 보내지 않는다.
+ */
+FramePacer* FramePacer_Create(HWND hwnd, UINT message);
+
+/**
+ * 페이서 파괴 (스레드 종료 대기)
+ */
+void FramePacer_Destroy(FramePacer* pacer);
+
+/**
+ * 연속 모드 설정 (true면 매 주기 신호, false면 요청이 있을 때만)
+ */
+void FramePacer_SetContinuous(FramePacer* pacer, bool continuous);
+
+/**
+ * 다음 주기에 한 번 신호 요청 (입력 등으로 다시 그려야 할 때)
+ */
+void FramePacer_RequestFrame(FramePacer* pacer);
+
+/**
+ * 프레임 처리 완료 (다음 신호 허용)
+ */
+void FramePacer_FrameDone(FramePacer* pacer);
+
+/**
+ * 프레임 주기 (밀리초)
+ */
+double FramePacer_GetPeriodMs(const FramePacer* pacer);
+
+/**
+ * 현재 시각 (밀리초, QueryPerformanceCounter)
+ */
+double FramePacer_Now(void);
+
+#endif // LETSZOOM_FRAME_PACER_H
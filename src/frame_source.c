@@ -0,0 +1,72 @@
+/**
+ * frame_source.c - 화면 프레임 공급원 공통 함수
+ */
+
+#include "frame_source.h"
+#include <string.h>
+
+/**
+ * 프레임 획득
+ */
+bool FrameSource_Acquire(FrameSource* source, const FrameRect* region, Frame* frame)
+{
+    if (!source || !frame) {
+        return false;
+    }
+
+    // 요청 영역을 데스크톱 크기로 자르기
+    FrameRect desktop = {0, 0, source->width, source->height};
+    FrameRect clipped = desktop;
+    if (region && !FrameRect_Intersect(&clipped, region, &desktop)) {
+        return false;
+    }
+
+    memset(frame, 0, sizeof(Frame));
+    return source->ops->acquire(source, &clipped, frame);
+}
+
+/**
+ * 공급원 파괴
+ */
+void FrameSource_Destroy(FrameSource* source)
+{
+    if (source) {
+        source->ops->destroy(source);
+    }
+}
+
+/**
+ * 공급원 이름
+ */
+const char* FrameSource_GetName(const FrameSource* source)
+{
+    return source ? source->ops->name : "none";
+}
+
+/**
+ * 두 사각형이 겹치는지 확인
+ */
+bool FrameRect_Intersects(const FrameRect* a, const FrameRect* b)
+{
+    return a->left < b->right && b->left < a->right &&
+           a->top < b->bottom && b->top < a->bottom;
+}
+
+/**
+ * 사각형 교집합
+ */
+bool FrameRect_Intersect(FrameRect* out, const FrameRect* a, const FrameRect* b)
+{
+    FrameRect r;
+    r.left = a->left > b->left ? a->left : b->left;
+    r.top = a->top > b->top ? a->top : b->top;
+    r.right = a->right < b->right ? a->right : b->right;
+    r.bottom = a->bottom < b->bottom ? a->bottom : b->bottom;
+
+    if (r.left >= r.right || r.top >= r.bottom) {
+        return false;
+    }
+
+    *out = r;
+    return true;
+}
@@ -0,0 +1,151 @@
+/**
+ * frame_source.h - 화면 프레임 공급원 추상화
+ *
+ * 프레임과 함께 이전 프레임 이후 바뀐 영역(dirty)과 이동한 영역(move)을 알려
+ * 하위 단계가 바뀐 부분만 다시 처리할 수 있게 한다.
+ * 인터페이스와 합성/파일 공급원은 플랫폼 독립 (Linux에서도 빌드 가능)
+ */
+
+#ifndef LETSZOOM_FRAME_SOURCE_H
+#define LETSZOOM_FRAME_SOURCE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "pixel_buffer.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+// 사각형 (데스크톱 좌표, right/bottom 제외)
+typedef struct {
+    int left;
+    int top;
+    int right;
+    int bottom;
+} FrameRect;
+
+// 이동 영역 (srcX, srcY에서 dst로 복사된 내용)
+typedef struct {
+    FrameRect dst;
+    int srcX;
+    int srcY;
+} FrameMove;
+
+// 획득한 프레임 (다음 FrameSource_Acquire 전까지 유효)
+typedef struct {
+    PixelBuffer pixels;             // 요청 영역의 픽셀
+    FrameRect bounds;               // pixels (0,0)의 데스크톱 좌표와 크기
+    const FrameRect* dirtyRects;    // 이전 획득 이후 바뀐 영역
+    int dirtyCount;
+    const FrameMove* moveRects;     // 이전 획득 이후 이동한 영역
+    int moveCount;
+    bool fullRefresh;               // 변경 정보 없음 (전체가 바뀐 것으로 취급)
+    uint64_t frameNumber;           // 공급원이 새 내용을 낸 횟수
+    uint64_t bytesCopied;           // 이번 획득에서 복사한 바이트 (통계용)
+} Frame;
+
+typedef struct FrameSource FrameSource;
+
+// 공급원 구현 함수 테이블
+typedef struct {
+    const char* name;
+    bool (*acquire)(FrameSource* source, const FrameRect* region, Frame* frame);
+    void (*destroy)(FrameSource* source);
+} FrameSourceOps;
+
+// 공급원 공통 헤더 (구현 구조체의 첫 멤버)
+struct FrameSource {
+    const FrameSourceOps* ops;
+    int width;      // 데스크톱 크기
+    int height;
+};
+
+/**
+ * 프레임 획득
+ * region: 필요한 영역 (데스크톱 크기로 잘림), NULL이면 전체
+ */
+bool FrameSource_Acquire(FrameSource* source, const FrameRect* region, Frame* frame);
+
+/**
+ * 공급원 파괴
+ */
+void FrameSource_Destroy(FrameSource* source);
+
+/**
+ * 공급원 이름 (로그용)
+ */
+const char* FrameSource_GetName(const FrameSource* source);
+
+/**
+ * 두 사각형이 겹치는지 확인
+ */
+bool FrameRect_Intersects(const FrameRect* a, const FrameRect* b);
+
+/**
+ * 사각형 교집합 (겹치지 않으면 false)
+ */
+bool FrameRect_Intersect(FrameRect* out, const FrameRect* a, const FrameRect* b);
+
+/**
+ * 합성 공급원 생성 (격자 배경 위로 상자가 움직이는 테스트 화면)
+ */
+FrameSource* FrameSource_CreateSynthetic(int width, int height);
+
+/**
+ * 녹화 파일 공급원 생성 (끝에 도달하면 처음부터 반복)
+ */
+FrameSource* FrameSource_CreateFile(const char* path);
+
+/**
+ * 정지 화면 공급원 생성
+ * live에서 데스크톱 전체를 한 번 복사한다. 이후 live는 필요 없다.
+ */
+FrameSource* FrameSource_CreateSnapshot(FrameSource* live);
+
+/**
+ * 이미 있는 픽셀로 정지 화면 공급원 생성 (복사 없이 감쌈)
+ * pixels의 메모리는 공급원을 파괴할 때까지 살아 있어야 한다.
+ */
+FrameSource* FrameSource_CreateStill(const PixelBuffer* pixels);
+
+/**
+ * 녹화 파일 작성기
+ * 파일 형식: 헤더 뒤에 프레임마다 dirty 사각형 목록과 그 픽셀을 기록한다.
+ */
+typedef struct FrameRecorder FrameRecorder;
+
+FrameRecorder* FrameRecorder_Create(const char* path, int width, int height);
+bool FrameRecorder_Write(FrameRecorder* recorder, const Frame* frame);
+void FrameRecorder_Close(FrameRecorder* recorder);
+
+#ifdef _WIN32
+/**
+ * GDI 공급원 (BitBlt, 변경 정보 없음 - ZoomPipeline_EnableContentHash로 바뀐 타일을 찾음)
+ * area: 캡처할 가상 데스크톱 영역 (보통 한 모니터, NULL이면 주 모니터).
+ * 공급원 좌표 (0,0)이 area의 왼쪽 위.
+ */
+FrameSource* FrameSource_CreateGdi(const FrameRect* area);
+
+/**
+ * Desktop Duplication 공급원 (DXGI)
+ * area와 같은 영역의 출력(모니터)을 복제 (NULL이면 주 모니터, 없으면 NULL)
+ */
+FrameSource* FrameSource_CreateDuplication(const FrameRect* area);
+
+/**
+ * 창 공급원 (PrintWindow, 변경 정보 없음)
+ * 창 하나의 내용만 복사하므로 위에 겹친 다른 창이나 알림은 찍히지 않는다.
+ * 공급원 좌표 (0,0)이 창의 보이는 영역 왼쪽 위, 크기는 만들 때의 창 크기.
+ * 창이 움직여도 좌표는 그대로이고, 크기가 바뀌거나 최소화되면 획득이 실패한다 (다시 만들어야 함).
+ */
+FrameSource* FrameSource_CreateWindow(HWND hwnd);
+
+/**
+ * 창의 보이는 영역 (가상 데스크톱 좌표, 보이지 않는 크기 조절 테두리 제외)
+ * 창이 없거나 최소화되어 있으면 false
+ */
+bool FrameSource_GetWindowBounds(HWND hwnd, FrameRect* bounds);
+#endif
+
+#endif // LETSZOOM_FRAME_SOURCE_H
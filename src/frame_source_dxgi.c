@@ -0,0 +1,330 @@
+/**
+ * frame_source_dxgi.c - Desktop Duplication 화면 공급원 (DXGI)
+ *
+ * 한 모니터(출력)의 데스크톱 이미지를 GPU에서 받아 바뀐 영역(dirty/move)만
+ * CPU 사본에 복사한다. 화면이 바뀌지 않은 프레임은 복사 없이 넘어간다.
+ */
+
+#define COBJMACROS
+#include "frame_source.h"
+#include <d3d11.h>
+#include <dxgi1_2.h>
+#include <stdlib.h>
+#include <string.h>
+
+// 한 번에 받을 변경 사각형 최대 개수 (넘으면 전체 복사)
+#define MAX_CHANGE_RECTS 256
+
+typedef struct {
+    FrameSource base;
+    ID3D11Device* device;
+    ID3D11DeviceContext* context;
+    IDXGIOutput1* output;
+    IDXGIOutputDuplication* duplication;
+    ID3D11Texture2D* staging;           // CPU에서 읽을 사본
+    PixelBuffer desktop;                // 데스크톱 전체 CPU 사본
+    bool needFullCopy;                  // 다음 프레임은 전체 복사 (처음/재생성 후)
+
+    FrameRect dirty[MAX_CHANGE_RECTS];
+    FrameMove moves[MAX_CHANGE_RECTS];
+    RECT metaDirty[MAX_CHANGE_RECTS];
+    DXGI_OUTDUPL_MOVE_RECT metaMoves[MAX_CHANGE_RECTS];
+    uint64_t frameNumber;
+} DuplicationSource;
+
+/**
+ * 출력 복제 (재)생성
+ */
+static bool StartDuplication(DuplicationSource* dup)
+{
+    if (dup->duplication) {
+        IDXGIOutputDuplication_Release(dup->duplication);
+        dup->duplication = NULL;
+    }
+
+    HRESULT hr = IDXGIOutput1_DuplicateOutput(dup->output, (IUnknown*)dup->device, &dup->duplication);
+    if (FAILED(hr)) {
+        OutputDebugStringW(L"[FrameSource] DuplicateOutput failed\n");
+        return false;
+    }
+
+    dup->needFullCopy = true;
+    return true;
+}
+
+/**
+ * 스테이징 텍스처 확보 (데스크톱 텍스처와 같은 크기/형식)
+ */
+static bool EnsureStaging(DuplicationSource* dup, ID3D11Texture2D* texture)
+{
+    if (dup->staging) {
+        return true;
+    }
+
+    D3D11_TEXTURE2D_DESC desc;
+    ID3D11Texture2D_GetDesc(texture, &desc);
+    desc.Usage = D3D11_USAGE_STAGING;
+    desc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
+    desc.BindFlags = 0;
+    desc.MiscFlags = 0;
+    desc.MipLevels = 1;
+    desc.ArraySize = 1;
+
+    HRESULT hr = ID3D11Device_CreateTexture2D(dup->device, &desc, NULL, &dup->staging);
+    return SUCCEEDED(hr);
+}
+
+/**
+ * 스테이징 텍스처에서 사각형 영역을 CPU 사본으로 복사
+ */
+static uint64_t CopyRect(DuplicationSource* dup, const D3D11_MAPPED_SUBRESOURCE* mapped, const FrameRect* rect)
+{
+    int width = rect->right - rect->left;
+    for (int y = rect->top; y < rect->bottom; y++) {
+        const uint8_t* src = (const uint8_t*)mapped->pData + (size_t)y * mapped->RowPitch + (size_t)rect->left * 4;
+        memcpy(PixelBuffer_Row(&dup->desktop, y) + rect->left, src, (size_t)width * 4);
+    }
+    return (uint64_t)width * (rect->bottom - rect->top) * 4;
+}
+
+/**
+ * 이번 프레임의 변경 정보 읽기 (실패하거나 너무 많으면 false)
+ */
+static bool ReadFrameMetadata(DuplicationSource* dup, Frame* frame)
+{
+    FrameRect desktop = {0, 0, dup->base.width, dup->base.height};
+    UINT size = 0;
+
+    HRESULT hr = IDXGIOutputDuplication_GetFrameMoveRects(dup->duplication, sizeof(dup->metaMoves),
+                                                          dup->metaMoves, &size);
+    if (FAILED(hr)) return false;
+
+    int moveCount = 0;
+    for (UINT i = 0; i < size / sizeof(DXGI_OUTDUPL_MOVE_RECT); i++) {
+        const DXGI_OUTDUPL_MOVE_RECT* m = &dup->metaMoves[i];
+        FrameRect dst = {m->DestinationRect.left, m->DestinationRect.top,
+                         m->DestinationRect.right, m->DestinationRect.bottom};
+        if (FrameRect_Intersect(&dup->moves[moveCount].dst, &dst, &desktop)) {
+            dup->moves[moveCount].srcX = m->SourcePoint.x;
+            dup->moves[moveCount].srcY = m->SourcePoint.y;
+            moveCount++;
+        }
+    }
+
+    hr = IDXGIOutputDuplication_GetFrameDirtyRects(dup->duplication, sizeof(dup->metaDirty),
+                                                   dup->metaDirty, &size);
+    if (FAILED(hr)) return false;
+
+    int dirtyCount = 0;
+    for (UINT i = 0; i < size / sizeof(RECT); i++) {
+        const RECT* r = &dup->metaDirty[i];
+        FrameRect rect = {r->left, r->top, r->right, r->bottom};
+        if (FrameRect_Intersect(&dup->dirty[dirtyCount], &rect, &desktop)) {
+            dirtyCount++;
+        }
+    }
+
+    frame->dirtyRects = dup->dirty;
+    frame->dirtyCount = dirtyCount;
+    frame->moveRects = dup->moves;
+    frame->moveCount = moveCount;
+    return true;
+}
+
+static bool DuplicationAcquire(FrameSource* source, const FrameRect* region, Frame* frame)
+{
+    DuplicationSource* dup = (DuplicationSource*)source;
+
+    if (!dup->duplication && !StartDuplication(dup)) {
+        return false;
+    }
+
+    DXGI_OUTDUPL_FRAME_INFO info;
+    IDXGIResource* resource = NULL;
+    HRESULT hr = IDXGIOutputDuplication_AcquireNextFrame(dup->duplication, 0, &info, &resource);
+
+    if (hr == DXGI_ERROR_ACCESS_LOST) {
+        // 해상도 변경, 보안 데스크톱 전환 등: 다음 획득에서 다시 생성
+        OutputDebugStringW(L"[FrameSource] Duplication access lost\n");
+        IDXGIOutputDuplication_Release(dup->duplication);
+        dup->duplication = NULL;
+        return false;
+    }
+
+    bool newImage = false;
+    if (SUCCEEDED(hr)) {
+        // 커서만 움직인 프레임은 이미지가 그대로
+        newImage = info.LastPresentTime.QuadPart != 0 || dup->needFullCopy;
+
+        if (newImage) {
+            ID3D11Texture2D* texture = NULL;
+            hr = IDXGIResource_QueryInterface(resource, &IID_ID3D11Texture2D, (void**)&texture);
+            if (SUCCEEDED(hr) && EnsureStaging(dup, texture)) {
+                ID3D11DeviceContext_CopyResource(dup->context, (ID3D11Resource*)dup->staging,
+                                                 (ID3D11Resource*)texture);
+                if (dup->needFullCopy || !ReadFrameMetadata(dup, frame)) {
+                    frame->fullRefresh = true;
+                }
+            } else {
+                newImage = false;
+            }
+            if (texture) ID3D11Texture2D_Release(texture);
+        }
+
+        IDXGIResource_Release(resource);
+        IDXGIOutputDuplication_ReleaseFrame(dup->duplication);
+    } else if (hr != DXGI_ERROR_WAIT_TIMEOUT) {
+        return false;
+    }
+
+    if (newImage) {
+        D3D11_MAPPED_SUBRESOURCE mapped;
+        hr = ID3D11DeviceContext_Map(dup->context, (ID3D11Resource*)dup->staging, 0, D3D11_MAP_READ, 0, &mapped);
+        if (FAILED(hr)) {
+            return false;
+        }
+
+        // 바뀐 영역만 CPU 사본에 반영 (이동 영역은 결과 이미지에서 그대로 복사)
+        if (frame->fullRefresh) {
+            FrameRect all = {0, 0, dup->base.width, dup->base.height};
+            frame->bytesCopied = CopyRect(dup, &mapped, &all);
+        } else {
+            for (int i = 0; i < frame->moveCount; i++) {
+                frame->bytesCopied += CopyRect(dup, &mapped, &frame->moveRects[i].dst);
+            }
+            for (int i = 0; i < frame->dirtyCount; i++) {
+                frame->bytesCopied += CopyRect(dup, &mapped, &frame->dirtyRects[i]);
+            }
+        }
+
+        ID3D11DeviceContext_Unmap(dup->context, (ID3D11Resource*)dup->staging, 0);
+        dup->needFullCopy = false;
+        dup->frameNumber++;
+    }
+
+    // 새 이미지가 없으면 변경 없음 (dirty 0개)
+    frame->pixels = PixelBuffer_SubView(&dup->desktop, region->left, region->top,
+                                        region->right - region->left, region->bottom - region->top);
+    frame->bounds = *region;
+    frame->frameNumber = dup->frameNumber;
+    return true;
+}
+
+static void DuplicationDestroy(FrameSource* source)
+{
+    DuplicationSource* dup = (DuplicationSource*)source;
+
+    if (dup->staging) ID3D11Texture2D_Release(dup->staging);
+    if (dup->duplication) IDXGIOutputDuplication_Release(dup->duplication);
+    if (dup->output) IDXGIOutput1_Release(dup->output);
+    if (dup->context) ID3D11DeviceContext_Release(dup->context);
+    if (dup->device) ID3D11Device_Release(dup->device);
+
+    PixelBuffer_Free(&dup->desktop);
+    free(dup);
+}
+
+static const FrameSourceOps g_duplicationOps = {
+    "duplication",
+    DuplicationAcquire,
+    DuplicationDestroy
+};
+
+/**
+ * area와 같은 영역의 출력 찾기 (area가 NULL이면 첫 어댑터의 첫 출력 = 주 모니터)
+ * 출력이 연결된 어댑터도 함께 돌려준다 (복제 장치는 그 어댑터에 만들어야 함).
+ */
+static bool FindOutput(const FrameRect* area, IDXGIAdapter** foundAdapter, IDXGIOutput** foundOutput)
+{
+    IDXGIFactory1* factory = NULL;
+    if (FAILED(CreateDXGIFactory1(&IID_IDXGIFactory1, (void**)&factory))) {
+        OutputDebugStringW(L"[FrameSource] CreateDXGIFactory1 failed\n");
+        return false;
+    }
+
+    bool found = false;
+    IDXGIAdapter* adapter = NULL;
+    for (UINT a = 0; !found && IDXGIFactory1_EnumAdapters(factory, a, &adapter) != DXGI_ERROR_NOT_FOUND; a++) {
+        IDXGIOutput* output = NULL;
+        for (UINT o = 0; !found && IDXGIAdapter_EnumOutputs(adapter, o, &output) != DXGI_ERROR_NOT_FOUND; o++) {
+            DXGI_OUTPUT_DESC desc;
+            IDXGIOutput_GetDesc(output, &desc);
+            const RECT* r = &desc.DesktopCoordinates;
+            if (!area || (r->left == area->left && r->top == area->top &&
+                          r->right == area->right && r->bottom == area->bottom)) {
+                *foundAdapter = adapter;
+                *foundOutput = output;
+                found = true;
+            } else {
+                IDXGIOutput_Release(output);
+            }
+        }
+        if (!found) {
+            IDXGIAdapter_Release(adapter);
+        }
+    }
+
+    IDXGIFactory1_Release(factory);
+    return found;
+}
+
+/**
+ * 출력을 찾아 그 어댑터에 D3D 장치 생성
+ */
+static bool OpenOutput(DuplicationSource* dup, const FrameRect* area)
+{
+    IDXGIAdapter* adapter = NULL;
+    IDXGIOutput* output = NULL;
+    if (!FindOutput(area, &adapter, &output)) {
+        OutputDebugStringW(L"[FrameSource] No output for the requested monitor\n");
+        return false;
+    }
+
+    HRESULT hr = D3D11CreateDevice(adapter, D3D_DRIVER_TYPE_UNKNOWN, NULL, 0, NULL, 0,
+                                   D3D11_SDK_VERSION, &dup->device, NULL, &dup->context);
+    if (FAILED(hr)) {
+        OutputDebugStringW(L"[FrameSource] D3D11CreateDevice failed\n");
+    }
+    if (SUCCEEDED(hr)) {
+        hr = IDXGIOutput_QueryInterface(output, &IID_IDXGIOutput1, (void**)&dup->output);
+    }
+
+    bool ok = SUCCEEDED(hr);
+    if (ok) {
+        DXGI_OUTPUT_DESC desc;
+        IDXGIOutput_GetDesc(output, &desc);
+        dup->base.width = desc.DesktopCoordinates.right - desc.DesktopCoordinates.left;
+        dup->base.height = desc.DesktopCoordinates.bottom - desc.DesktopCoordinates.top;
+
+        // 회전된 화면은 GDI 공급원 사용
+        if (desc.Rotation != DXGI_MODE_ROTATION_IDENTITY && desc.Rotation != DXGI_MODE_ROTATION_UNSPECIFIED) {
+            OutputDebugStringW(L"[FrameSource] Rotated output not supported\n");
+            ok = false;
+        }
+    }
+
+    IDXGIOutput_Release(output);
+    IDXGIAdapter_Release(adapter);
+    return ok;
+}
+
+/**
+ * Desktop Duplication 공급원 생성 (Windows 8 이상, 실패하면 NULL)
+ */
+FrameSource* FrameSource_CreateDuplication(const FrameRect* area)
+{
+    DuplicationSource* dup = (DuplicationSource*)calloc(1, sizeof(DuplicationSource));
+    if (!dup) return NULL;
+
+    dup->base.ops = &g_duplicationOps;
+
+    if (!OpenOutput(dup, area) ||
+        !PixelBuffer_Alloc(&dup->desktop, dup->base.width, dup->base.height) ||
+        !StartDuplication(dup)) {
+        DuplicationDestroy(&dup->base);
+        return NULL;
+    }
+
+    OutputDebugStringW(L"[FrameSource] Desktop Duplication source created\n");
+    return &dup->base;
+}
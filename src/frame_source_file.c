@@ -0,0 +1,414 @@
+/**
+ * frame_source_file.c - 합성/녹화 파일 프레임 공급원
+ *
+ * 화면 없이 (Linux 포함) 확대 파이프라인을 구동하고 측정하기 위한 공급원.
+ * 두 공급원 모두 데스크톱 전체 크기의 버퍼를 유지하고 요청 영역의 뷰를 돌려준다.
+ */
+
+#include "frame_source.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// 녹화 파일 헤더
+#define FRAME_FILE_MAGIC "LZFR"
+#define FRAME_FILE_VERSION 1
+
+// 프레임 기록 하나의 최대 사각형 수 (읽을 때 이보다 많으면 손상된 파일)
+#define FRAME_FILE_MAX_RECTS 65536
+
+typedef struct {
+    char magic[4];
+    uint32_t version;
+    int32_t width;
+    int32_t height;
+} FrameFileHeader;
+
+// 합성 화면 상자 크기와 이동 속도
+#define SYNTH_BOX_SIZE 96
+#define SYNTH_BOX_SPEED 7
+
+typedef struct {
+    FrameSource base;
+    PixelBuffer desktop;
+    int boxX;
+    int boxY;
+    int dx;
+    int dy;
+    FrameRect dirty[2];
+    uint64_t frameNumber;
+} SyntheticSource;
+
+typedef struct {
+    FrameSource base;
+    FILE* file;
+    long dataStart;
+    PixelBuffer desktop;
+    FrameRect* dirty;
+    int dirtyCapacity;
+    uint64_t frameNumber;
+} FileSource;
+
+struct FrameRecorder {
+    FILE* file;
+    int width;
+    int height;
+    FrameRect* rects;
+    int rectCapacity;
+};
+
+/**
+ * 배경 무늬 (격자 + 그라데이션, 글자처럼 가는 선 포함)
+ */
+static uint32_t SyntheticBackground(int x, int y)
+{
+    uint32_t r = (uint32_t)(x * 255 / 4096) & 0xFF;
+    uint32_t g = (uint32_t)(y * 255 / 4096) & 0xFF;
+    uint32_t b = ((x / 16 + y / 16) & 1) ? 0xE0 : 0x30;
+
+    // 1픽셀 선 (텍스트 가장자리 흉내)
+    if (x % 64 == 0 || y % 48 == 0) {
+        r = g = b = 0xFF;
+    }
+
+    return 0xFF000000u | (r << 16) | (g << 8) | b;
+}
+
+/**
+ * 합성 화면의 사각형 영역 다시 그리기 (상자 포함)
+ */
+static void SyntheticDraw(SyntheticSource* src, const FrameRect* rect)
+{
+    for (int y = rect->top; y < rect->bottom; y++) {
+        uint32_t* row = PixelBuffer_Row(&src->desktop, y);
+        for (int x = rect->left; x < rect->right; x++) {
+            bool inBox = x >= src->boxX && x < src->boxX + SYNTH_BOX_SIZE &&
+                         y >= src->boxY && y < src->boxY + SYNTH_BOX_SIZE;
+            row[x] = inBox ? 0xFFFF4020u : SyntheticBackground(x, y);
+        }
+    }
+}
+
+/**
+ * 상자 영역 (데스크톱 경계로 자름)
+ */
+static FrameRect SyntheticBoxRect(const SyntheticSource* src)
+{
+    FrameRect box = {src->boxX, src->boxY, src->boxX + SYNTH_BOX_SIZE, src->boxY + SYNTH_BOX_SIZE};
+    FrameRect desktop = {0, 0, src->base.width, src->base.height};
+    FrameRect clipped = {0, 0, 0, 0};
+    FrameRect_Intersect(&clipped, &box, &desktop);
+    return clipped;
+}
+
+/**
+ * 합성 공급원 프레임 획득 (획득할 때마다 상자가 움직임)
+ */
+static bool SyntheticAcquire(FrameSource* base, const FrameRect* region, Frame* frame)
+{
+    SyntheticSource* src = (SyntheticSource*)base;
+
+    if (src->frameNumber == 0) {
+        FrameRect all = {0, 0, base->width, base->height};
+        SyntheticDraw(src, &all);
+        frame->fullRefresh = true;
+    } else {
+        FrameRect oldBox = SyntheticBoxRect(src);
+
+        // 상자 이동 (가장자리에서 반사)
+        src->boxX += src->dx;
+        src->boxY += src->dy;
+        if (src->boxX < 0 || src->boxX + SYNTH_BOX_SIZE > base->width) {
+            src->dx = -src->dx;
+            src->boxX += 2 * src->dx;
+        }
+        if (src->boxY < 0 || src->boxY + SYNTH_BOX_SIZE > base->height) {
+            src->dy = -src->dy;
+            src->boxY += 2 * src->dy;
+        }
+
+        FrameRect newBox = SyntheticBoxRect(src);
+        SyntheticDraw(src, &oldBox);
+        SyntheticDraw(src, &newBox);
+
+        src->dirty[0] = oldBox;
+        src->dirty[1] = newBox;
+        frame->dirtyRects = src->dirty;
+        frame->dirtyCount = 2;
+    }
+
+    src->frameNumber++;
+    frame->frameNumber = src->frameNumber;
+    frame->bounds = *region;
+    frame->pixels = PixelBuffer_SubView(&src->desktop, region->left, region->top,
+                                        region->right - region->left, region->bottom - region->top);
+    return true;
+}
+
+/**
+ * 합성 공급원 파괴
+ */
+static void SyntheticDestroy(FrameSource* base)
+{
+    SyntheticSource* src = (SyntheticSource*)base;
+    PixelBuffer_Free(&src->desktop);
+    free(src);
+}
+
+static const FrameSourceOps g_syntheticOps = {
+    "synthetic",
+    SyntheticAcquire,
+    SyntheticDestroy
+};
+
+/**
+ * 합성 공급원 생성
+ */
+FrameSource* FrameSource_CreateSynthetic(int width, int height)
+{
+    if (width < SYNTH_BOX_SIZE * 2 || height < SYNTH_BOX_SIZE * 2) {
+        return NULL;
+    }
+
+    SyntheticSource* src = (SyntheticSource*)calloc(1, sizeof(SyntheticSource));
+    if (!src) return NULL;
+
+    if (!PixelBuffer_Alloc(&src->desktop, width, height)) {
+        free(src);
+        return NULL;
+    }
+
+    src->base.ops = &g_syntheticOps;
+    src->base.width = width;
+    src->base.height = height;
+    src->boxX = width / 3;
+    src->boxY = height / 3;
+    src->dx = SYNTH_BOX_SPEED;
+    src->dy = SYNTH_BOX_SPEED / 2 + 1;
+    return &src->base;
+}
+
+/**
+ * 파일에서 다음 프레임 기록 읽기 (끝이면 처음으로 되감기)
+ */
+static bool FileReadRecord(FileSource* src, uint32_t* count)
+{
+    if (fread(count, sizeof(uint32_t), 1, src->file) == 1) {
+        return true;
+    }
+
+    // 끝에 도달 → 처음부터 반복
+    if (fseek(src->file, src->dataStart, SEEK_SET) != 0) {
+        return false;
+    }
+    return fread(count, sizeof(uint32_t), 1, src->file) == 1;
+}
+
+/**
+ * 파일 공급원 프레임 획득 (획득할 때마다 기록 하나를 적용)
+ */
+static bool FileAcquire(FrameSource* base, const FrameRect* region, Frame* frame)
+{
+    FileSource* src = (FileSource*)base;
+    uint32_t count = 0;
+
+    if (!FileReadRecord(src, &count)) {
+        return false;
+    }
+
+    // 사각형마다 적어도 한 픽셀이므로 화면 픽셀 수보다 많을 수 없음 (손상된 파일)
+    if (count > FRAME_FILE_MAX_RECTS || (uint64_t)count > (uint64_t)base->width * (uint64_t)base->height) {
+        return false;
+    }
+
+    if (count > (uint32_t)src->dirtyCapacity) {
+        FrameRect* rects = (FrameRect*)realloc(src->dirty, sizeof(FrameRect) * (size_t)count);
+        if (!rects) return false;
+        src->dirty = rects;
+        src->dirtyCapacity = (int)count;
+    }
+
+    if (fread(src->dirty, sizeof(FrameRect), count, src->file) != count) {
+        return false;
+    }
+
+    // 바뀐 영역의 픽셀을 데스크톱 버퍼에 적용
+    FrameRect desktop = {0, 0, base->width, base->height};
+    uint64_t bytes = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        FrameRect r = src->dirty[i];
+        FrameRect clipped;
+        if (!FrameRect_Intersect(&clipped, &r, &desktop) ||
+            clipped.left != r.left || clipped.top != r.top ||
+            clipped.right != r.right || clipped.bottom != r.bottom) {
+            return false;  // 손상된 파일
+        }
+
+        size_t rowBytes = (size_t)(r.right - r.left) * 4;
+        for (int y = r.top; y < r.bottom; y++) {
+            if (fread(PixelBuffer_Row(&src->desktop, y) + r.left, 1, rowBytes, src->file) != rowBytes) {
+                return false;
+            }
+        }
+        bytes += rowBytes * (size_t)(r.bottom - r.top);
+    }
+
+    src->frameNumber++;
+    frame->bytesCopied = bytes;
+    frame->frameNumber = src->frameNumber;
+    frame->dirtyRects = src->dirty;
+    frame->dirtyCount = (int)count;
+    frame->bounds = *region;
+    frame->pixels = PixelBuffer_SubView(&src->desktop, region->left, region->top,
+                                        region->right - region->left, region->bottom - region->top);
+    return true;
+}
+
+/**
+ * 파일 공급원 파괴
+ */
+static void FileDestroy(FrameSource* base)
+{
+    FileSource* src = (FileSource*)base;
+    if (src->file) fclose(src->file);
+    PixelBuffer_Free(&src->desktop);
+    free(src->dirty);
+    free(src);
+}
+
+static const FrameSourceOps g_fileOps = {
+    "file",
+    FileAcquire,
+    FileDestroy
+};
+
+/**
+ * 녹화 파일 공급원 생성
+ */
+FrameSource* FrameSource_CreateFile(const char* path)
+{
+    FILE* file = fopen(path, "rb");
+    if (!file) return NULL;
+
+    FrameFileHeader header;
+    if (fread(&header, sizeof(header), 1, file) != 1 ||
+        memcmp(header.magic, FRAME_FILE_MAGIC, 4) != 0 ||
+        header.version != FRAME_FILE_VERSION ||
+        header.width <= 0 || header.height <= 0) {
+        fclose(file);
+        return NULL;
+    }
+
+    FileSource* src = (FileSource*)calloc(1, sizeof(FileSource));
+    if (!src || !PixelBuffer_Alloc(&src->desktop, header.width, header.height)) {
+        free(src);
+        fclose(file);
+        return NULL;
+    }
+
+    PixelBuffer_Fill(&src->desktop, 0xFF000000u);
+    src->base.ops = &g_fileOps;
+    src->base.width = header.width;
+    src->base.height = header.height;
+    src->file = file;
+    src->dataStart = ftell(file);
+    return &src->base;
+}
+
+/**
+ * 녹화 파일 작성기 생성
+ */
+FrameRecorder* FrameRecorder_Create(const char* path, int width, int height)
+{
+    if (width <= 0 || height <= 0) return NULL;
+
+    FILE* file = fopen(path, "wb");
+    if (!file) return NULL;
+
+    FrameFileHeader header;
+    memcpy(header.magic, FRAME_FILE_MAGIC, 4);
+    header.version = FRAME_FILE_VERSION;
+    header.width = width;
+    header.height = height;
+
+    FrameRecorder* recorder = (FrameRecorder*)calloc(1, sizeof(FrameRecorder));
+    if (!recorder || fwrite(&header, sizeof(header), 1, file) != 1) {
+        free(recorder);
+        fclose(file);
+        return NULL;
+    }
+
+    recorder->file = file;
+    recorder->width = width;
+    recorder->height = height;
+    return recorder;
+}
+
+/**
+ * 프레임 기록 (프레임 영역 안의 변경분만 저장, 이동 영역은 변경으로 취급)
+ */
+bool FrameRecorder_Write(FrameRecorder* recorder, const Frame* frame)
+{
+    if (!recorder || !frame) return false;
+
+    // 사각형이 읽는 쪽 한도보다 많으면 프레임 영역 전체를 하나로 기록
+    bool full = frame->fullRefresh || frame->dirtyCount + frame->moveCount > FRAME_FILE_MAX_RECTS;
+    int maxRects = full ? 1 : frame->dirtyCount + frame->moveCount;
+    if (maxRects > recorder->rectCapacity) {
+        FrameRect* rects = (FrameRect*)realloc(recorder->rects, sizeof(FrameRect) * maxRects);
+        if (!rects) return false;
+        recorder->rects = rects;
+        recorder->rectCapacity = maxRects;
+    }
+
+    // 기록할 사각형 (프레임 영역과 파일 크기로 자름)
+    FrameRect limit = {0, 0, recorder->width, recorder->height};
+    FrameRect bounds;
+    if (!FrameRect_Intersect(&bounds, &frame->bounds, &limit)) {
+        return false;
+    }
+
+    uint32_t count = 0;
+    if (full) {
+        recorder->rects[count++] = bounds;
+    } else {
+        for (int i = 0; i < frame->dirtyCount + frame->moveCount; i++) {
+            const FrameRect* r = i < frame->dirtyCount ? &frame->dirtyRects[i]
+                                                       : &frame->moveRects[i - frame->dirtyCount].dst;
+            if (FrameRect_Intersect(&recorder->rects[count], r, &bounds)) {
+                count++;
+            }
+        }
+    }
+
+    if (fwrite(&count, sizeof(count), 1, recorder->file) != 1 ||
+        fwrite(recorder->rects, sizeof(FrameRect), count, recorder->file) != count) {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < count; i++) {
+        const FrameRect* r = &recorder->rects[i];
+        size_t rowBytes = (size_t)(r->right - r->left) * 4;
+        for (int y = r->top; y < r->bottom; y++) {
+            const uint32_t* row = PixelBuffer_Row(&frame->pixels, y - frame->bounds.top) +
+                                  (r->left - frame->bounds.left);
+            if (fwrite(row, 1, rowBytes, recorder->file) != rowBytes) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+/**
+ * 녹화 파일 닫기
+ */
+void FrameRecorder_Close(FrameRecorder* recorder)
+{
+    if (!recorder) return;
+
+    if (recorder->file) fclose(recorder->file);
+    free(recorder->rects);
+    free(recorder);
+}
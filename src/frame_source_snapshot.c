@@ -0,0 +1,101 @@
+/**
+ * frame_source_snapshot.c - 정지 화면 공급원
+ *
+ * 생성할 때 다른 공급원에서 데스크톱 전체를 한 번 복사해 두고,
+ * 이후 획득은 복사 없이 그 버퍼의 뷰만 돌려준다. (정지 확대 모드)
+ */
+
+#include "frame_source.h"
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct {
+    FrameSource base;
+    PixelBuffer desktop;
+    uint64_t snapshotBytes;     // 스냅샷에 복사한 바이트 (첫 획득 통계로 보고)
+    bool delivered;             // 첫 프레임을 넘겼는지
+} SnapshotSource;
+
+static bool SnapshotAcquire(FrameSource* source, const FrameRect* region, Frame* frame)
+{
+    SnapshotSource* snap = (SnapshotSource*)source;
+
+    frame->pixels = PixelBuffer_SubView(&snap->desktop, region->left, region->top,
+                                        region->right - region->left, region->bottom - region->top);
+    frame->bounds = *region;
+    frame->frameNumber = 1;
+
+    // 첫 프레임만 전체 변경, 이후로는 바뀐 영역 없음
+    if (!snap->delivered) {
+        frame->fullRefresh = true;
+        frame->bytesCopied = snap->snapshotBytes;
+        snap->delivered = true;
+    }
+
+    return true;
+}
+
+static void SnapshotDestroy(FrameSource* source)
+{
+    SnapshotSource* snap = (SnapshotSource*)source;
+
+    PixelBuffer_Free(&snap->desktop);
+    free(snap);
+}
+
+static const FrameSourceOps g_snapshotOps = {
+    "snapshot",
+    SnapshotAcquire,
+    SnapshotDestroy
+};
+
+/**
+ * 정지 화면 공급원 생성
+ */
+FrameSource* FrameSource_CreateSnapshot(FrameSource* live)
+{
+    Frame frame;
+    if (!FrameSource_Acquire(live, NULL, &frame)) {
+        return NULL;
+    }
+
+    SnapshotSource* snap = (SnapshotSource*)calloc(1, sizeof(SnapshotSource));
+    if (!snap) return NULL;
+
+    if (!PixelBuffer_Alloc(&snap->desktop, live->width, live->height)) {
+        free(snap);
+        return NULL;
+    }
+
+    // 전체 영역을 요청했으므로 frame.pixels가 데스크톱 전체
+    for (int y = 0; y < frame.pixels.height; y++) {
+        memcpy(PixelBuffer_Row(&snap->desktop, y), PixelBuffer_Row(&frame.pixels, y),
+               (size_t)frame.pixels.width * 4);
+    }
+
+    snap->base.ops = &g_snapshotOps;
+    snap->base.width = live->width;
+    snap->base.height = live->height;
+    snap->snapshotBytes = frame.bytesCopied + (uint64_t)live->width * live->height * 4;
+    return &snap->base;
+}
+
+/**
+ * 이미 있는 픽셀로 정지 화면 공급원 생성 (복사 없음)
+ */
+FrameSource* FrameSource_CreateStill(const PixelBuffer* pixels)
+{
+    if (!pixels || !pixels->pixels) return NULL;
+
+    SnapshotSource* snap = (SnapshotSource*)calloc(1, sizeof(SnapshotSource));
+    if (!snap) return NULL;
+
+    // 메모리는 빌려 쓰므로 파괴할 때 해제하지 않음
+    PixelBuffer_Wrap(&snap->desktop, pixels->pixels, pixels->width, pixels->height, pixels->stride);
+
+    snap->base.ops = &g_snapshotOps;
+    snap->base.width = pixels->width;
+    snap->base.height = pixels->height;
+    snap->snapshotBytes = (uint64_t)pixels->width * pixels->height * 4;
+    return &snap->base;
+}
@@ -0,0 +1,164 @@
+/**
+ * frame_source_window.c - 창 하나만 캡처하는 공급원 (PrintWindow)
+ *
+ * 화면이 아니라 창 자체의 내용을 DIB 섹션으로 받는다. 다른 창이나 알림이 위를 덮어도
+ * 찍히지 않고, 복사량은 모니터가 아니라 창 크기만큼이다.
+ * PW_RENDERFULLCONTENT(Windows 8.1+)로 DirectX/브라우저 창도 컴포지터의 창 표면에서 받는다.
+ * 변경 정보가 없으므로 GDI 공급원처럼 바뀐 타일은 파이프라인의 타일 해시가 찾는다.
+ */
+
+#include "frame_source.h"
+#include "dib_buffer.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifndef PW_RENDERFULLCONTENT
+#define PW_RENDERFULLCONTENT 0x00000002
+#endif
+
+#ifndef DWMWA_EXTENDED_FRAME_BOUNDS
+#define DWMWA_EXTENDED_FRAME_BOUNDS 9
+#endif
+
+// dwmapi.dll (보이는 창 영역, 없으면 GetWindowRect)
+typedef HRESULT (WINAPI *DwmGetWindowAttributeFunc)(HWND, DWORD, PVOID, DWORD);
+static bool g_dwmLoaded = false;
+static DwmGetWindowAttributeFunc g_dwmGetWindowAttribute = NULL;
+
+typedef struct {
+    FrameSource base;
+    HWND hwnd;
+    DibBuffer capture;      // 창 전체 (보이지 않는 테두리 포함) 크기
+    uint64_t frameNumber;
+} WindowSource;
+
+/**
+ * DwmGetWindowAttribute 로드 (처음 한 번)
+ */
+static DwmGetWindowAttributeFunc LoadDwmGetWindowAttribute(void)
+{
+    if (!g_dwmLoaded) {
+        g_dwmLoaded = true;
+        HMODULE dwmapi = LoadLibraryW(L"dwmapi.dll");
+        if (dwmapi) {
+            g_dwmGetWindowAttribute =
+                (DwmGetWindowAttributeFunc)(void*)GetProcAddress(dwmapi, "DwmGetWindowAttribute");
+        }
+    }
+    return g_dwmGetWindowAttribute;
+}
+
+/**
+ * 창의 보이는 영역 가져오기
+ * Windows 10부터 GetWindowRect에는 보이지 않는 크기 조절 테두리(그림자)가 들어 있어
+ * 그대로 쓰면 확대 화면 가장자리에 빈 띠가 생긴다.
+ */
+bool FrameSource_GetWindowBounds(HWND hwnd, FrameRect* bounds)
+{
+    if (!IsWindow(hwnd) || IsIconic(hwnd) || !IsWindowVisible(hwnd)) {
+        return false;
+    }
+
+    RECT rect;
+    DwmGetWindowAttributeFunc getAttribute = LoadDwmGetWindowAttribute();
+    if (!getAttribute ||
+        FAILED(getAttribute(hwnd, DWMWA_EXTENDED_FRAME_BOUNDS, &rect, sizeof(rect)))) {
+        if (!GetWindowRect(hwnd, &rect)) {
+            return false;
+        }
+    }
+
+    bounds->left = rect.left;
+    bounds->top = rect.top;
+    bounds->right = rect.right;
+    bounds->bottom = rect.bottom;
+    return bounds->right > bounds->left && bounds->bottom > bounds->top;
+}
+
+static bool WindowAcquire(FrameSource* source, const FrameRect* region, Frame* frame)
+{
+    WindowSource* ws = (WindowSource*)source;
+
+    // 보이는 영역 크기가 만들 때와 다르면 좌표가 맞지 않음 (호출 측이 공급원을 다시 만듦)
+    RECT windowRect;
+    FrameRect bounds;
+    if (!FrameSource_GetWindowBounds(ws->hwnd, &bounds) || !GetWindowRect(ws->hwnd, &windowRect) ||
+        bounds.right - bounds.left != source->width || bounds.bottom - bounds.top != source->height) {
+        return false;
+    }
+
+    // PrintWindow는 창 전체를 그리므로 버퍼는 창 크기 (크기가 그대로면 재사용)
+    int width = windowRect.right - windowRect.left;
+    int height = windowRect.bottom - windowRect.top;
+    DibBuffer* capture = &ws->capture;
+    if (!capture->hbm || capture->pixels.width != width || capture->pixels.height != height) {
+        DibBuffer_Destroy(capture);
+        if (!DibBuffer_Create(capture, width, height)) {
+            return false;
+        }
+    }
+
+    if (!PrintWindow(ws->hwnd, capture->hdc, PW_RENDERFULLCONTENT)) {
+        return false;
+    }
+
+    // GDI가 DIB에 쓰기를 마친 뒤 픽셀에 접근
+    GdiFlush();
+
+    // 공급원 좌표 → 창 DC 좌표 (보이지 않는 테두리만큼 밀림)
+    int offsetX = bounds.left - windowRect.left;
+    int offsetY = bounds.top - windowRect.top;
+    FrameRect limit = {0, 0, width - offsetX, height - offsetY};
+    FrameRect area;
+    if (!FrameRect_Intersect(&area, region, &limit)) {
+        return false;
+    }
+
+    frame->pixels = PixelBuffer_SubView(&capture->pixels, offsetX + area.left, offsetY + area.top,
+                                        area.right - area.left, area.bottom - area.top);
+    frame->bounds = area;
+    frame->bytesCopied = (uint64_t)width * height * 4;
+
+    frame->fullRefresh = true;
+    frame->frameNumber = ++ws->frameNumber;
+    return true;
+}
+
+static void WindowDestroy(FrameSource* source)
+{
+    WindowSource* ws = (WindowSource*)source;
+
+    DibBuffer_Destroy(&ws->capture);
+    free(ws);
+}
+
+static const FrameSourceOps g_windowOps = {
+    "window",
+    WindowAcquire,
+    WindowDestroy
+};
+
+/**
+ * 창 공급원 생성
+ */
+FrameSource* FrameSource_CreateWindow(HWND hwnd)
+{
+    FrameRect bounds;
+    if (!FrameSource_GetWindowBounds(hwnd, &bounds)) {
+        OutputDebugStringW(L"[FrameSource] Target window not visible\n");
+        return NULL;
+    }
+
+    WindowSource* ws = (WindowSource*)calloc(1, sizeof(WindowSource));
+    if (!ws) return NULL;
+
+    ws->base.ops = &g_windowOps;
+    ws->base.width = bounds.right - bounds.left;
+    ws->base.height = bounds.bottom - bounds.top;
+    ws->hwnd = hwnd;
+
+    WCHAR msg[96];
+    swprintf_s(msg, 96, L"[FrameSource] Window source created (%dx%d)\n", ws->base.width, ws->base.height);
+    OutputDebugStringW(msg);
+    return &ws->base;
+}
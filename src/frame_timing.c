@@ -0,0 +1,59 @@
+/**
+ * frame_timing.c - 프레임 간격/지터 통계 구현
+ */
+
+#include "frame_timing.h"
+#include <math.h>
+#include <string.h>
+
+/**
+ * 초기화
+ */
+void FrameTiming_Reset(FrameTiming* timing, double targetMs)
+{
+    memset(timing, 0, sizeof(FrameTiming));
+    timing->stats.targetMs = targetMs;
+}
+
+/**
+ * 프레임 표시 시각 기록
+ */
+void FrameTiming_AddFrame(FrameTiming* timing, double nowMs)
+{
+    if (timing->hasLast) {
+        double interval = nowMs - timing->lastMs;
+        FrameTimingStats* s = &timing->stats;
+
+        s->frames++;
+        double delta = interval - s->meanMs;
+        s->meanMs += delta / (double)s->frames;
+        timing->m2 += delta * (interval - s->meanMs);
+
+        if (interval > s->maxMs) {
+            s->maxMs = interval;
+        }
+        if (s->targetMs > 0.0 && interval > s->targetMs * FRAME_TIMING_MISS_FACTOR) {
+            s->missed++;
+        }
+    }
+
+    timing->lastMs = nowMs;
+    timing->hasLast = true;
+}
+
+/**
+ * 간격 측정 끊기
+ */
+void FrameTiming_Break(FrameTiming* timing)
+{
+    timing->hasLast = false;
+}
+
+/**
+ * 통계 가져오기
+ */
+void FrameTiming_GetStats(const FrameTiming* timing, FrameTimingStats* stats)
+{
+    *stats = timing->stats;
+    stats->jitterMs = timing->stats.frames > 1 ? sqrt(timing->m2 / (double)(timing->stats.frames - 1)) : 0.0;
+}
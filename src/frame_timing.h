@@ -0,0 +1,52 @@
+/**
+ * frame_timing.h - 프레임 간격/지터 통계
+ *
+ * 프레임이 표시된 시각을 받아 간격의 평균, 표준편차(지터), 최대값과
+ * 목표 간격을 크게 넘긴 프레임 수를 센다. (플랫폼 독립)
+ */
+
+#ifndef LETSZOOM_FRAME_TIMING_H
+#define LETSZOOM_FRAME_TIMING_H
+
+#include <stdbool.h>
+
+// 목표 간격의 이 배수를 넘으면 놓친 프레임으로 센다
+#define FRAME_TIMING_MISS_FACTOR 1.5
+
+typedef struct {
+    unsigned long long frames;      // 측정한 간격 수
+    unsigned long long missed;      // 목표 간격 × 1.5 초과
+    double targetMs;                // 목표 간격 (디스플레이 주기)
+    double meanMs;                  // 평균 간격
+    double jitterMs;                // 간격 표준편차
+    double maxMs;                   // 최대 간격
+} FrameTimingStats;
+
+typedef struct {
+    FrameTimingStats stats;
+    double lastMs;
+    double m2;                      // 분산 누적 (Welford)
+    bool hasLast;
+} FrameTiming;
+
+/**
+ * 초기화 (targetMs: 목표 프레임 간격)
+ */
+void FrameTiming_Reset(FrameTiming* timing, double targetMs);
+
+/**
+ * 프레임 표시 시각 기록 (밀리초)
+ */
+void FrameTiming_AddFrame(FrameTiming* timing, double nowMs);
+
+/**
+ * 간격 측정을 끊기 (쉬었다가 다시 그릴 때, 쉰 시간을 간격으로 세지 않음)
+ */
+void FrameTiming_Break(FrameTiming* timing);
+
+/**
+ * 통계 가져오기
+ */
+void FrameTiming_GetStats(const FrameTiming* timing, FrameTimingStats* stats);
+
+#endif // LETSZOOM_FRAME_TIMING_H
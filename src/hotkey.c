@@ -5,10 +5,15 @@
 #include "hotkey.h"
 #include "zoom_overlay.h"
 #include "drawing_overlay.h"
+#include "spotlight_overlay.h"
 
 // 초기화 상태
 static bool g_bInitialized = false;
 
+// 확대 단축키 설정 (Hotkey_SetZoomOptions)
+static int g_zoomLevel = 200;
+static bool g_smoothZoom = true;
+
 /**
  * 전역 단축키 등록
  */
@@ -20,12 +25,18 @@ bool Hotkey_Initialize(HWND hwnd)
 
     bool success = true;
 
-    // Ctrl+1: 확대 모드
+    // Ctrl+1: 확대 모드 (실시간)
     if (!RegisterHotKey(hwnd, HOTKEY_ZOOM, MOD_CONTROL, '1')) {
         OutputDebugStringW(L"[LetsZoom] Failed to register Ctrl+1\n");
         success = false;
     }
 
+    // Ctrl+Shift+1: 정지 확대 (시작할 때 한 번 캡처)
+    if (!RegisterHotKey(hwnd, HOTKEY_FREEZE, MOD_CONTROL | MOD_SHIFT, '1')) {
+        OutputDebugStringW(L"[LetsZoom] Failed to register Ctrl+Shift+1\n");
+        success = false;
+    }
+
     // Ctrl+2: 그리기 모드
     if (!RegisterHotKey(hwnd, HOTKEY_DRAW, MOD_CONTROL, '2')) {
         OutputDebugStringW(L"[LetsZoom] Failed to register Ctrl+2\n");
@@ -44,6 +55,30 @@ bool Hotkey_Initialize(HWND hwnd)
         success = false;
     }
 
+    // Ctrl+5: 돋보기 모드
+    if (!RegisterHotKey(hwnd, HOTKEY_LENS, MOD_CONTROL, '5')) {
+        OutputDebugStringW(L"[LetsZoom] Failed to register Ctrl+5\n");
+        success = false;
+    }
+
+    // Ctrl+6: 스포트라이트
+    if (!RegisterHotKey(hwnd, HOTKEY_SPOTLIGHT, MOD_CONTROL, '6')) {
+        OutputDebugStringW(L"[LetsZoom] Failed to register Ctrl+6\n");
+        success = false;
+    }
+
+    // Ctrl+7: 창 확대
+    if (!RegisterHotKey(hwnd, HOTKEY_WINDOW, MOD_CONTROL, '7')) {
+        OutputDebugStringW(L"[LetsZoom] Failed to register Ctrl+7\n");
+        success = false;
+    }
+
+    // Ctrl+8: 정지 화면 기록
+    if (!RegisterHotKey(hwnd, HOTKEY_HISTORY, MOD_CONTROL, '8')) {
+        OutputDebugStringW(L"[LetsZoom] Failed to register Ctrl+8\n");
+        success = false;
+    }
+
     if (success) {
         g_bInitialized = true;
         OutputDebugStringW(L"[LetsZoom] Hotkeys registered\n");
@@ -75,12 +110,26 @@ void Hotkey_Shutdown(HWND hwnd)
     UnregisterHotKey(hwnd, HOTKEY_DRAW);
     UnregisterHotKey(hwnd, HOTKEY_ZOOM_DRAW);
     UnregisterHotKey(hwnd, HOTKEY_SCREENSHOT);
+    UnregisterHotKey(hwnd, HOTKEY_LENS);
+    UnregisterHotKey(hwnd, HOTKEY_SPOTLIGHT);
+    UnregisterHotKey(hwnd, HOTKEY_WINDOW);
+    UnregisterHotKey(hwnd, HOTKEY_HISTORY);
+    UnregisterHotKey(hwnd, HOTKEY_FREEZE);
 
     g_bInitialized = false;
 
     OutputDebugStringW(L"[LetsZoom] Hotkeys unregistered\n");
 }
 
+/**
+ * 확대 단축키 설정
+ */
+void Hotkey_SetZoomOptions(int zoomLevel, bool smoothZoom)
+{
+    g_zoomLevel = zoomLevel;
+    g_smoothZoom = smoothZoom;
+}
+
 /**
  * 단축키 메시지 처리
  */
@@ -92,7 +141,16 @@ void Hotkey_HandleMessage(WPARAM hotkeyId)
             if (ZoomOverlay_IsActive()) {
                 ZoomOverlay_Hide();
             } else {
-                ZoomOverlay_Show(200, true);  // 200% 확대, 부드러운 확대
+                ZoomOverlay_Show(g_zoomLevel, g_smoothZoom, false);  // 실시간 화면
+            }
+            break;
+
+        case HOTKEY_FREEZE:
+            OutputDebugStringW(L"[LetsZoom] Hotkey: Still zoom (Ctrl+Shift+1)\n");
+            if (ZoomOverlay_IsActive()) {
+                ZoomOverlay_Hide();
+            } else {
+                ZoomOverlay_Show(g_zoomLevel, g_smoothZoom, true);  // 정지 화면
             }
             break;
 
@@ -125,6 +183,42 @@ void Hotkey_HandleMessage(WPARAM hotkeyId)
             );
             break;
 
+        case HOTKEY_LENS:
+            OutputDebugStringW(L"[LetsZoom] Hotkey: Lens (Ctrl+5)\n");
+            if (ZoomOverlay_IsActive()) {
+                ZoomOverlay_Hide();
+            } else {
+                ZoomOverlay_ShowLens(g_smoothZoom);  // 크기/배율은 설정
+            }
+            break;
+
+        case HOTKEY_SPOTLIGHT:
+            OutputDebugStringW(L"[LetsZoom] Hotkey: Spotlight (Ctrl+6)\n");
+            if (SpotlightOverlay_IsActive()) {
+                SpotlightOverlay_Hide();
+            } else {
+                SpotlightOverlay_Show();  // 모양/크기/어둡기는 설정
+            }
+            break;
+
+        case HOTKEY_WINDOW:
+            OutputDebugStringW(L"[LetsZoom] Hotkey: Window zoom (Ctrl+7)\n");
+            if (ZoomOverlay_IsActive()) {
+                ZoomOverlay_Hide();
+            } else {
+                ZoomOverlay_ShowWindow(100, g_smoothZoom);  // 커서 아래 창이 모니터를 채우는 배율
+            }
+            break;
+
+        case HOTKEY_HISTORY:
+            OutputDebugStringW(L"[LetsZoom] Hotkey: Snapshot history (Ctrl+8)\n");
+            if (ZoomOverlay_IsActive()) {
+                ZoomOverlay_Hide();
+            } else {
+                ZoomOverlay_ShowHistory(g_smoothZoom);  // 가장 최근 정지 화면
+            }
+            break;
+
         default:
             OutputDebugStringW(L"[LetsZoom] Unknown hotkey\n");
             break;
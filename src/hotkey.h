@@ -13,7 +13,12 @@ enum {
     HOTKEY_ZOOM = 1,
     HOTKEY_DRAW = 2,
     HOTKEY_ZOOM_DRAW = 3,
-    HOTKEY_SCREENSHOT = 4
+    HOTKEY_SCREENSHOT = 4,
+    HOTKEY_LENS = 5,
+    HOTKEY_SPOTLIGHT = 6,
+    HOTKEY_WINDOW = 7,
+    HOTKEY_HISTORY = 8,
+    HOTKEY_FREEZE = 9
 };
 
 /**
@@ -26,6 +31,11 @@ bool Hotkey_Initialize(HWND hwnd);
  */
 void Hotkey_Shutdown(HWND hwnd);
 
+/**
+ * 확대 단축키의 배율과 부드러운 확대 (설정 값, 기본 200%, 부드러운 확대)
+ */
+void Hotkey_SetZoomOptions(int zoomLevel, bool smoothZoom);
+
 /**
  * 단축키 메시지 처리
  */
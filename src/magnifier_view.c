@@ -0,0 +1,192 @@
+/**
+ * magnifier_view.c - Magnification API 확대 구현
+ *
+ * Magnification.dll은 동적으로 불러온다 (없거나 초기화에 실패하면 생성 실패 → 호출자가 GDI 사용).
+ */
+
+#include "magnifier_view.h"
+#include "worker_pool.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Magnification 컨트롤 창 클래스
+#define MAGNIFIER_CLASS L"Magnifier"
+
+// MagSetWindowFilterList: 목록의 창을 원본에서 뺌
+#define MAG_FILTER_EXCLUDE 0
+
+// 배율 변환 행렬 (MAGTRANSFORM)
+typedef struct {
+    float v[3][3];
+} MagTransform;
+
+// 색 변환 행렬 (MAGCOLOREFFECT, [R G B A 1] 행 벡터 × 행렬)
+typedef struct {
+    float transform[5][5];
+} MagColorEffect;
+
+typedef BOOL (WINAPI *MagInitializeFunc)(void);
+typedef BOOL (WINAPI *MagUninitializeFunc)(void);
+typedef BOOL (WINAPI *MagSetWindowSourceFunc)(HWND, RECT);
+typedef BOOL (WINAPI *MagSetWindowTransformFunc)(HWND, MagTransform*);
+typedef BOOL (WINAPI *MagSetWindowFilterListFunc)(HWND, DWORD, int, HWND*);
+typedef BOOL (WINAPI *MagSetLensUseBitmapSmoothingFunc)(HWND, BOOL);
+typedef BOOL (WINAPI *MagSetColorEffectFunc)(HWND, MagColorEffect*);
+
+struct MagnifierView {
+    HMODULE module;
+    MagUninitializeFunc uninitialize;
+    MagSetWindowSourceFunc setSource;
+    MagSetWindowTransformFunc setTransform;
+    MagSetLensUseBitmapSmoothingFunc setSmoothing;     // Windows 10 1809부터 (없으면 NULL)
+    MagSetColorEffectFunc setColorEffect;
+
+    HWND hwnd;              // 확대 컨트롤
+    float zoom;             // 마지막으로 지정한 배율 (0이면 아직 없음)
+    int smooth;             // 마지막으로 지정한 보간 (-1이면 아직 없음)
+    ColorFilter color;      // 마지막으로 지정한 색 필터
+    MagnifierStats stats;
+};
+
+/**
+ * 확대 컨트롤 생성
+ */
+MagnifierView* MagnifierView_Create(HWND host, int width, int height)
+{
+    MagnifierView* view = (MagnifierView*)calloc(1, sizeof(MagnifierView));
+    if (!view) return NULL;
+
+    view->module = LoadLibraryW(L"Magnification.dll");
+    if (!view->module) {
+        OutputDebugStringW(L"[Magnifier] Magnification.dll not available\n");
+        free(view);
+        return NULL;
+    }
+
+    MagInitializeFunc initialize = (MagInitializeFunc)(void*)GetProcAddress(view->module, "MagInitialize");
+    MagSetWindowFilterListFunc setFilterList =
+        (MagSetWindowFilterListFunc)(void*)GetProcAddress(view->module, "MagSetWindowFilterList");
+    view->uninitialize = (MagUninitializeFunc)(void*)GetProcAddress(view->module, "MagUninitialize");
+    view->setSource = (MagSetWindowSourceFunc)(void*)GetProcAddress(view->module, "MagSetWindowSource");
+    view->setTransform = (MagSetWindowTransformFunc)(void*)GetProcAddress(view->module, "MagSetWindowTransform");
+    view->setSmoothing =
+        (MagSetLensUseBitmapSmoothingFunc)(void*)GetProcAddress(view->module, "MagSetLensUseBitmapSmoothing");
+    view->setColorEffect = (MagSetColorEffectFunc)(void*)GetProcAddress(view->module, "MagSetColorEffect");
+
+    if (!initialize || !setFilterList || !view->uninitialize || !view->setSource || !view->setTransform ||
+        !view->setColorEffect || !initialize()) {
+        OutputDebugStringW(L"[Magnifier] Failed to initialize Magnification API\n");
+        FreeLibrary(view->module);
+        free(view);
+        return NULL;
+    }
+
+    // 비활성 자식 창이라 마우스 입력은 host가 받음, 커서는 실제 커서 그대로
+    view->hwnd = CreateWindowExW(0, MAGNIFIER_CLASS, L"LetsZoom Magnifier",
+                                 WS_CHILD | WS_VISIBLE | WS_DISABLED,
+                                 0, 0, width, height, host, NULL, GetModuleHandleW(NULL), NULL);
+    if (!view->hwnd || !setFilterList(view->hwnd, MAG_FILTER_EXCLUDE, 1, &host)) {
+        OutputDebugStringW(L"[Magnifier] Failed to create magnifier control\n");
+        MagnifierView_Destroy(view);
+        return NULL;
+    }
+
+    view->smooth = -1;
+    OutputDebugStringW(L"[Magnifier] Magnifier control created\n");
+    return view;
+}
+
+/**
+ * 확대 컨트롤 파괴
+ */
+void MagnifierView_Destroy(MagnifierView* view)
+{
+    if (!view) return;
+
+    if (view->hwnd) {
+        DestroyWindow(view->hwnd);
+    }
+    view->uninitialize();
+    FreeLibrary(view->module);
+    free(view);
+}
+
+/**
+ * 색 필터를 컨트롤의 색 변환으로 지정
+ */
+static bool SetColorFilter(MagnifierView* view, ColorFilter color)
+{
+    float m[3][4];
+    Scaler_GetColorMatrix(color, m);
+
+    // 행렬 행이 출력 채널이므로 전치 (행: 입력 R, G, B, A, 1 / 열: 출력)
+    MagColorEffect effect;
+    memset(&effect, 0, sizeof(effect));
+    for (int out = 0; out < 3; out++) {
+        for (int in = 0; in < 3; in++) {
+            effect.transform[in][out] = m[out][in];
+        }
+        effect.transform[4][out] = m[out][3];
+    }
+    effect.transform[3][3] = 1.0f;
+    effect.transform[4][4] = 1.0f;
+
+    return view->setColorEffect(view->hwnd, &effect) != FALSE;
+}
+
+/**
+ * 배율과 원본 영역 지정 후 다시 그리기
+ */
+bool MagnifierView_Update(MagnifierView* view, float zoom, const RECT* source, bool smooth, ColorFilter color)
+{
+    if (!view || !source || zoom <= 0.0f) return false;
+
+    double start = WorkerPool_NowMs();
+
+    if (zoom != view->zoom) {
+        MagTransform transform = {{{0}}};
+        transform.v[0][0] = zoom;
+        transform.v[1][1] = zoom;
+        transform.v[2][2] = 1.0f;
+        if (!view->setTransform(view->hwnd, &transform)) {
+            return false;
+        }
+        view->zoom = zoom;
+    }
+
+    if (view->setSmoothing && (int)smooth != view->smooth) {
+        view->setSmoothing(view->hwnd, smooth);
+        view->smooth = smooth;
+    }
+
+    if (color != view->color) {
+        if (!SetColorFilter(view, color)) {
+            return false;
+        }
+        view->color = color;
+    }
+
+    if (!view->setSource(view->hwnd, *source)) {
+        return false;
+    }
+
+    // 원본 화면은 매 주기 바뀔 수 있으므로 항상 다시 그림 (바로 그려 갱신 시간을 잼)
+    InvalidateRect(view->hwnd, NULL, FALSE);
+    UpdateWindow(view->hwnd);
+
+    double elapsed = WorkerPool_NowMs() - start;
+    MagnifierStats* s = &view->stats;
+    s->updates++;
+    s->meanMs += (elapsed - s->meanMs) / (double)s->updates;
+    if (elapsed > s->maxMs) s->maxMs = elapsed;
+    return true;
+}
+
+/**
+ * 갱신 시간 통계
+ */
+void MagnifierView_GetStats(const MagnifierView* view, MagnifierStats* stats)
+{
+    if (!view || !stats) return;
+    *stats = view->stats;
+}
@@ -0,0 +1,49 @@
+/**
+ * magnifier_view.h - Magnification API 확대 (GPU 변환)
+ *
+ * 확대 창 안에 Magnification 컨트롤을 자식 창으로 띄우고 배율과 원본 영역만 지정하면
+ * 컴포지터가 GPU에서 확대해 그린다. 화면을 CPU로 복사하지 않고, 확대 창 자신은
+ * 필터 목록으로 원본에서 빠지므로 자기 출력을 다시 확대하지 않는다.
+ * 픽셀을 받지 않으므로 확대 파이프라인(타일 캐시, 확대 필터, HUD 합성)은 거치지 않는다.
+ */
+
+#ifndef LETSZOOM_MAGNIFIER_VIEW_H
+#define LETSZOOM_MAGNIFIER_VIEW_H
+
+#include <windows.h>
+#include <stdbool.h>
+#include "scaler.h"
+
+// 갱신 시간 (원본/배율 지정부터 컨트롤이 다 그릴 때까지)
+typedef struct {
+    unsigned long long updates;
+    double meanMs;
+    double maxMs;
+} MagnifierStats;
+
+typedef struct MagnifierView MagnifierView;
+
+/**
+ * 확대 컨트롤 생성 (host 클라이언트 영역 width x height를 덮음, 실패하면 NULL)
+ * host는 확대 원본에서 빠진다. 마우스 입력은 host가 그대로 받는다.
+ */
+MagnifierView* MagnifierView_Create(HWND host, int width, int height);
+
+/**
+ * 확대 컨트롤 파괴
+ */
+void MagnifierView_Destroy(MagnifierView* view);
+
+/**
+ * 배율과 원본 영역(가상 데스크톱 좌표) 지정 후 바로 다시 그림
+ * smooth: 확대 시 보간 (지원하지 않는 Windows에서는 무시)
+ * color: 색 필터 (확대 엔진과 같은 행렬을 컨트롤의 색 변환으로 지정)
+ */
+bool MagnifierView_Update(MagnifierView* view, float zoom, const RECT* source, bool smooth, ColorFilter color);
+
+/**
+ * 갱신 시간 통계
+ */
+void MagnifierView_GetStats(const MagnifierView* view, MagnifierStats* stats);
+
+#endif // LETSZOOM_MAGNIFIER_VIEW_H
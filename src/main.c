@@ -9,8 +9,11 @@
 #include "tray.h"
 #include "hotkey.h"
 #include "settings.h"
+#include "monitor.h"
+#include "residency.h"
 #include "zoom_overlay.h"
 #include "drawing_overlay.h"
+#include "spotlight_overlay.h"
 
 // 윈도우 클래스 이름
 #define WINDOW_CLASS_NAME L"LetsZoomMainWindow"
@@ -154,6 +157,9 @@ static bool Initialize(HINSTANCE hInstance)
 {
     OutputDebugStringW(L"[LetsZoom] Initializing...\n");
 
+    // 0. 모니터별 DPI 인식 (창을 만들기 전에, 확대/캡처 좌표를 물리 픽셀로)
+    Monitor_EnableDpiAwareness();
+
     // 1. 설정 불러오기
     Settings_Initialize(&g_settings);
     Settings_Load(&g_settings);
@@ -178,17 +184,33 @@ static bool Initialize(HINSTANCE hInstance)
     if (!Hotkey_Initialize(g_hwndMain)) {
         return false;
     }
+    Hotkey_SetZoomOptions(g_settings.zoomLevel, g_settings.smoothZoom);
 
-    // 6. 확대 오버레이 초기화
+    // 6. 확대 오버레이 초기화 (닫은 뒤 창/버퍼를 남겨 둘 시간 먼저)
+    Residency_SetKeepWarm(g_settings.keepWarmSeconds * 1000);
     if (!ZoomOverlay_Initialize(hInstance)) {
         return false;
     }
+    ZoomOverlay_SetCaptureBackend(g_settings.captureBackend == 1 ? ZOOM_CAPTURE_DUPLICATION :
+                                  g_settings.captureBackend == 2 ? ZOOM_CAPTURE_MAGNIFIER : ZOOM_CAPTURE_GDI);
+    ZoomOverlay_SetAnimationDuration(g_settings.animationDuration);
+    ZoomOverlay_SetSharpZoom(g_settings.sharpZoom);
+    ZoomOverlay_SetLinearLight(g_settings.linearLight);
+    ZoomOverlay_SetScaleThreads(g_settings.scaleThreads);
+    ZoomOverlay_SetCursorPrediction(g_settings.cursorPrediction, g_settings.predictionSmoothing);
+    ZoomOverlay_SetLens(g_settings.lensWidth, g_settings.lensHeight, g_settings.lensZoomLevel);
 
     // 7. 그리기 오버레이 초기화
     if (!DrawingOverlay_Initialize(hInstance)) {
         return false;
     }
 
+    // 8. 스포트라이트 오버레이 초기화
+    if (!SpotlightOverlay_Initialize(hInstance)) {
+        return false;
+    }
+    SpotlightOverlay_SetStyle(g_settings.spotlightShape == 1, g_settings.spotlightSize, g_settings.spotlightDim);
+
     OutputDebugStringW(L"[LetsZoom] Initialization completed\n");
 
     // 초기화 완료 알림 (설정에서 활성화된 경우)
@@ -213,6 +235,7 @@ static void Cleanup(void)
     Settings_Save(&g_settings);
 
     if (g_hwndMain) {
+        SpotlightOverlay_Shutdown();
         DrawingOverlay_Shutdown();
         ZoomOverlay_Shutdown();
         Hotkey_Shutdown(g_hwndMain);
@@ -0,0 +1,143 @@
+/**
+ * monitor.c - 모니터 정보와 모니터별 DPI 구현
+ *
+ * DPI API는 Windows 버전에 따라 없을 수 있으므로 실행 중에 찾아 쓴다.
+ */
+
+#include "monitor.h"
+#include <string.h>
+
+// 주사율을 알 수 없을 때
+#define DEFAULT_REFRESH_HZ 60
+
+#ifndef DPI_AWARENESS_CONTEXT_PER_MONITOR_AWARE_V2
+#define DPI_AWARENESS_CONTEXT_PER_MONITOR_AWARE_V2 ((HANDLE)-4)
+#endif
+
+// shcore.dll (Windows 8.1+)
+#define PROCESS_PER_MONITOR_DPI_AWARE 2
+#define MDT_EFFECTIVE_DPI 0
+
+typedef BOOL (WINAPI *SetProcessDpiAwarenessContextFunc)(HANDLE);
+typedef HRESULT (WINAPI *SetProcessDpiAwarenessFunc)(int);
+typedef HRESULT (WINAPI *GetDpiForMonitorFunc)(HMONITOR, int, UINT*, UINT*);
+
+static HMODULE g_shcore = NULL;
+static bool g_shcoreLoaded = false;
+static GetDpiForMonitorFunc g_getDpiForMonitor = NULL;
+
+/**
+ * shcore.dll 불러오기 (한 번만, 없으면 NULL)
+ */
+static HMODULE LoadShcore(void)
+{
+    if (!g_shcoreLoaded) {
+        g_shcoreLoaded = true;
+        g_shcore = LoadLibraryW(L"shcore.dll");
+        if (g_shcore) {
+            g_getDpiForMonitor = (GetDpiForMonitorFunc)(void*)GetProcAddress(g_shcore, "GetDpiForMonitor");
+        }
+    }
+    return g_shcore;
+}
+
+/**
+ * 모니터별 DPI 인식 설정
+ */
+void Monitor_EnableDpiAwareness(void)
+{
+    HMODULE user32 = GetModuleHandleW(L"user32.dll");
+    SetProcessDpiAwarenessContextFunc setContext = user32
+        ? (SetProcessDpiAwarenessContextFunc)(void*)GetProcAddress(user32, "SetProcessDpiAwarenessContext")
+        : NULL;
+    if (setContext && setContext(DPI_AWARENESS_CONTEXT_PER_MONITOR_AWARE_V2)) {
+        OutputDebugStringW(L"[Monitor] Per-monitor DPI aware (v2)\n");
+        return;
+    }
+
+    HMODULE shcore = LoadShcore();
+    SetProcessDpiAwarenessFunc setAwareness = shcore
+        ? (SetProcessDpiAwarenessFunc)(void*)GetProcAddress(shcore, "SetProcessDpiAwareness")
+        : NULL;
+    if (setAwareness && SUCCEEDED(setAwareness(PROCESS_PER_MONITOR_DPI_AWARE))) {
+        OutputDebugStringW(L"[Monitor] Per-monitor DPI aware\n");
+        return;
+    }
+
+    // 모니터별 DPI를 모르면 시스템 DPI라도 (가상화된 좌표로 캡처하지 않도록)
+    SetProcessDPIAware();
+    OutputDebugStringW(L"[Monitor] System DPI aware\n");
+}
+
+/**
+ * 모니터 DPI (모니터별 DPI를 모르면 시스템 DPI)
+ */
+static UINT GetMonitorDpi(HMONITOR monitor)
+{
+    LoadShcore();
+
+    UINT dpiX = 0;
+    UINT dpiY = 0;
+    if (g_getDpiForMonitor && SUCCEEDED(g_getDpiForMonitor(monitor, MDT_EFFECTIVE_DPI, &dpiX, &dpiY)) && dpiX > 0) {
+        return dpiX;
+    }
+
+    HDC hdc = GetDC(NULL);
+    int dpi = hdc ? GetDeviceCaps(hdc, LOGPIXELSX) : 0;
+    if (hdc) ReleaseDC(NULL, hdc);
+    return dpi > 0 ? (UINT)dpi : MONITOR_BASE_DPI;
+}
+
+/**
+ * 모니터 정보 채우기
+ */
+static bool GetInfo(HMONITOR monitor, MonitorInfo* info)
+{
+    if (!monitor || !info) return false;
+
+    MONITORINFOEXW mi = {0};
+    mi.cbSize = sizeof(mi);
+    if (!GetMonitorInfoW(monitor, (MONITORINFO*)&mi)) {
+        return false;
+    }
+
+    memset(info, 0, sizeof(MonitorInfo));
+    info->handle = monitor;
+    info->bounds = mi.rcMonitor;
+    info->dpi = GetMonitorDpi(monitor);
+    lstrcpynW(info->device, mi.szDevice, 32);
+
+    DEVMODEW mode = {0};
+    mode.dmSize = sizeof(mode);
+    if (EnumDisplaySettingsW(info->device, ENUM_CURRENT_SETTINGS, &mode) && mode.dmDisplayFrequency > 1) {
+        info->refreshRate = (int)mode.dmDisplayFrequency;
+    } else {
+        info->refreshRate = DEFAULT_REFRESH_HZ;
+    }
+    return true;
+}
+
+/**
+ * 점이 있는 모니터
+ */
+bool Monitor_FromPoint(POINT point, MonitorInfo* info)
+{
+    return GetInfo(MonitorFromPoint(point, MONITOR_DEFAULTTONEAREST), info);
+}
+
+/**
+ * 창이 가장 많이 걸친 모니터
+ */
+bool Monitor_FromWindow(HWND hwnd, MonitorInfo* info)
+{
+    return GetInfo(MonitorFromWindow(hwnd, MONITOR_DEFAULTTONEAREST), info);
+}
+
+/**
+ * 96 DPI 기준 크기를 모니터 DPI에 맞게 변환
+ */
+int Monitor_Scale(const MonitorInfo* info, int value)
+{
+    UINT dpi = info && info->dpi > 0 ? info->dpi : MONITOR_BASE_DPI;
+    return MulDiv(value, (int)dpi, MONITOR_BASE_DPI);
+}
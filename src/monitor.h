@@ -0,0 +1,46 @@
+/**
+ * monitor.h - 모니터 정보와 모니터별 DPI
+ *
+ * 좌표는 모두 가상 데스크톱 기준 물리 픽셀 (프로세스가 모니터별 DPI 인식일 때).
+ */
+
+#ifndef LETSZOOM_MONITOR_H
+#define LETSZOOM_MONITOR_H
+
+#include <windows.h>
+#include <stdbool.h>
+
+// 기준 DPI (100%)
+#define MONITOR_BASE_DPI 96
+
+// 모니터 정보
+typedef struct {
+    HMONITOR handle;
+    RECT bounds;            // 모니터 영역 (가상 데스크톱 좌표)
+    UINT dpi;               // 모니터 DPI (96 = 100%)
+    int refreshRate;        // 주사율 (Hz)
+    WCHAR device[32];       // 디스플레이 장치 이름
+} MonitorInfo;
+
+/**
+ * 모니터별 DPI 인식 설정 (창을 만들기 전에 한 번)
+ * Windows 10 1703+는 Per-Monitor V2, 8.1은 Per-Monitor, 그 이전은 시스템 DPI
+ */
+void Monitor_EnableDpiAwareness(void);
+
+/**
+ * 점이 있는 모니터 (없으면 가장 가까운 모니터)
+ */
+bool Monitor_FromPoint(POINT point, MonitorInfo* info);
+
+/**
+ * 창이 가장 많이 걸친 모니터
+ */
+bool Monitor_FromWindow(HWND hwnd, MonitorInfo* info);
+
+/**
+ * 96 DPI 기준 크기를 모니터 DPI에 맞게 변환
+ */
+int Monitor_Scale(const MonitorInfo* info, int value);
+
+#endif // LETSZOOM_MONITOR_H
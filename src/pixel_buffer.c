@@ -0,0 +1,131 @@
+/**
+ * pixel_buffer.c - 32비트 BGRA 픽셀 버퍼 구현
+ */
+
+#include "pixel_buffer.h"
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * 정렬된 메모리로 버퍼 할당
+ */
+bool PixelBuffer_Alloc(PixelBuffer* buffer, int width, int height)
+{
+    if (!buffer || width <= 0 || height <= 0) {
+        return false;
+    }
+
+    int stride = (width * 4 + PIXEL_BUFFER_ALIGN - 1) & ~(PIXEL_BUFFER_ALIGN - 1);
+    size_t size = (size_t)stride * (size_t)height;
+
+    // 정렬을 위해 여유분을 두고 할당
+    void* memory = malloc(size + PIXEL_BUFFER_ALIGN);
+    if (!memory) {
+        return false;
+    }
+
+    uintptr_t aligned = ((uintptr_t)memory + PIXEL_BUFFER_ALIGN - 1) & ~(uintptr_t)(PIXEL_BUFFER_ALIGN - 1);
+
+    buffer->pixels = (uint8_t*)aligned;
+    buffer->width = width;
+    buffer->height = height;
+    buffer->stride = stride;
+    buffer->memory = memory;
+    return true;
+}
+
+/**
+ * 버퍼 해제
+ */
+void PixelBuffer_Free(PixelBuffer* buffer)
+{
+    if (!buffer) return;
+
+    if (buffer->memory) {
+        free(buffer->memory);
+    }
+    memset(buffer, 0, sizeof(PixelBuffer));
+}
+
+/**
+ * 외부 메모리를 버퍼로 감싸기
+ */
+void PixelBuffer_Wrap(PixelBuffer* buffer, void* pixels, int width, int height, int stride)
+{
+    if (!buffer) return;
+
+    buffer->pixels = (uint8_t*)pixels;
+    buffer->width = width;
+    buffer->height = height;
+    buffer->stride = stride;
+    buffer->memory = NULL;
+}
+
+/**
+ * 버퍼의 일부 영역 뷰
+ */
+PixelBuffer PixelBuffer_SubView(const PixelBuffer* buffer, int x, int y, int width, int height)
+{
+    PixelBuffer view = {0};
+
+    // 버퍼 경계로 자르기
+    if (x < 0) { width += x; x = 0; }
+    if (y < 0) { height += y; y = 0; }
+    if (x + width > buffer->width) width = buffer->width - x;
+    if (y + height > buffer->height) height = buffer->height - y;
+    if (width <= 0 || height <= 0) {
+        return view;
+    }
+
+    view.pixels = buffer->pixels + (intptr_t)y * buffer->stride + (intptr_t)x * 4;
+    view.width = width;
+    view.height = height;
+    view.stride = buffer->stride;
+    view.memory = NULL;
+    return view;
+}
+
+/**
+ * 영역을 한 색상으로 채우기
+ */
+void PixelBuffer_Fill(const PixelBuffer* buffer, uint32_t color)
+{
+    for (int y = 0; y < buffer->height; y++) {
+        uint32_t* row = PixelBuffer_Row(buffer, y);
+        for (int x = 0; x < buffer->width; x++) {
+            row[x] = color;
+        }
+    }
+}
+
+/**
+ * 알파를 불투명으로
+ */
+void PixelBuffer_SetOpaque(const PixelBuffer* buffer)
+{
+    for (int y = 0; y < buffer->height; y++) {
+        uint32_t* row = PixelBuffer_Row(buffer, y);
+        for (int x = 0; x < buffer->width; x++) {
+            row[x] |= 0xFF000000u;
+        }
+    }
+}
+
+/**
+ * 잉크를 premultiplied 알파로
+ */
+void PixelBuffer_AlphaFromInk(const PixelBuffer* buffer)
+{
+    for (int y = 0; y < buffer->height; y++) {
+        uint32_t* row = PixelBuffer_Row(buffer, y);
+        for (int x = 0; x < buffer->width; x++) {
+            uint32_t p = row[x] & 0x00FFFFFFu;
+            uint32_t b = p & 0xFF;
+            uint32_t g = (p >> 8) & 0xFF;
+            uint32_t r = (p >> 16) & 0xFF;
+            uint32_t a = r > g ? r : g;
+            if (b > a) a = b;
+            row[x] = (a << 24) | p;
+        }
+    }
+}
@@ -0,0 +1,69 @@
+/**
+ * pixel_buffer.h - 32비트 BGRA 픽셀 버퍼
+ *
+ * 플랫폼 독립 코드 (windows.h 의존 없음, Linux에서도 빌드 가능)
+ */
+
+#ifndef LETSZOOM_PIXEL_BUFFER_H
+#define LETSZOOM_PIXEL_BUFFER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// 행 간격 정렬 단위 (바이트, AVX2 로드/저장용)
+#define PIXEL_BUFFER_ALIGN 64
+
+// 32비트 BGRA top-down 픽셀 버퍼 (GDI DIB 섹션과 같은 메모리 배치)
+typedef struct {
+    uint8_t* pixels;    // 첫 행의 시작 주소
+    int width;          // 너비 (픽셀)
+    int height;         // 높이 (픽셀)
+    int stride;         // 행 간격 (바이트)
+    void* memory;       // PixelBuffer_Alloc으로 할당한 원본 주소 (외부 메모리면 NULL)
+} PixelBuffer;
+
+/**
+ * 정렬된 메모리로 버퍼 할당
+ */
+bool PixelBuffer_Alloc(PixelBuffer* buffer, int width, int height);
+
+/**
+ * 버퍼 해제 (외부 메모리를 감싼 경우 비우기만 함)
+ */
+void PixelBuffer_Free(PixelBuffer* buffer);
+
+/**
+ * 외부 메모리(DIB 섹션 등)를 버퍼로 감싸기
+ */
+void PixelBuffer_Wrap(PixelBuffer* buffer, void* pixels, int width, int height, int stride);
+
+/**
+ * 버퍼의 일부 영역을 가리키는 뷰 (메모리 공유, 해제 불필요)
+ */
+PixelBuffer PixelBuffer_SubView(const PixelBuffer* buffer, int x, int y, int width, int height);
+
+/**
+ * 영역을 한 색상으로 채우기
+ */
+void PixelBuffer_Fill(const PixelBuffer* buffer, uint32_t color);
+
+/**
+ * 알파를 불투명(255)으로 (GDI 그리기가 지운 알파 복구)
+ */
+void PixelBuffer_SetOpaque(const PixelBuffer* buffer);
+
+/**
+ * 검은 바탕에 GDI로 그린 잉크를 premultiplied 알파로 변환 (알파 = RGB 최댓값)
+ * 흰색/원색 잉크는 안티앨리어싱된 가장자리까지 그대로 premultiplied 색이 된다.
+ */
+void PixelBuffer_AlphaFromInk(const PixelBuffer* buffer);
+
+/**
+ * 행 포인터
+ */
+static inline uint32_t* PixelBuffer_Row(const PixelBuffer* buffer, int y)
+{
+    return (uint32_t*)(buffer->pixels + (intptr_t)y * buffer->stride);
+}
+
+#endif // LETSZOOM_PIXEL_BUFFER_H
@@ -0,0 +1,215 @@
+/**
+ * residency.c - 오버레이 리소스 상주 관리 구현
+ *
+ * 유휴 해제는 스레드 타이머(SetTimer(NULL, ...))로 처리하므로 메시지 루프가 있는
+ * 창 스레드에서만 사용한다.
+ */
+
+#include "residency.h"
+#include "dib_buffer.h"
+#include "frame_pacer.h"
+#include <psapi.h>
+#include <stdio.h>
+
+// 동시에 관리하는 대상 수 (확대, 그리기)
+#define MAX_CLIENTS 4
+
+static int g_keepWarmMs = 60000;
+static ResidencyClient* g_clients[MAX_CLIENTS] = {0};
+
+/**
+ * 현재 작업 집합 (바이트)
+ */
+static size_t GetWorkingSet(void)
+{
+    PROCESS_MEMORY_COUNTERS counters = {0};
+    counters.cb = sizeof(counters);
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return 0;
+    }
+    return counters.WorkingSetSize;
+}
+
+/**
+ * 타이머 콜백에서 찾을 수 있게 등록
+ */
+static void Register(ResidencyClient* client)
+{
+    for (int i = 0; i < MAX_CLIENTS; i++) {
+        if (g_clients[i] == client) return;
+    }
+    for (int i = 0; i < MAX_CLIENTS; i++) {
+        if (!g_clients[i]) {
+            g_clients[i] = client;
+            return;
+        }
+    }
+}
+
+/**
+ * 유휴 해제 타이머 취소
+ */
+static void CancelTimer(ResidencyClient* client)
+{
+    if (client->timer) {
+        KillTimer(NULL, client->timer);
+        client->timer = 0;
+    }
+}
+
+/**
+ * 남겨 둔 리소스 해제 후 작업 집합 비우기
+ */
+static void Release(ResidencyClient* client)
+{
+    CancelTimer(client);
+
+    size_t before = GetWorkingSet();
+    if (client->release) {
+        client->release();
+    }
+
+    // 해제한 페이지와 확대 중에 건드린 코드/데이터를 작업 집합에서 내보냄
+    SetProcessWorkingSetSize(GetCurrentProcess(), (SIZE_T)-1, (SIZE_T)-1);
+
+    client->stats.releases++;
+    client->stats.idleWorkingSet = GetWorkingSet();
+
+    // 다른 오버레이가 남겨 둔 버퍼는 계속 살아 있을 수 있음
+    int dibCount = 0;
+    size_t dibBytes = 0;
+    DibBuffer_GetUsage(&dibCount, &dibBytes);
+
+    WCHAR msg[192];
+    swprintf_s(msg, 192, L"[Residency] %ls released: working set %llu KB -> %llu KB, %d DIB buffers (%llu KB) left\n",
+               client->name, (unsigned long long)before / 1024,
+               (unsigned long long)client->stats.idleWorkingSet / 1024,
+               dibCount, (unsigned long long)dibBytes / 1024);
+    OutputDebugStringW(msg);
+}
+
+/**
+ * 유휴 해제 타이머
+ */
+static VOID CALLBACK IdleTimerProc(HWND hwnd, UINT msg, UINT_PTR id, DWORD time)
+{
+    (void)hwnd;
+    (void)msg;
+    (void)time;
+
+    for (int i = 0; i < MAX_CLIENTS; i++) {
+        if (g_clients[i] && g_clients[i]->timer == id) {
+            Release(g_clients[i]);
+            return;
+        }
+    }
+
+    KillTimer(NULL, id);
+}
+
+/**
+ * 리소스 유지 시간 설정
+ */
+void Residency_SetKeepWarm(int milliseconds)
+{
+    if (milliseconds < 0) milliseconds = 0;
+    if (milliseconds > 600000) milliseconds = 600000;
+    g_keepWarmMs = milliseconds;
+}
+
+/**
+ * 활성화 시작
+ */
+void Residency_Activate(ResidencyClient* client, bool warm)
+{
+    if (!client) return;
+
+    Register(client);
+    CancelTimer(client);
+
+    client->warmStart = warm;
+    client->waitingFrame = true;
+    client->activateMs = FramePacer_Now();
+    client->stats.activations++;
+    if (warm) {
+        client->stats.warmActivations++;
+    }
+}
+
+/**
+ * 첫 프레임 표시
+ */
+void Residency_FrameShown(ResidencyClient* client)
+{
+    if (!client || !client->waitingFrame) return;
+
+    client->waitingFrame = false;
+    double latency = FramePacer_Now() - client->activateMs;
+    ResidencyStats* stats = &client->stats;
+    stats->lastLatencyMs = latency;
+
+    if (client->warmStart) {
+        stats->meanWarmMs += (latency - stats->meanWarmMs) / (double)stats->warmActivations;
+    } else {
+        unsigned long long cold = stats->activations - stats->warmActivations;
+        stats->meanColdMs += (latency - stats->meanColdMs) / (double)cold;
+    }
+
+    WCHAR msg[160];
+    swprintf_s(msg, 160, L"[Residency] %ls first frame %.1f ms (%ls)\n",
+               client->name, latency, client->warmStart ? L"warm" : L"cold");
+    OutputDebugStringW(msg);
+}
+
+/**
+ * 비활성화
+ */
+void Residency_Deactivate(ResidencyClient* client)
+{
+    if (!client) return;
+
+    Register(client);
+    client->waitingFrame = false;
+    client->stats.activeWorkingSet = GetWorkingSet();
+
+    if (g_keepWarmMs == 0) {
+        Release(client);
+        return;
+    }
+
+    CancelTimer(client);
+    client->timer = SetTimer(NULL, 0, (UINT)g_keepWarmMs, IdleTimerProc);
+    if (!client->timer) {
+        // 타이머를 만들 수 없으면 남겨 두지 않음
+        Release(client);
+    }
+}
+
+/**
+ * 즉시 해제
+ */
+void Residency_ReleaseNow(ResidencyClient* client)
+{
+    if (!client) return;
+
+    CancelTimer(client);
+    if (client->release) {
+        client->release();
+    }
+
+    for (int i = 0; i < MAX_CLIENTS; i++) {
+        if (g_clients[i] == client) {
+            g_clients[i] = NULL;
+        }
+    }
+}
+
+/**
+ * 통계 가져오기
+ */
+void Residency_GetStats(const ResidencyClient* client, ResidencyStats* stats)
+{
+    if (client && stats) {
+        *stats = client->stats;
+    }
+}
@@ -0,0 +1,73 @@
+/**
+ * residency.h - 오버레이 리소스 상주 관리
+ *
+ * 오버레이를 닫아도 창과 버퍼를 설정한 시간 동안 숨긴 채 남겨 두어
+ * 다음 단축키에서 바로 첫 프레임을 띄우고, 그 시간 동안 다시 쓰지 않으면
+ * 해제한 뒤 작업 집합을 비운다. 활성화 → 첫 프레임 지연과 유휴 작업 집합을 측정한다.
+ */
+
+#ifndef LETSZOOM_RESIDENCY_H
+#define LETSZOOM_RESIDENCY_H
+
+#include <windows.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// 상주 통계
+typedef struct {
+    unsigned long long activations;     // 활성화 횟수
+    unsigned long long warmActivations; // 남겨 둔 리소스를 재사용한 활성화
+    unsigned long long releases;        // 유휴 해제 횟수
+    double lastLatencyMs;               // 마지막 활성화 → 첫 프레임 (밀리초)
+    double meanWarmMs;                  // 평균 지연 (재사용)
+    double meanColdMs;                  // 평균 지연 (새로 생성)
+    size_t activeWorkingSet;            // 마지막으로 닫을 때 작업 집합 (바이트)
+    size_t idleWorkingSet;              // 마지막 유휴 해제 후 작업 집합 (바이트)
+} ResidencyStats;
+
+// 남겨 둔 리소스 해제 함수 (창 스레드에서 호출)
+typedef void (*ResidencyReleaseFunc)(void);
+
+// 상주 관리 대상 (오버레이마다 하나, 정적 변수로 두고 0으로 초기화)
+typedef struct {
+    const WCHAR* name;                  // 로그용 이름
+    ResidencyReleaseFunc release;
+    UINT_PTR timer;                     // 유휴 해제 타이머 (0이면 없음)
+    bool warmStart;                     // 이번 활성화가 재사용인지
+    bool waitingFrame;                  // 첫 프레임 대기 중
+    double activateMs;                  // 활성화 시각
+    ResidencyStats stats;
+} ResidencyClient;
+
+/**
+ * 사용 후 리소스를 남겨 둘 시간 설정 (밀리초, 0이면 닫을 때 바로 해제)
+ */
+void Residency_SetKeepWarm(int milliseconds);
+
+/**
+ * 활성화 시작 (유휴 해제 취소, 첫 프레임 지연 측정 시작)
+ * warm: 남겨 둔 리소스를 재사용하는지
+ */
+void Residency_Activate(ResidencyClient* client, bool warm);
+
+/**
+ * 첫 프레임 표시 (활성화 후 처음 한 번만 기록, 매 프레임 불러도 됨)
+ */
+void Residency_FrameShown(ResidencyClient* client);
+
+/**
+ * 비활성화 (리소스는 남겨 두고 유지 시간 뒤 해제, 유지 시간이 0이면 바로 해제)
+ */
+void Residency_Deactivate(ResidencyClient* client);
+
+/**
+ * 남겨 둔 리소스 즉시 해제 (종료 시)
+ */
+void Residency_ReleaseNow(ResidencyClient* client);
+
+/**
+ * 통계 가져오기
+ */
+void Residency_GetStats(const ResidencyClient* client, ResidencyStats* stats);
+
+#endif // LETSZOOM_RESIDENCY_H
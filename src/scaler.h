@@ -0,0 +1,128 @@
+/**
+ * scaler.h - 소프트웨어 확대 엔진 (StretchBlt 대체)
+ *
+ * 32비트 BGRA 버퍼를 SSE2/AVX2 커널로 확대한다.
+ * 플랫폼 독립 코드 (windows.h 의존 없음, Linux에서도 빌드 가능)
+ */
+
+#ifndef LETSZOOM_SCALER_H
+#define LETSZOOM_SCALER_H
+
+#include <stdbool.h>
+#include "pixel_buffer.h"
+#include "worker_pool.h"
+
+// 보간 필터
+typedef enum {
+    SCALE_FILTER_NEAREST = 0,    // 최근접 (COLORONCOLOR 대응)
+    SCALE_FILTER_BILINEAR,       // 쌍선형 (HALFTONE 대응)
+    SCALE_FILTER_BICUBIC,        // 쌍삼차 (Catmull-Rom)
+    SCALE_FILTER_LANCZOS3        // Lanczos-3 (6탭, 글자 윤곽이 가장 선명)
+} ScaleFilter;
+
+// 색 필터 (확대하면서 소스 픽셀에 적용, 접근성/저대비 프로젝터용)
+typedef enum {
+    COLOR_FILTER_NONE = 0,
+    COLOR_FILTER_INVERT,         // 색 반전
+    COLOR_FILTER_GRAYSCALE,      // 회색조 (Rec.709 휘도)
+    COLOR_FILTER_HIGH_CONTRAST,  // 대비 강조 (중간 회색 기준으로 늘림)
+    COLOR_FILTER_DEUTERANOPIA    // 적록 색약 보정 (녹색약 시뮬레이션 오차를 구별되는 채널로 옮김)
+} ColorFilter;
+
+// 명령어 집합
+typedef enum {
+    SCALER_ISA_SCALAR = 0,
+    SCALER_ISA_SSE2,
+    SCALER_ISA_AVX2
+} ScalerIsa;
+
+// 확대 매개변수
+typedef struct {
+    // 소스 버퍼 안에서 확대할 영역 (서브픽셀 좌표)
+    float srcX;
+    float srcY;
+    float srcWidth;
+    float srcHeight;
+
+    // 소스 영역이 매핑되는 전체 출력 크기
+    int outputWidth;
+    int outputHeight;
+
+    // dst 버퍼 (0,0)에 해당하는 출력 좌표 (밴드/타일 단위 렌더링용)
+    int dstOffsetX;
+    int dstOffsetY;
+
+    ScaleFilter filter;
+    ColorFilter color;
+    bool linearLight;   // 선형 광량에서 보간 (sRGB 값을 그대로 섞지 않음, 최근접은 해당 없음)
+} ScaleParams;
+
+// 밴드 하나의 최소 출력 행 수 (이보다 작으면 밴드를 줄임)
+#define SCALER_MIN_BAND_ROWS 32
+
+// 밴드 하나의 최소 출력 픽셀 수 (스레드를 깨우는 비용보다 일이 많도록)
+#define SCALER_MIN_BAND_PIXELS 32768
+
+// 마지막 밴드 병렬 렌더링의 시간
+typedef struct {
+    int bands;                                      // 밴드 수 (0이면 아직 병렬로 처리한 적 없음)
+    double bandMs[WORKER_POOL_MAX_THREADS];         // 밴드별 확대 시간
+    double wallMs;                                  // 전체 시간 (가장 느린 밴드 + 분배/대기)
+} ScalerBandStats;
+
+// 확대 엔진 (가중치 테이블과 작업 버퍼 보관)
+typedef struct Scaler Scaler;
+
+/**
+ * 확대 엔진 생성 (CPU가 지원하는 가장 빠른 명령어 집합 선택)
+ */
+Scaler* Scaler_Create(void);
+
+/**
+ * 확대 엔진 파괴
+ */
+void Scaler_Destroy(Scaler* scaler);
+
+/**
+ * 명령어 집합 강제 지정 (지원하지 않으면 가능한 최선으로 낮춤)
+ */
+void Scaler_SetIsa(Scaler* scaler, ScalerIsa isa);
+
+/**
+ * 현재 사용 중인 명령어 집합
+ */
+ScalerIsa Scaler_GetIsa(const Scaler* scaler);
+
+/**
+ * CPU가 지원하는 가장 빠른 명령어 집합
+ */
+ScalerIsa Scaler_DetectIsa(void);
+
+/**
+ * 작업 스레드 풀 지정 (NULL이면 호출 스레드 하나로 확대)
+ * 출력을 가로 밴드로 나눠 밴드마다 따로 확대하므로 결과는 한 스레드와 비트 단위로 같다.
+ * 풀은 호출자가 소유하며, 여러 확대 엔진이 동시에 Render하지 않으면 함께 써도 된다.
+ */
+void Scaler_SetWorkers(Scaler* scaler, WorkerPool* pool);
+
+/**
+ * 마지막 밴드 병렬 렌더링의 밴드별 시간
+ */
+void Scaler_GetBandStats(const Scaler* scaler, ScalerBandStats* stats);
+
+/**
+ * 색 필터 행렬 (행: 출력 R, G, B / 열: 입력 R, G, B와 더할 값, 값은 0~1 기준)
+ * 확대 엔진이 쓰는 고정소수점 행렬의 원본 (다른 확대 방식에 같은 필터를 걸 때 사용)
+ */
+void Scaler_GetColorMatrix(ColorFilter color, float matrix[3][4]);
+
+/**
+ * 확대 렌더링
+ * src의 소스 영역을 출력 크기로 확대하여 dst에 쓴다.
+ * dst는 출력의 (dstOffsetX, dstOffsetY)부터 dst 크기만큼의 영역을 받는다.
+ * 색 필터는 소스 행을 읽을 때 행 단위로 적용하므로 출력을 다시 훑지 않는다.
+ * 모든 명령어 집합에서 결과가 비트 단위로 같다.
+ */
+bool Scaler_Render(Scaler* scaler, const PixelBuffer* src, const PixelBuffer* dst, const ScaleParams* params);
+
+#endif // LETSZOOM_SCALER_H
@@ -0,0 +1,462 @@
+/**
+ * scaler_avx2.c - 확대 엔진 AVX2 커널
+ *
+ * 스칼라 커널(scaler.c)과 같은 고정소수점 연산을 16개 채널씩 처리한다.
+ * AVX2 명령은 128비트 레인 단위로 동작하므로 pack 후 레인 순서를 바로잡는다.
+ */
+
+#include "scaler_kernels.h"
+
+#if SCALER_HAVE_X86
+
+#include <immintrin.h>
+
+#define AVX2_TARGET __attribute__((target("avx2")))
+
+// 가중치 쌍 읽기용 (int16 배열을 int32로 읽어도 안전하도록)
+typedef int32_t __attribute__((may_alias)) WeightPairWord;
+
+/**
+ * 탭 가중치 두 개를 madd용 (w0, w1) 쌍으로 묶기
+ */
+static inline int32_t WeightPair(int16_t w0, int16_t w1)
+{
+    return (int32_t)(((uint32_t)(uint16_t)w1 << 16) | (uint16_t)w0);
+}
+
+/**
+ * 출력 픽셀 두 개의 수평 누적 (레인 0: 픽셀 a, 레인 1: 픽셀 b)
+ * wa/wb: 픽셀별 (w0, w1) 가중치 쌍 배열
+ */
+AVX2_TARGET static inline __attribute__((always_inline))
+__m256i HorizontalPairAvx2(const uint32_t* pa, const WeightPairWord* wa,
+                           const uint32_t* pb, const WeightPairWord* wb, int taps)
+{
+    // 픽셀 두 개를 [b0 b1 g0 g1 r0 r1 a0 a1]로 섞는 마스크
+    const __m128i interleave = _mm_setr_epi8(0, 4, 1, 5, 2, 6, 3, 7, 8, 12, 9, 13, 10, 14, 11, 15);
+    __m256i acc = _mm256_set1_epi32(1 << (HORZ_SHIFT - 1));
+
+    for (int k = 0; k < taps; k += 2) {
+        __m128i ab = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i*)(pa + k)),
+                                        _mm_loadl_epi64((const __m128i*)(pb + k)));
+        __m256i px = _mm256_cvtepu8_epi16(_mm_shuffle_epi8(ab, interleave));
+        __m256i w = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_set1_epi32(wa[k / 2])),
+                                            _mm_set1_epi32(wb[k / 2]), 1);
+        acc = _mm256_add_epi32(acc, _mm256_madd_epi16(px, w));
+    }
+
+    return _mm256_srai_epi32(acc, HORZ_SHIFT);
+}
+
+/**
+ * 수평 패스 본체 (taps가 상수로 주어지면 탭 루프가 펼쳐짐)
+ */
+AVX2_TARGET static inline __attribute__((always_inline))
+int HorizontalRowAvx2(const uint32_t* srcRow, int16_t* out, int count,
+                      const int32_t* starts, const int16_t* weights, int taps)
+{
+    const WeightPairWord* pairs = (const WeightPairWord*)weights;
+    int half = taps / 2;
+    int i = 0;
+
+    // 출력 픽셀 4개씩
+    for (; i + 3 < count; i += 4) {
+        __m256i a = HorizontalPairAvx2(srcRow + starts[i], pairs + i * half,
+                                       srcRow + starts[i + 1], pairs + (i + 1) * half, taps);
+        __m256i b = HorizontalPairAvx2(srcRow + starts[i + 2], pairs + (i + 2) * half,
+                                       srcRow + starts[i + 3], pairs + (i + 3) * half, taps);
+        // packs 결과 [0 2 1 3] → [0 1 2 3]
+        __m256i packed = _mm256_permute4x64_epi64(_mm256_packs_epi32(a, b), 0xD8);
+        _mm256_storeu_si256((__m256i*)(out + i * 4), packed);
+    }
+
+    return i;
+}
+
+/**
+ * 수평 패스 (AVX2, 탭 수는 짝수)
+ */
+AVX2_TARGET void Scaler_HorizontalAvx2(const uint32_t* srcRow, int16_t* out, int count,
+                                       const int32_t* starts, const int16_t* weights, int taps)
+{
+    int i;
+
+    switch (taps) {
+        case 2:  i = HorizontalRowAvx2(srcRow, out, count, starts, weights, 2); break;
+        case 4:  i = HorizontalRowAvx2(srcRow, out, count, starts, weights, 4); break;
+        case 6:  i = HorizontalRowAvx2(srcRow, out, count, starts, weights, 6); break;
+        default: i = HorizontalRowAvx2(srcRow, out, count, starts, weights, taps); break;
+    }
+
+    if (i < count) {
+        Scaler_HorizontalSse2(srcRow, out + i * 4, count - i, starts + i, &weights[i * taps], taps);
+    }
+}
+
+/**
+ * 중간 행 16개 채널의 수직 누적 → int16 16개 (레인 순서 유지)
+ * rows/w: 탭 두 개씩 묶은 행 포인터와 가중치 쌍
+ */
+AVX2_TARGET static inline __attribute__((always_inline))
+__m256i VerticalBlockAvx2(const int16_t* const* rows, const __m256i* w, int taps, int i)
+{
+    __m256i lo = _mm256_set1_epi32(1 << (VERT_SHIFT - 1));
+    __m256i hi = lo;
+
+    for (int k = 0; k < taps; k += 2) {
+        __m256i r0 = _mm256_loadu_si256((const __m256i*)(rows[k] + i));
+        __m256i r1 = _mm256_loadu_si256((const __m256i*)(rows[k + 1] + i));
+        lo = _mm256_add_epi32(lo, _mm256_madd_epi16(_mm256_unpacklo_epi16(r0, r1), w[k / 2]));
+        hi = _mm256_add_epi32(hi, _mm256_madd_epi16(_mm256_unpackhi_epi16(r0, r1), w[k / 2]));
+    }
+
+    lo = _mm256_srai_epi32(lo, VERT_SHIFT);
+    hi = _mm256_srai_epi32(hi, VERT_SHIFT);
+    return _mm256_packs_epi32(lo, hi);
+}
+
+/**
+ * 수직 패스 본체 (taps가 상수로 주어지면 탭 루프가 펼쳐짐)
+ */
+AVX2_TARGET static inline __attribute__((always_inline))
+int VerticalRowAvx2(const int16_t* const* rows, const __m256i* w, int taps, uint8_t* dst, int n)
+{
+    int i = 0;
+
+    // 픽셀 8개씩
+    for (; i + 32 <= n; i += 32) {
+        __m256i a = VerticalBlockAvx2(rows, w, taps, i);
+        __m256i b = VerticalBlockAvx2(rows, w, taps, i + 16);
+        // packus 결과 [a0 b0 a1 b1] → [a0 a1 b0 b1]
+        __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(a, b), 0xD8);
+        _mm256_storeu_si256((__m256i*)(dst + i), packed);
+    }
+
+    return i;
+}
+
+/**
+ * 수직 패스 (AVX2)
+ */
+AVX2_TARGET void Scaler_VerticalAvx2(const int16_t* const* rows, const int16_t* weights, int taps,
+                                     uint32_t* out, int count)
+{
+    uint8_t* dst = (uint8_t*)out;
+    int n = count * 4;
+
+    // 홀수 탭은 마지막 행을 가중치 0으로 한 번 더 짝지음
+    const int16_t* paired[SCALER_MAX_TAPS + 1];
+    __m256i w[(SCALER_MAX_TAPS + 1) / 2];
+    int evenTaps = (taps + 1) & ~1;
+    for (int k = 0; k < evenTaps; k += 2) {
+        int16_t w1 = (k + 1 < taps) ? weights[k + 1] : 0;
+        paired[k] = rows[k];
+        paired[k + 1] = (k + 1 < taps) ? rows[k + 1] : rows[k];
+        w[k / 2] = _mm256_set1_epi32(WeightPair(weights[k], w1));
+    }
+
+    int i;
+    switch (evenTaps) {
+        case 2:  i = VerticalRowAvx2(paired, w, 2, dst, n); break;
+        case 4:  i = VerticalRowAvx2(paired, w, 4, dst, n); break;
+        case 6:  i = VerticalRowAvx2(paired, w, 6, dst, n); break;
+        default: i = VerticalRowAvx2(paired, w, evenTaps, dst, n); break;
+    }
+
+    // 남은 픽셀은 SSE2 커널로
+    if (i < n) {
+        const int16_t* tail[SCALER_MAX_TAPS];
+        for (int k = 0; k < taps; k++) {
+            tail[k] = rows[k] + i;
+        }
+        Scaler_VerticalSse2(tail, weights, taps, (uint32_t*)(dst + i), (n - i) / 4);
+    }
+}
+
+/**
+ * 정수 배율 최근접 행 (AVX2)
+ * 배율 2-4는 소스 8픽셀을 레인 교차 순열로 펼치고, 5 이상은 픽셀을 채운 레지스터를 배율만큼 이어 저장한다.
+ */
+AVX2_TARGET void Scaler_ReplicateAvx2(const uint32_t* src, uint32_t* out, int count, int factor, int phase)
+{
+    int x = 0;
+
+    // 앞 소스 픽셀의 남은 반복
+    if (phase > 0) {
+        int run = factor - phase < count ? factor - phase : count;
+        for (; x < run; x++) {
+            out[x] = *src;
+        }
+        src++;
+    }
+
+    if (factor >= 2 && factor <= 4) {
+        // 출력 8픽셀 묶음 k의 순열: 소스 픽셀 (k * 8 + j) / factor
+        __m256i index[4];
+        for (int k = 0; k < factor; k++) {
+            index[k] = _mm256_setr_epi32((k * 8 + 0) / factor, (k * 8 + 1) / factor,
+                                         (k * 8 + 2) / factor, (k * 8 + 3) / factor,
+                                         (k * 8 + 4) / factor, (k * 8 + 5) / factor,
+                                         (k * 8 + 6) / factor, (k * 8 + 7) / factor);
+        }
+
+        int block = factor * 8;
+        for (; x + block <= count; x += block, src += 8) {
+            __m256i v = _mm256_loadu_si256((const __m256i*)src);
+            for (int k = 0; k < factor; k++) {
+                _mm256_storeu_si256((__m256i*)(out + x + k * 8), _mm256_permutevar8x32_epi32(v, index[k]));
+            }
+        }
+    } else if (factor > 4) {
+        // 마지막 저장이 다음 픽셀 자리까지 넘칠 수 있으나 다음 픽셀이 덮어씀
+        int span = (factor + 7) & ~7;
+        for (; x + span <= count; x += factor, src++) {
+            __m256i v = _mm256_set1_epi32((int)*src);
+            for (int k = 0; k < factor; k += 8) {
+                _mm256_storeu_si256((__m256i*)(out + x + k), v);
+            }
+        }
+    }
+
+    Scaler_ReplicateSse2(src, out + x, count - x, factor, 0);
+}
+
+/**
+ * 색 필터 출력 채널 하나 (채널 평면 b/g/r: 값 << 7, w: 계수 세 개와 더할 값)
+ */
+AVX2_TARGET static inline __attribute__((always_inline))
+__m256i ColorChannelAvx2(__m256i b, __m256i g, __m256i r, const __m256i* w)
+{
+    __m256i sum = _mm256_add_epi16(_mm256_mulhi_epi16(b, w[0]), _mm256_mulhi_epi16(g, w[1]));
+    sum = _mm256_add_epi16(sum, _mm256_mulhi_epi16(r, w[2]));
+    return _mm256_srai_epi16(_mm256_add_epi16(sum, w[3]), COLOR_SUM_BITS);
+}
+
+/**
+ * 색 필터 행 (AVX2, 픽셀 16개씩)
+ * 평면은 레인마다 [앞 4픽셀, 뒤 4픽셀] 순서가 되지만 다시 섞을 때 같은 순서로 풀리므로 바로잡지 않는다.
+ */
+AVX2_TARGET void Scaler_ColorAvx2(const uint32_t* src, uint32_t* out, int count, const ColorMatrix* matrix)
+{
+    const __m256i mask = _mm256_set1_epi32(0xFF << 7);
+    __m256i w[3][4];
+    for (int c = 0; c < 3; c++) {
+        for (int k = 0; k < 3; k++) {
+            w[c][k] = _mm256_set1_epi16(matrix->m[c][k]);
+        }
+        w[c][3] = _mm256_set1_epi16(matrix->offset[c]);
+    }
+
+    int i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m256i v0 = _mm256_loadu_si256((const __m256i*)(src + i));
+        __m256i v1 = _mm256_loadu_si256((const __m256i*)(src + i + 8));
+
+        __m256i b = _mm256_packs_epi32(_mm256_and_si256(_mm256_slli_epi32(v0, 7), mask),
+                                       _mm256_and_si256(_mm256_slli_epi32(v1, 7), mask));
+        __m256i g = _mm256_packs_epi32(_mm256_and_si256(_mm256_srli_epi32(v0, 1), mask),
+                                       _mm256_and_si256(_mm256_srli_epi32(v1, 1), mask));
+        __m256i r = _mm256_packs_epi32(_mm256_and_si256(_mm256_srli_epi32(v0, 9), mask),
+                                       _mm256_and_si256(_mm256_srli_epi32(v1, 9), mask));
+        __m256i a = _mm256_packs_epi32(_mm256_srli_epi32(v0, 24), _mm256_srli_epi32(v1, 24));
+
+        __m256i ob = ColorChannelAvx2(b, g, r, w[0]);
+        __m256i og = ColorChannelAvx2(b, g, r, w[1]);
+        __m256i or = ColorChannelAvx2(b, g, r, w[2]);
+
+        __m256i br = _mm256_packus_epi16(ob, or);
+        __m256i ga = _mm256_packus_epi16(og, a);
+        __m256i bg = _mm256_unpacklo_epi8(br, ga);
+        __m256i ra = _mm256_unpackhi_epi8(br, ga);
+        _mm256_storeu_si256((__m256i*)(out + i), _mm256_unpacklo_epi16(bg, ra));
+        _mm256_storeu_si256((__m256i*)(out + i + 8), _mm256_unpackhi_epi16(bg, ra));
+    }
+
+    Scaler_ColorSse2(src + i, out + i, count - i, matrix);
+}
+
+/**
+ * sRGB 행 → 선형 행 (AVX2, 채널 8개씩 표에서 모아 읽기)
+ */
+AVX2_TARGET void Scaler_ToLinearAvx2(const uint32_t* src, int16_t* out, int count, const int32_t* toLinear)
+{
+    const uint8_t* bytes = (const uint8_t*)src;
+    int i = 0;
+
+    // 픽셀마다 4번째 채널(알파)은 표의 알파 구간
+    const __m256i alpha = _mm256_setr_epi32(0, 0, 0, TO_LINEAR_ALPHA, 0, 0, 0, TO_LINEAR_ALPHA);
+
+    // 픽셀 4개 (채널 16개)씩
+    for (; i + 4 <= count; i += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(bytes + i * 4));
+        __m256i lo = _mm256_add_epi32(_mm256_cvtepu8_epi32(v), alpha);
+        __m256i hi = _mm256_add_epi32(_mm256_cvtepu8_epi32(_mm_srli_si128(v, 8)), alpha);
+        lo = _mm256_i32gather_epi32((const int*)toLinear, lo, 4);
+        hi = _mm256_i32gather_epi32((const int*)toLinear, hi, 4);
+        // packs 결과 [lo0 hi0 lo1 hi1] → [lo0 lo1 hi0 hi1]
+        __m256i packed = _mm256_permute4x64_epi64(_mm256_packs_epi32(lo, hi), 0xD8);
+        _mm256_storeu_si256((__m256i*)(out + i * 4), packed);
+    }
+
+    Scaler_ToLinearScalar(src + i, out + i * 4, count - i, toLinear);
+}
+
+/**
+ * 선형 행 출력 픽셀 두 개의 수평 누적 (레인 0: 픽셀 a, 레인 1: 픽셀 b)
+ */
+AVX2_TARGET static inline __attribute__((always_inline))
+__m256i HorizontalLinearPairAvx2(const int16_t* pa, const WeightPairWord* wa,
+                                 const int16_t* pb, const WeightPairWord* wb, int taps)
+{
+    // 연속한 픽셀 두 개 [b0 g0 r0 a0 b1 g1 r1 a1]를 [b0 b1 g0 g1 r0 r1 a0 a1]로 섞는 마스크
+    const __m256i interleave = _mm256_setr_epi8(0, 1, 8, 9, 2, 3, 10, 11, 4, 5, 12, 13, 6, 7, 14, 15,
+                                                0, 1, 8, 9, 2, 3, 10, 11, 4, 5, 12, 13, 6, 7, 14, 15);
+    __m256i acc = _mm256_set1_epi32(1 << (LINEAR_HORZ_SHIFT - 1));
+
+    for (int k = 0; k < taps; k += 2) {
+        __m256i px = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)(pa + k * 4))),
+                                             _mm_loadu_si128((const __m128i*)(pb + k * 4)), 1);
+        __m256i w = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_set1_epi32(wa[k / 2])),
+                                            _mm_set1_epi32(wb[k / 2]), 1);
+        acc = _mm256_add_epi32(acc, _mm256_madd_epi16(_mm256_shuffle_epi8(px, interleave), w));
+    }
+
+    return _mm256_srai_epi32(acc, LINEAR_HORZ_SHIFT);
+}
+
+/**
+ * 선형 수평 패스 본체 (taps가 상수로 주어지면 탭 루프가 펼쳐짐)
+ */
+AVX2_TARGET static inline __attribute__((always_inline))
+int HorizontalLinearRowAvx2(const int16_t* srcRow, int16_t* out, int count,
+                            const int32_t* starts, const int16_t* weights, int taps)
+{
+    const WeightPairWord* pairs = (const WeightPairWord*)weights;
+    int half = taps / 2;
+    int i = 0;
+
+    for (; i + 3 < count; i += 4) {
+        __m256i a = HorizontalLinearPairAvx2(srcRow + starts[i] * 4, pairs + i * half,
+                                             srcRow + starts[i + 1] * 4, pairs + (i + 1) * half, taps);
+        __m256i b = HorizontalLinearPairAvx2(srcRow + starts[i + 2] * 4, pairs + (i + 2) * half,
+                                             srcRow + starts[i + 3] * 4, pairs + (i + 3) * half, taps);
+        __m256i packed = _mm256_permute4x64_epi64(_mm256_packs_epi32(a, b), 0xD8);
+        _mm256_storeu_si256((__m256i*)(out + i * 4), packed);
+    }
+
+    return i;
+}
+
+/**
+ * 선형 수평 패스 (AVX2, 탭 수는 짝수)
+ */
+AVX2_TARGET void Scaler_HorizontalLinearAvx2(const int16_t* srcRow, int16_t* out, int count,
+                                             const int32_t* starts, const int16_t* weights, int taps)
+{
+    int i;
+
+    switch (taps) {
+        case 2:  i = HorizontalLinearRowAvx2(srcRow, out, count, starts, weights, 2); break;
+        case 4:  i = HorizontalLinearRowAvx2(srcRow, out, count, starts, weights, 4); break;
+        case 6:  i = HorizontalLinearRowAvx2(srcRow, out, count, starts, weights, 6); break;
+        default: i = HorizontalLinearRowAvx2(srcRow, out, count, starts, weights, taps); break;
+    }
+
+    if (i < count) {
+        Scaler_HorizontalLinearSse2(srcRow, out + i * 4, count - i, starts + i, &weights[i * taps], taps);
+    }
+}
+
+/**
+ * 중간 행 8개 채널의 선형 수직 누적 → 자르고 sRGB 표에서 모아 읽은 int32 8개
+ */
+AVX2_TARGET static inline __attribute__((always_inline))
+__m256i VerticalLinearHalfAvx2(__m256i acc, const uint8_t* toSrgb)
+{
+    acc = _mm256_srai_epi32(acc, LINEAR_VERT_SHIFT);
+    acc = _mm256_min_epi32(_mm256_max_epi32(acc, _mm256_setzero_si256()), _mm256_set1_epi32(LINEAR_MAX));
+
+    // 픽셀마다 4번째 채널(알파)은 표의 알파 구간, 바이트 표를 4바이트씩 읽고 첫 바이트만 남김
+    acc = _mm256_add_epi32(acc, _mm256_setr_epi32(0, 0, 0, TO_SRGB_ALPHA, 0, 0, 0, TO_SRGB_ALPHA));
+    __m256i srgb = _mm256_i32gather_epi32((const int*)toSrgb, acc, 1);
+    return _mm256_and_si256(srgb, _mm256_set1_epi32(0xFF));
+}
+
+/**
+ * 중간 행 16개 채널의 선형 수직 누적 → sRGB int16 16개 (레인 순서 유지)
+ */
+AVX2_TARGET static inline __attribute__((always_inline))
+__m256i VerticalLinearBlockAvx2(const int16_t* const* rows, const __m256i* w, int taps, int i,
+                                const uint8_t* toSrgb)
+{
+    __m256i lo = _mm256_set1_epi32(1 << (LINEAR_VERT_SHIFT - 1));
+    __m256i hi = lo;
+
+    for (int k = 0; k < taps; k += 2) {
+        __m256i r0 = _mm256_loadu_si256((const __m256i*)(rows[k] + i));
+        __m256i r1 = _mm256_loadu_si256((const __m256i*)(rows[k + 1] + i));
+        lo = _mm256_add_epi32(lo, _mm256_madd_epi16(_mm256_unpacklo_epi16(r0, r1), w[k / 2]));
+        hi = _mm256_add_epi32(hi, _mm256_madd_epi16(_mm256_unpackhi_epi16(r0, r1), w[k / 2]));
+    }
+
+    return _mm256_packs_epi32(VerticalLinearHalfAvx2(lo, toSrgb), VerticalLinearHalfAvx2(hi, toSrgb));
+}
+
+/**
+ * 선형 수직 패스 본체 (taps가 상수로 주어지면 탭 루프가 펼쳐짐)
+ */
+AVX2_TARGET static inline __attribute__((always_inline))
+int VerticalLinearRowAvx2(const int16_t* const* rows, const __m256i* w, int taps, uint8_t* dst, int n,
+                          const uint8_t* toSrgb)
+{
+    int i = 0;
+
+    // 픽셀 8개씩
+    for (; i + 32 <= n; i += 32) {
+        __m256i a = VerticalLinearBlockAvx2(rows, w, taps, i, toSrgb);
+        __m256i b = VerticalLinearBlockAvx2(rows, w, taps, i + 16, toSrgb);
+        __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(a, b), 0xD8);
+        _mm256_storeu_si256((__m256i*)(dst + i), packed);
+    }
+
+    return i;
+}
+
+/**
+ * 선형 수직 패스 (AVX2)
+ */
+AVX2_TARGET void Scaler_VerticalLinearAvx2(const int16_t* const* rows, const int16_t* weights, int taps,
+                                           uint32_t* out, int count, const uint8_t* toSrgb)
+{
+    uint8_t* dst = (uint8_t*)out;
+    int n = count * 4;
+
+    const int16_t* paired[SCALER_MAX_TAPS + 1];
+    __m256i w[(SCALER_MAX_TAPS + 1) / 2];
+    int evenTaps = (taps + 1) & ~1;
+    for (int k = 0; k < evenTaps; k += 2) {
+        int16_t w1 = (k + 1 < taps) ? weights[k + 1] : 0;
+        paired[k] = rows[k];
+        paired[k + 1] = (k + 1 < taps) ? rows[k + 1] : rows[k];
+        w[k / 2] = _mm256_set1_epi32(WeightPair(weights[k], w1));
+    }
+
+    int i;
+    switch (evenTaps) {
+        case 2:  i = VerticalLinearRowAvx2(paired, w, 2, dst, n, toSrgb); break;
+        case 4:  i = VerticalLinearRowAvx2(paired, w, 4, dst, n, toSrgb); break;
+        case 6:  i = VerticalLinearRowAvx2(paired, w, 6, dst, n, toSrgb); break;
+        default: i = VerticalLinearRowAvx2(paired, w, evenTaps, dst, n, toSrgb); break;
+    }
+
+    // 남은 픽셀은 SSE2 커널로
+    if (i < n) {
+        const int16_t* tail[SCALER_MAX_TAPS];
+        for (int k = 0; k < taps; k++) {
+            tail[k] = rows[k] + i;
+        }
+        Scaler_VerticalLinearSse2(tail, weights, taps, (uint32_t*)(dst + i), (n - i) / 4, toSrgb);
+    }
+}
+
+#endif // SCALER_HAVE_X86
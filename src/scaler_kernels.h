@@ -0,0 +1,141 @@
+/**
+ * scaler_kernels.h - 확대 엔진 내부 커널 (scaler.c 전용)
+ *
+ * 분리형 필터를 고정소수점 정수 연산으로 처리한다.
+ * 스칼라/SSE2/AVX2 커널은 같은 연산 순서를 따르므로 결과가 비트 단위로 같다.
+ */
+
+#ifndef LETSZOOM_SCALER_KERNELS_H
+#define LETSZOOM_SCALER_KERNELS_H
+
+#include <stdint.h>
+
+// 가중치 정밀도 (가중치 합 = 1 << FILTER_BITS)
+#define FILTER_BITS 14
+
+// 필터별 최대 탭 수
+#define SCALER_MAX_TAPS 6
+
+// 중간 결과 정밀도 (수평 패스 출력 = 픽셀값 << INTER_BITS)
+#define INTER_BITS 6
+
+// 수평/수직 패스 반올림 시프트
+#define HORZ_SHIFT (FILTER_BITS - INTER_BITS)
+#define VERT_SHIFT (FILTER_BITS + INTER_BITS)
+
+// 선형 광량 정밀도 (sRGB 8비트 → 선형 12비트, 어두운 단계가 뭉개지지 않도록)
+#define LINEAR_BITS 12
+#define LINEAR_MAX ((1 << LINEAR_BITS) - 1)
+
+// 선형 중간 결과 정밀도 (수평 패스 출력 = 선형 값 << LINEAR_INTER_BITS, 8비트 경로의 중간 행과 같은 범위)
+#define LINEAR_INTER_BITS 2
+#define LINEAR_HORZ_SHIFT (FILTER_BITS - LINEAR_INTER_BITS)
+#define LINEAR_VERT_SHIFT (FILTER_BITS + LINEAR_INTER_BITS)
+
+// sRGB → 선형 표 크기 (앞 256개는 색 채널, 뒤 256개는 알파: 알파는 감마 없이 비례로 늘림)
+#define TO_LINEAR_ALPHA 256
+#define TO_LINEAR_SIZE (2 * TO_LINEAR_ALPHA)
+
+// 선형 → sRGB 표 크기 (색 채널 다음에 알파 구간, AVX2가 4바이트씩 모아 읽으므로 끝에 3바이트 여유)
+#define TO_SRGB_ALPHA (LINEAR_MAX + 1)
+#define LINEAR_TO_SRGB_SIZE (2 * TO_SRGB_ALPHA + 3)
+
+// 색 필터 계수 정밀도 (계수 1.0 = 1 << COLOR_BITS, |계수| < 8)
+#define COLOR_BITS 12
+
+// 색 필터 합 정밀도: 채널 값 << 7과 계수의 곱 상위 16비트 = 값 × 계수 << COLOR_SUM_BITS
+#define COLOR_SUM_BITS 3
+
+// 색 필터 고정소수점 행렬 (BGRA 순서, 알파는 그대로)
+// 출력 채널 합이 int16에 들도록 행마다 |계수| 합 × 255 × 8 + |더할 값|이 32767 미만이어야 한다.
+typedef struct {
+    int16_t m[3][3];        // [출력 B/G/R][입력 B/G/R]
+    int16_t offset[3];      // 출력 채널별 더할 값 (COLOR_SUM_BITS 정밀도, 반올림 포함)
+} ColorMatrix;
+
+// x86 SIMD 커널 사용 가능 여부 (GCC/Clang target 속성 사용)
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define SCALER_HAVE_X86 1
+#else
+#define SCALER_HAVE_X86 0
+#endif
+
+/**
+ * 수평 패스: 소스 행 → int16 중간 행 (출력 픽셀당 BGRA 4개)
+ * starts[i]: 출력 픽셀 i의 첫 탭 위치, weights[i * taps + k]: 탭 가중치
+ */
+typedef void (*HorizontalPassFn)(const uint32_t* srcRow, int16_t* out, int count,
+                                 const int32_t* starts, const int16_t* weights, int taps);
+
+/**
+ * 수직 패스: int16 중간 행 taps개 → 출력 행
+ */
+typedef void (*VerticalPassFn)(const int16_t* const* rows, const int16_t* weights, int taps,
+                               uint32_t* out, int count);
+
+/**
+ * 정수 배율 최근접 행: out[x] = src[(x + phase) / factor]
+ * phase: 첫 소스 픽셀 중 이미 지나간 반복 수 (0 <= phase < factor)
+ */
+typedef void (*ReplicateRowFn)(const uint32_t* src, uint32_t* out, int count, int factor, int phase);
+
+/**
+ * 색 필터 행: out[x] = 행렬 × src[x]
+ * 항마다 ((값 << 7) × 계수) >> 16, 합에 더할 값을 더해 COLOR_SUM_BITS만큼 내리고 0~255로 자른다.
+ */
+typedef void (*ColorRowFn)(const uint32_t* src, uint32_t* out, int count, const ColorMatrix* matrix);
+
+/**
+ * sRGB 행 → 선형 행 (채널마다 표 조회, 픽셀당 int16 4개, 알파는 표의 TO_LINEAR_ALPHA 구간)
+ */
+typedef void (*ToLinearRowFn)(const uint32_t* src, int16_t* out, int count, const int32_t* toLinear);
+
+/**
+ * 선형 수평 패스: 선형 행 → int16 중간 행 (starts는 픽셀 단위)
+ */
+typedef void (*HorizontalLinearFn)(const int16_t* srcRow, int16_t* out, int count,
+                                   const int32_t* starts, const int16_t* weights, int taps);
+
+/**
+ * 선형 수직 패스: int16 중간 행 taps개 → 0~LINEAR_MAX로 자른 뒤 sRGB 표로 출력 행 (알파는 TO_SRGB_ALPHA 구간)
+ */
+typedef void (*VerticalLinearFn)(const int16_t* const* rows, const int16_t* weights, int taps,
+                                 uint32_t* out, int count, const uint8_t* toSrgb);
+
+void Scaler_HorizontalScalar(const uint32_t* srcRow, int16_t* out, int count,
+                             const int32_t* starts, const int16_t* weights, int taps);
+void Scaler_VerticalScalar(const int16_t* const* rows, const int16_t* weights, int taps,
+                           uint32_t* out, int count);
+void Scaler_ReplicateScalar(const uint32_t* src, uint32_t* out, int count, int factor, int phase);
+void Scaler_ColorScalar(const uint32_t* src, uint32_t* out, int count, const ColorMatrix* matrix);
+void Scaler_ToLinearScalar(const uint32_t* src, int16_t* out, int count, const int32_t* toLinear);
+void Scaler_HorizontalLinearScalar(const int16_t* srcRow, int16_t* out, int count,
+                                   const int32_t* starts, const int16_t* weights, int taps);
+void Scaler_VerticalLinearScalar(const int16_t* const* rows, const int16_t* weights, int taps,
+                                 uint32_t* out, int count, const uint8_t* toSrgb);
+
+#if SCALER_HAVE_X86
+void Scaler_HorizontalSse2(const uint32_t* srcRow, int16_t* out, int count,
+                           const int32_t* starts, const int16_t* weights, int taps);
+void Scaler_VerticalSse2(const int16_t* const* rows, const int16_t* weights, int taps,
+                         uint32_t* out, int count);
+void Scaler_ReplicateSse2(const uint32_t* src, uint32_t* out, int count, int factor, int phase);
+void Scaler_ColorSse2(const uint32_t* src, uint32_t* out, int count, const ColorMatrix* matrix);
+void Scaler_HorizontalLinearSse2(const int16_t* srcRow, int16_t* out, int count,
+                                 const int32_t* starts, const int16_t* weights, int taps);
+void Scaler_VerticalLinearSse2(const int16_t* const* rows, const int16_t* weights, int taps,
+                               uint32_t* out, int count, const uint8_t* toSrgb);
+void Scaler_HorizontalAvx2(const uint32_t* srcRow, int16_t* out, int count,
+                           const int32_t* starts, const int16_t* weights, int taps);
+void Scaler_VerticalAvx2(const int16_t* const* rows, const int16_t* weights, int taps,
+                         uint32_t* out, int count);
+void Scaler_ReplicateAvx2(const uint32_t* src, uint32_t* out, int count, int factor, int phase);
+void Scaler_ColorAvx2(const uint32_t* src, uint32_t* out, int count, const ColorMatrix* matrix);
+void Scaler_ToLinearAvx2(const uint32_t* src, int16_t* out, int count, const int32_t* toLinear);
+void Scaler_HorizontalLinearAvx2(const int16_t* srcRow, int16_t* out, int count,
+                                 const int32_t* starts, const int16_t* weights, int taps);
+void Scaler_VerticalLinearAvx2(const int16_t* const* rows, const int16_t* weights, int taps,
+                               uint32_t* out, int count, const uint8_t* toSrgb);
+#endif
+
+#endif // LETSZOOM_SCALER_KERNELS_H
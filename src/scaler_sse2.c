@@ -0,0 +1,407 @@
+/**
+ * scaler_sse2.c - 확대 엔진 SSE2 커널
+ *
+ * 스칼라 커널(scaler.c)과 같은 고정소수점 연산을 8개 채널씩 처리한다.
+ */
+
+#include "scaler_kernels.h"
+
+#if SCALER_HAVE_X86
+
+#include <emmintrin.h>
+#include <string.h>
+
+#define SSE2_TARGET __attribute__((target("sse2")))
+
+// 가중치 쌍 읽기용 (int16 배열을 int32로 읽어도 안전하도록)
+typedef int32_t __attribute__((may_alias)) WeightPairWord;
+
+/**
+ * 탭 가중치 두 개를 madd용 (w0, w1) 쌍으로 묶기
+ */
+static inline int32_t WeightPair(int16_t w0, int16_t w1)
+{
+    return (int32_t)(((uint32_t)(uint16_t)w1 << 16) | (uint16_t)w0);
+}
+
+/**
+ * 출력 픽셀 하나의 수평 누적 (BGRA 4개 int32)
+ * w: (w0, w1) 가중치 쌍 배열
+ */
+SSE2_TARGET static inline __attribute__((always_inline))
+__m128i HorizontalPixelSse2(const uint32_t* px, const WeightPairWord* w, int taps)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i acc = _mm_set1_epi32(1 << (HORZ_SHIFT - 1));
+
+    for (int k = 0; k < taps; k += 2) {
+        // [b0 b1 g0 g1 r0 r1 a0 a1] 형태로 섞어 같은 채널끼리 madd
+        __m128i p0 = _mm_cvtsi32_si128((int)px[k]);
+        __m128i p1 = _mm_cvtsi32_si128((int)px[k + 1]);
+        __m128i pp = _mm_unpacklo_epi8(_mm_unpacklo_epi8(p0, p1), zero);
+        acc = _mm_add_epi32(acc, _mm_madd_epi16(pp, _mm_set1_epi32(w[k / 2])));
+    }
+
+    return _mm_srai_epi32(acc, HORZ_SHIFT);
+}
+
+/**
+ * 수평 패스 본체 (taps가 상수로 주어지면 탭 루프가 펼쳐짐)
+ */
+SSE2_TARGET static inline __attribute__((always_inline))
+void HorizontalRowSse2(const uint32_t* srcRow, int16_t* out, int count,
+                       const int32_t* starts, const int16_t* weights, int taps)
+{
+    const WeightPairWord* pairs = (const WeightPairWord*)weights;
+    int half = taps / 2;
+    int i = 0;
+
+    for (; i + 1 < count; i += 2) {
+        __m128i a = HorizontalPixelSse2(srcRow + starts[i], pairs + i * half, taps);
+        __m128i b = HorizontalPixelSse2(srcRow + starts[i + 1], pairs + (i + 1) * half, taps);
+        _mm_storeu_si128((__m128i*)(out + i * 4), _mm_packs_epi32(a, b));
+    }
+
+    if (i < count) {
+        __m128i a = HorizontalPixelSse2(srcRow + starts[i], pairs + i * half, taps);
+        _mm_storel_epi64((__m128i*)(out + i * 4), _mm_packs_epi32(a, a));
+    }
+}
+
+/**
+ * 수평 패스 (SSE2, 탭 수는 짝수)
+ */
+SSE2_TARGET void Scaler_HorizontalSse2(const uint32_t* srcRow, int16_t* out, int count,
+                                       const int32_t* starts, const int16_t* weights, int taps)
+{
+    switch (taps) {
+        case 2:  HorizontalRowSse2(srcRow, out, count, starts, weights, 2); break;
+        case 4:  HorizontalRowSse2(srcRow, out, count, starts, weights, 4); break;
+        case 6:  HorizontalRowSse2(srcRow, out, count, starts, weights, 6); break;
+        default: HorizontalRowSse2(srcRow, out, count, starts, weights, taps); break;
+    }
+}
+
+/**
+ * 중간 행 8개 채널의 수직 누적 → int16 8개
+ * rows/w: 탭 두 개씩 묶은 행 포인터와 가중치 쌍
+ */
+SSE2_TARGET static inline __attribute__((always_inline))
+__m128i VerticalBlockSse2(const int16_t* const* rows, const __m128i* w, int taps, int i)
+{
+    __m128i lo = _mm_set1_epi32(1 << (VERT_SHIFT - 1));
+    __m128i hi = lo;
+
+    for (int k = 0; k < taps; k += 2) {
+        __m128i r0 = _mm_loadu_si128((const __m128i*)(rows[k] + i));
+        __m128i r1 = _mm_loadu_si128((const __m128i*)(rows[k + 1] + i));
+        lo = _mm_add_epi32(lo, _mm_madd_epi16(_mm_unpacklo_epi16(r0, r1), w[k / 2]));
+        hi = _mm_add_epi32(hi, _mm_madd_epi16(_mm_unpackhi_epi16(r0, r1), w[k / 2]));
+    }
+
+    lo = _mm_srai_epi32(lo, VERT_SHIFT);
+    hi = _mm_srai_epi32(hi, VERT_SHIFT);
+    return _mm_packs_epi32(lo, hi);
+}
+
+/**
+ * 중간 행 4개 채널 (픽셀 하나)의 수직 누적
+ */
+SSE2_TARGET static inline __attribute__((always_inline))
+__m128i VerticalPixelSse2(const int16_t* const* rows, const __m128i* w, int taps, int i)
+{
+    __m128i acc = _mm_set1_epi32(1 << (VERT_SHIFT - 1));
+
+    for (int k = 0; k < taps; k += 2) {
+        __m128i r0 = _mm_loadl_epi64((const __m128i*)(rows[k] + i));
+        __m128i r1 = _mm_loadl_epi64((const __m128i*)(rows[k + 1] + i));
+        acc = _mm_add_epi32(acc, _mm_madd_epi16(_mm_unpacklo_epi16(r0, r1), w[k / 2]));
+    }
+
+    acc = _mm_srai_epi32(acc, VERT_SHIFT);
+    return _mm_packs_epi32(acc, acc);
+}
+
+/**
+ * 수직 패스 본체 (taps가 상수로 주어지면 탭 루프가 펼쳐짐)
+ */
+SSE2_TARGET static inline __attribute__((always_inline))
+void VerticalRowSse2(const int16_t* const* rows, const __m128i* w, int taps, uint8_t* dst, int n)
+{
+    int i = 0;
+
+    // 픽셀 4개씩
+    for (; i + 16 <= n; i += 16) {
+        __m128i a = VerticalBlockSse2(rows, w, taps, i);
+        __m128i b = VerticalBlockSse2(rows, w, taps, i + 8);
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_packus_epi16(a, b));
+    }
+
+    // 남은 픽셀
+    for (; i < n; i += 4) {
+        __m128i a = VerticalPixelSse2(rows, w, taps, i);
+        int packed = _mm_cvtsi128_si32(_mm_packus_epi16(a, a));
+        memcpy(dst + i, &packed, 4);
+    }
+}
+
+/**
+ * 수직 패스 (SSE2)
+ */
+SSE2_TARGET void Scaler_VerticalSse2(const int16_t* const* rows, const int16_t* weights, int taps,
+                                     uint32_t* out, int count)
+{
+    // 홀수 탭은 마지막 행을 가중치 0으로 한 번 더 짝지음
+    const int16_t* paired[SCALER_MAX_TAPS + 1];
+    __m128i w[(SCALER_MAX_TAPS + 1) / 2];
+    int evenTaps = (taps + 1) & ~1;
+    for (int k = 0; k < evenTaps; k += 2) {
+        int16_t w1 = (k + 1 < taps) ? weights[k + 1] : 0;
+        paired[k] = rows[k];
+        paired[k + 1] = (k + 1 < taps) ? rows[k + 1] : rows[k];
+        w[k / 2] = _mm_set1_epi32(WeightPair(weights[k], w1));
+    }
+
+    uint8_t* dst = (uint8_t*)out;
+    int n = count * 4;
+
+    switch (evenTaps) {
+        case 2:  VerticalRowSse2(paired, w, 2, dst, n); break;
+        case 4:  VerticalRowSse2(paired, w, 4, dst, n); break;
+        case 6:  VerticalRowSse2(paired, w, 6, dst, n); break;
+        default: VerticalRowSse2(paired, w, evenTaps, dst, n); break;
+    }
+}
+
+/**
+ * 정수 배율 최근접 행 (SSE2)
+ * 배율 2/3은 소스 4픽셀을 셔플로 펼치고, 4 이상은 픽셀을 채운 레지스터를 배율만큼 이어 저장한다.
+ */
+SSE2_TARGET void Scaler_ReplicateSse2(const uint32_t* src, uint32_t* out, int count, int factor, int phase)
+{
+    int x = 0;
+
+    // 앞 소스 픽셀의 남은 반복
+    if (phase > 0) {
+        int run = factor - phase < count ? factor - phase : count;
+        for (; x < run; x++) {
+            out[x] = *src;
+        }
+        src++;
+    }
+
+    if (factor == 2) {
+        for (; x + 8 <= count; x += 8, src += 4) {
+            __m128i v = _mm_loadu_si128((const __m128i*)src);
+            _mm_storeu_si128((__m128i*)(out + x), _mm_unpacklo_epi32(v, v));
+            _mm_storeu_si128((__m128i*)(out + x + 4), _mm_unpackhi_epi32(v, v));
+        }
+    } else if (factor == 3) {
+        for (; x + 12 <= count; x += 12, src += 4) {
+            __m128i v = _mm_loadu_si128((const __m128i*)src);
+            _mm_storeu_si128((__m128i*)(out + x), _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 0, 0)));
+            _mm_storeu_si128((__m128i*)(out + x + 4), _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 2, 1, 1)));
+            _mm_storeu_si128((__m128i*)(out + x + 8), _mm_shuffle_epi32(v, _MM_SHUFFLE(3, 3, 3, 2)));
+        }
+    } else if (factor >= 4) {
+        // 마지막 저장이 다음 픽셀 자리까지 넘칠 수 있으나 다음 픽셀이 덮어씀
+        int span = (factor + 3) & ~3;
+        for (; x + span <= count; x += factor, src++) {
+            __m128i v = _mm_set1_epi32((int)*src);
+            for (int k = 0; k < factor; k += 4) {
+                _mm_storeu_si128((__m128i*)(out + x + k), v);
+            }
+        }
+    }
+
+    Scaler_ReplicateScalar(src, out + x, count - x, factor, 0);
+}
+
+/**
+ * 색 필터 출력 채널 하나 (채널 평면 b/g/r: 값 << 7, w: 계수 세 개와 더할 값)
+ */
+SSE2_TARGET static inline __attribute__((always_inline))
+__m128i ColorChannelSse2(__m128i b, __m128i g, __m128i r, const __m128i* w)
+{
+    __m128i sum = _mm_add_epi16(_mm_mulhi_epi16(b, w[0]), _mm_mulhi_epi16(g, w[1]));
+    sum = _mm_add_epi16(sum, _mm_mulhi_epi16(r, w[2]));
+    return _mm_srai_epi16(_mm_add_epi16(sum, w[3]), COLOR_SUM_BITS);
+}
+
+/**
+ * 색 필터 행 (SSE2, 픽셀 8개씩)
+ * 픽셀을 B/G/R/A 16비트 평면으로 나눠 출력 채널마다 곱 세 번으로 계산하고 다시 섞는다.
+ */
+SSE2_TARGET void Scaler_ColorSse2(const uint32_t* src, uint32_t* out, int count, const ColorMatrix* matrix)
+{
+    const __m128i mask = _mm_set1_epi32(0xFF << 7);
+    __m128i w[3][4];
+    for (int c = 0; c < 3; c++) {
+        for (int k = 0; k < 3; k++) {
+            w[c][k] = _mm_set1_epi16(matrix->m[c][k]);
+        }
+        w[c][3] = _mm_set1_epi16(matrix->offset[c]);
+    }
+
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m128i v0 = _mm_loadu_si128((const __m128i*)(src + i));
+        __m128i v1 = _mm_loadu_si128((const __m128i*)(src + i + 4));
+
+        // 채널 평면 (값 << 7, 알파는 그대로)
+        __m128i b = _mm_packs_epi32(_mm_and_si128(_mm_slli_epi32(v0, 7), mask),
+                                    _mm_and_si128(_mm_slli_epi32(v1, 7), mask));
+        __m128i g = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(v0, 1), mask),
+                                    _mm_and_si128(_mm_srli_epi32(v1, 1), mask));
+        __m128i r = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(v0, 9), mask),
+                                    _mm_and_si128(_mm_srli_epi32(v1, 9), mask));
+        __m128i a = _mm_packs_epi32(_mm_srli_epi32(v0, 24), _mm_srli_epi32(v1, 24));
+
+        __m128i ob = ColorChannelSse2(b, g, r, w[0]);
+        __m128i og = ColorChannelSse2(b, g, r, w[1]);
+        __m128i or = ColorChannelSse2(b, g, r, w[2]);
+
+        // [B.. R..], [G.. A..] → [B G ..], [R A ..] → BGRA
+        __m128i br = _mm_packus_epi16(ob, or);
+        __m128i ga = _mm_packus_epi16(og, a);
+        __m128i bg = _mm_unpacklo_epi8(br, ga);
+        __m128i ra = _mm_unpackhi_epi8(br, ga);
+        _mm_storeu_si128((__m128i*)(out + i), _mm_unpacklo_epi16(bg, ra));
+        _mm_storeu_si128((__m128i*)(out + i + 4), _mm_unpackhi_epi16(bg, ra));
+    }
+
+    Scaler_ColorScalar(src + i, out + i, count - i, matrix);
+}
+
+/**
+ * 선형 행 출력 픽셀 하나의 수평 누적 (BGRA 4개 int32)
+ * px: 첫 탭 픽셀의 선형 값 (픽셀당 int16 4개), w: (w0, w1) 가중치 쌍 배열
+ */
+SSE2_TARGET static inline __attribute__((always_inline))
+__m128i HorizontalLinearPixelSse2(const int16_t* px, const WeightPairWord* w, int taps)
+{
+    __m128i acc = _mm_set1_epi32(1 << (LINEAR_HORZ_SHIFT - 1));
+
+    for (int k = 0; k < taps; k += 2) {
+        // [b0 b1 g0 g1 r0 r1 a0 a1]
+        __m128i p0 = _mm_loadl_epi64((const __m128i*)(px + k * 4));
+        __m128i p1 = _mm_loadl_epi64((const __m128i*)(px + k * 4 + 4));
+        acc = _mm_add_epi32(acc, _mm_madd_epi16(_mm_unpacklo_epi16(p0, p1), _mm_set1_epi32(w[k / 2])));
+    }
+
+    return _mm_srai_epi32(acc, LINEAR_HORZ_SHIFT);
+}
+
+/**
+ * 선형 수평 패스 본체 (taps가 상수로 주어지면 탭 루프가 펼쳐짐)
+ */
+SSE2_TARGET static inline __attribute__((always_inline))
+void HorizontalLinearRowSse2(const int16_t* srcRow, int16_t* out, int count,
+                             const int32_t* starts, const int16_t* weights, int taps)
+{
+    const WeightPairWord* pairs = (const WeightPairWord*)weights;
+    int half = taps / 2;
+    int i = 0;
+
+    for (; i + 1 < count; i += 2) {
+        __m128i a = HorizontalLinearPixelSse2(srcRow + starts[i] * 4, pairs + i * half, taps);
+        __m128i b = HorizontalLinearPixelSse2(srcRow + starts[i + 1] * 4, pairs + (i + 1) * half, taps);
+        _mm_storeu_si128((__m128i*)(out + i * 4), _mm_packs_epi32(a, b));
+    }
+
+    if (i < count) {
+        __m128i a = HorizontalLinearPixelSse2(srcRow + starts[i] * 4, pairs + i * half, taps);
+        _mm_storel_epi64((__m128i*)(out + i * 4), _mm_packs_epi32(a, a));
+    }
+}
+
+/**
+ * 선형 수평 패스 (SSE2, 탭 수는 짝수)
+ */
+SSE2_TARGET void Scaler_HorizontalLinearSse2(const int16_t* srcRow, int16_t* out, int count,
+                                             const int32_t* starts, const int16_t* weights, int taps)
+{
+    switch (taps) {
+        case 2:  HorizontalLinearRowSse2(srcRow, out, count, starts, weights, 2); break;
+        case 4:  HorizontalLinearRowSse2(srcRow, out, count, starts, weights, 4); break;
+        case 6:  HorizontalLinearRowSse2(srcRow, out, count, starts, weights, 6); break;
+        default: HorizontalLinearRowSse2(srcRow, out, count, starts, weights, taps); break;
+    }
+}
+
+/**
+ * 중간 행 8개 채널의 선형 수직 누적 → 0~LINEAR_MAX로 자른 int16 8개
+ */
+SSE2_TARGET static inline __attribute__((always_inline))
+__m128i VerticalLinearBlockSse2(const int16_t* const* rows, const __m128i* w, int taps, int i)
+{
+    __m128i lo = _mm_set1_epi32(1 << (LINEAR_VERT_SHIFT - 1));
+    __m128i hi = lo;
+
+    for (int k = 0; k < taps; k += 2) {
+        __m128i r0 = _mm_loadu_si128((const __m128i*)(rows[k] + i));
+        __m128i r1 = _mm_loadu_si128((const __m128i*)(rows[k + 1] + i));
+        lo = _mm_add_epi32(lo, _mm_madd_epi16(_mm_unpacklo_epi16(r0, r1), w[k / 2]));
+        hi = _mm_add_epi32(hi, _mm_madd_epi16(_mm_unpackhi_epi16(r0, r1), w[k / 2]));
+    }
+
+    lo = _mm_srai_epi32(lo, LINEAR_VERT_SHIFT);
+    hi = _mm_srai_epi32(hi, LINEAR_VERT_SHIFT);
+    __m128i v = _mm_packs_epi32(lo, hi);
+    return _mm_min_epi16(_mm_max_epi16(v, _mm_setzero_si128()), _mm_set1_epi16(LINEAR_MAX));
+}
+
+/**
+ * 선형 수직 패스 본체 (sRGB 변환은 SSE2에 모아 읽기가 없어 채널마다 표 조회)
+ */
+SSE2_TARGET static inline __attribute__((always_inline))
+void VerticalLinearRowSse2(const int16_t* const* rows, const __m128i* w, int taps,
+                           uint8_t* dst, int n, const uint8_t* toSrgb)
+{
+    int16_t linear[8] __attribute__((aligned(16)));
+
+    // 픽셀 2개씩
+    for (int i = 0; i < n; i += 8) {
+        _mm_store_si128((__m128i*)linear, VerticalLinearBlockSse2(rows, w, taps, i));
+        for (int j = 0; j < 8; j++) {
+            dst[i + j] = toSrgb[linear[j] + ((j & 3) == 3 ? TO_SRGB_ALPHA : 0)];
+        }
+    }
+}
+
+/**
+ * 선형 수직 패스 (SSE2, 픽셀 수가 홀수면 마지막 픽셀은 스칼라)
+ */
+SSE2_TARGET void Scaler_VerticalLinearSse2(const int16_t* const* rows, const int16_t* weights, int taps,
+                                           uint32_t* out, int count, const uint8_t* toSrgb)
+{
+    const int16_t* paired[SCALER_MAX_TAPS + 1];
+    __m128i w[(SCALER_MAX_TAPS + 1) / 2];
+    int evenTaps = (taps + 1) & ~1;
+    for (int k = 0; k < evenTaps; k += 2) {
+        int16_t w1 = (k + 1 < taps) ? weights[k + 1] : 0;
+        paired[k] = rows[k];
+        paired[k + 1] = (k + 1 < taps) ? rows[k + 1] : rows[k];
+        w[k / 2] = _mm_set1_epi32(WeightPair(weights[k], w1));
+    }
+
+    uint8_t* dst = (uint8_t*)out;
+    int n = (count & ~1) * 4;
+
+    switch (evenTaps) {
+        case 2:  VerticalLinearRowSse2(paired, w, 2, dst, n, toSrgb); break;
+        case 4:  VerticalLinearRowSse2(paired, w, 4, dst, n, toSrgb); break;
+        case 6:  VerticalLinearRowSse2(paired, w, 6, dst, n, toSrgb); break;
+        default: VerticalLinearRowSse2(paired, w, evenTaps, dst, n, toSrgb); break;
+    }
+
+    if (count & 1) {
+        const int16_t* tail[SCALER_MAX_TAPS];
+        for (int k = 0; k < taps; k++) {
+            tail[k] = rows[k] + n;
+        }
+        Scaler_VerticalLinearScalar(tail, weights, taps, out + count - 1, 1, toSrgb);
+    }
+}
+
+#endif // SCALER_HAVE_X86
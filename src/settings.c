@@ -36,6 +36,19 @@ void Settings_Initialize(Settings* settings)
     // 확대 기본값
     settings->zoomLevel = 200;        // 200%
     settings->smoothZoom = true;
+    settings->sharpZoom = false;
+    settings->linearLight = false;
+    settings->captureBackend = 0;     // GDI
+    settings->animationDuration = 150;  // 150ms
+    settings->scaleThreads = 0;         // 코어 수 (최대 8)
+    settings->cursorPrediction = 75;    // 75%
+    settings->predictionSmoothing = 16; // 16ms
+    settings->lensWidth = 400;
+    settings->lensHeight = 300;
+    settings->lensZoomLevel = 300;      // 300%
+    settings->spotlightShape = 0;       // 원
+    settings->spotlightSize = 150;
+    settings->spotlightDim = 70;        // 70%
 
     // 그리기 기본값
     settings->penColor = RGB(255, 0, 0);  // 빨간색
@@ -54,6 +67,7 @@ void Settings_Initialize(Settings* settings)
     // 일반 기본값
     settings->startWithWindows = false;
     settings->showNotifications = true;
+    settings->keepWarmSeconds = 60;   // 1분
 
     OutputDebugStringW(L"[LetsZoom] Settings initialized with defaults\n");
 }
@@ -126,6 +140,19 @@ bool Settings_Load(Settings* settings)
     // 확대 설정 불러오기
     settings->zoomLevel = GetPrivateProfileIntW(SECTION_ZOOM, L"ZoomLevel", 200, configPath);
     settings->smoothZoom = GetPrivateProfileIntW(SECTION_ZOOM, L"SmoothZoom", 1, configPath) != 0;
+    settings->sharpZoom = GetPrivateProfileIntW(SECTION_ZOOM, L"SharpZoom", 0, configPath) != 0;
+    settings->linearLight = GetPrivateProfileIntW(SECTION_ZOOM, L"LinearLight", 0, configPath) != 0;
+    settings->captureBackend = GetPrivateProfileIntW(SECTION_ZOOM, L"CaptureBackend", 0, configPath);
+    settings->animationDuration = GetPrivateProfileIntW(SECTION_ZOOM, L"AnimationDuration", 150, configPath);
+    settings->scaleThreads = GetPrivateProfileIntW(SECTION_ZOOM, L"ScaleThreads", 0, configPath);
+    settings->cursorPrediction = GetPrivateProfileIntW(SECTION_ZOOM, L"CursorPrediction", 75, configPath);
+    settings->predictionSmoothing = GetPrivateProfileIntW(SECTION_ZOOM, L"PredictionSmoothing", 16, configPath);
+    settings->lensWidth = GetPrivateProfileIntW(SECTION_ZOOM, L"LensWidth", 400, configPath);
+    settings->lensHeight = GetPrivateProfileIntW(SECTION_ZOOM, L"LensHeight", 300, configPath);
+    settings->lensZoomLevel = GetPrivateProfileIntW(SECTION_ZOOM, L"LensZoomLevel", 300, configPath);
+    settings->spotlightShape = GetPrivateProfileIntW(SECTION_ZOOM, L"SpotlightShape", 0, configPath);
+    settings->spotlightSize = GetPrivateProfileIntW(SECTION_ZOOM, L"SpotlightSize", 150, configPath);
+    settings->spotlightDim = GetPrivateProfileIntW(SECTION_ZOOM, L"SpotlightDim", 70, configPath);
 
     // 그리기 설정 불러오기
     settings->penColor = GetPrivateProfileIntW(SECTION_DRAW, L"PenColor", RGB(255, 0, 0), configPath);
@@ -146,6 +173,7 @@ bool Settings_Load(Settings* settings)
     // 일반 설정 불러오기
     settings->startWithWindows = GetPrivateProfileIntW(SECTION_GENERAL, L"StartWithWindows", 0, configPath) != 0;
     settings->showNotifications = GetPrivateProfileIntW(SECTION_GENERAL, L"ShowNotifications", 1, configPath) != 0;
+    settings->keepWarmSeconds = GetPrivateProfileIntW(SECTION_GENERAL, L"KeepWarmSeconds", 60, configPath);
 
     OutputDebugStringW(L"[LetsZoom] Settings loaded successfully\n");
     return true;
@@ -197,6 +225,32 @@ bool Settings_Save(const Settings* settings)
     WritePrivateProfileStringW(SECTION_ZOOM, L"ZoomLevel", buffer, configPath);
     swprintf_s(buffer, 256, L"%d", settings->smoothZoom ? 1 : 0);
     WritePrivateProfileStringW(SECTION_ZOOM, L"SmoothZoom", buffer, configPath);
+    swprintf_s(buffer, 256, L"%d", settings->sharpZoom ? 1 : 0);
+    WritePrivateProfileStringW(SECTION_ZOOM, L"SharpZoom", buffer, configPath);
+    swprintf_s(buffer, 256, L"%d", settings->linearLight ? 1 : 0);
+    WritePrivateProfileStringW(SECTION_ZOOM, L"LinearLight", buffer, configPath);
+    swprintf_s(buffer, 256, L"%d", settings->captureBackend);
+    WritePrivateProfileStringW(SECTION_ZOOM, L"CaptureBackend", buffer, configPath);
+    swprintf_s(buffer, 256, L"%d", settings->animationDuration);
+    WritePrivateProfileStringW(SECTION_ZOOM, L"AnimationDuration", buffer, configPath);
+    swprintf_s(buffer, 256, L"%d", settings->scaleThreads);
+    WritePrivateProfileStringW(SECTION_ZOOM, L"ScaleThreads", buffer, configPath);
+    swprintf_s(buffer, 256, L"%d", settings->cursorPrediction);
+    WritePrivateProfileStringW(SECTION_ZOOM, L"CursorPrediction", buffer, configPath);
+    swprintf_s(buffer, 256, L"%d", settings->predictionSmoothing);
+    WritePrivateProfileStringW(SECTION_ZOOM, L"PredictionSmoothing", buffer, configPath);
+    swprintf_s(buffer, 256, L"%d", settings->lensWidth);
+    WritePrivateProfileStringW(SECTION_ZOOM, L"LensWidth", buffer, configPath);
+    swprintf_s(buffer, 256, L"%d", settings->lensHeight);
+    WritePrivateProfileStringW(SECTION_ZOOM, L"LensHeight", buffer, configPath);
+    swprintf_s(buffer, 256, L"%d", settings->lensZoomLevel);
+    WritePrivateProfileStringW(SECTION_ZOOM, L"LensZoomLevel", buffer, configPath);
+    swprintf_s(buffer, 256, L"%d", settings->spotlightShape);
+    WritePrivateProfileStringW(SECTION_ZOOM, L"SpotlightShape", buffer, configPath);
+    swprintf_s(buffer, 256, L"%d", settings->spotlightSize);
+    WritePrivateProfileStringW(SECTION_ZOOM, L"SpotlightSize", buffer, configPath);
+    swprintf_s(buffer, 256, L"%d", settings->spotlightDim);
+    WritePrivateProfileStringW(SECTION_ZOOM, L"SpotlightDim", buffer, configPath);
 
     // 그리기 설정 저장
     swprintf_s(buffer, 256, L"%u", settings->penColor);
@@ -216,6 +270,8 @@ bool Settings_Save(const Settings* settings)
     WritePrivateProfileStringW(SECTION_GENERAL, L"StartWithWindows", buffer, configPath);
     swprintf_s(buffer, 256, L"%d", settings->showNotifications ? 1 : 0);
     WritePrivateProfileStringW(SECTION_GENERAL, L"ShowNotifications", buffer, configPath);
+    swprintf_s(buffer, 256, L"%d", settings->keepWarmSeconds);
+    WritePrivateProfileStringW(SECTION_GENERAL, L"KeepWarmSeconds", buffer, configPath);
 
     OutputDebugStringW(L"[LetsZoom] Settings saved successfully\n");
     return true;
@@ -23,6 +23,19 @@ typedef struct {
     // 확대 설정
     int zoomLevel;               // 확대 배율 (100-800%)
     bool smoothZoom;             // 부드러운 확대 활성화
+    bool sharpZoom;              // 선명한 부드러운 확대 (Lanczos-3, smoothZoom일 때만, 더 느림)
+    bool linearLight;            // 선형 광량 보간 (밝은 가는 글자가 덜 어두워짐, smoothZoom일 때만)
+    int captureBackend;          // 화면 캡처 방식 (0=GDI, 1=Desktop Duplication, 2=Magnification API)
+    int animationDuration;       // 확대/이동 전환 시간 (0-1000ms, 0=즉시)
+    int scaleThreads;            // 확대 스레드 수 (0=자동, 1-16)
+    int cursorPrediction;        // 커서 예측 강도 (0-100%, 0=끔)
+    int predictionSmoothing;     // 커서 속도 평활 시간 (0-200ms)
+    int lensWidth;               // 돋보기 너비 (100-1600, 96 DPI 기준 픽셀)
+    int lensHeight;              // 돋보기 높이 (100-1200)
+    int lensZoomLevel;           // 돋보기 배율 (100-2000%)
+    int spotlightShape;          // 스포트라이트 모양 (0=원, 1=가로 사각형)
+    int spotlightSize;           // 스포트라이트 크기 (원의 반지름/사각형 높이의 절반, 20-800, 96 DPI 기준 픽셀)
+    int spotlightDim;            // 스포트라이트 바깥 어둡기 (0-100%)
 
     // 그리기 설정
     COLORREF penColor;           // 펜 색상
@@ -36,6 +49,7 @@ typedef struct {
     // 일반 설정
     bool startWithWindows;       // Windows 시작 시 자동 실행
     bool showNotifications;      // 알림 표시
+    int keepWarmSeconds;         // 사용 후 창/버퍼를 남겨 둘 시간 (0-600초, 0=바로 해제)
 } Settings;
 
 /**
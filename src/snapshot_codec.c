@@ -0,0 +1,282 @@
+/**
+ * snapshot_codec.c - 화면 스냅샷 압축 구현
+ *
+ * 행마다 토큰을 잇달아 쓴다. 토큰 하나는
+ *   [리터럴 수 4비트 | 일치 길이 - MIN_MATCH 4비트] (15면 뒤에 255씩 이어지는 추가 길이)
+ *   리터럴 픽셀 (4바이트씩)
+ *   일치 원본: 위로 몇 행(dy, 16비트)과 그 행의 x (16비트)
+ * 이고, 리터럴로 행이 끝나면 일치 부분이 없다. 일치는 행 끝을 넘지 않고,
+ * dy = 0이면 원본이 지금 위치와 겹칠 수 있다 (x - 1에서 복사 = 같은 색 반복).
+ */
+
+#include "snapshot_codec.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define MIN_MATCH 3                 // 최소 일치 길이 (픽셀, 2픽셀 일치는 사진 같은 영역에서 토큰만 늘려 풀기가 느려짐)
+#define HASH_BITS 16
+#define HASH_SIZE (1 << HASH_BITS)
+#define HASH_EMPTY 0xFFFFFFFFu
+#define SKIP_TRIGGER 5              // 일치가 2^5번 연속 없으면 건너뛰는 폭을 늘림 (사진 같은 영역)
+#define MAX_DIMENSION 65535
+
+/**
+ * 두 픽셀의 해시
+ */
+static inline uint32_t HashPixels(uint32_t a, uint32_t b)
+{
+    return ((a * 2654435761u) ^ (b * 2246822519u)) >> (32 - HASH_BITS);
+}
+
+/**
+ * 일치 길이 (limit 픽셀까지)
+ */
+static inline int MatchLength(const uint32_t* cur, const uint32_t* src, int limit)
+{
+    int length = 0;
+    while (length < limit && cur[length] == src[length]) {
+        length++;
+    }
+    return length;
+}
+
+/**
+ * 추가 길이 쓰기 (15를 넘는 부분을 255씩)
+ */
+static inline uint8_t* WriteLength(uint8_t* op, int length)
+{
+    while (length >= 255) {
+        *op++ = 255;
+        length -= 255;
+    }
+    *op++ = (uint8_t)length;
+    return op;
+}
+
+/**
+ * 토큰 하나 쓰기 (matchLength가 0이면 리터럴만)
+ */
+static uint8_t* WriteToken(uint8_t* op, const uint32_t* literals, int literalCount,
+                           int matchLength, int dy, int sx)
+{
+    int matchCode = matchLength > 0 ? matchLength - MIN_MATCH : 0;
+    uint8_t* token = op++;
+    *token = (uint8_t)(((literalCount < 15 ? literalCount : 15) << 4) | (matchCode < 15 ? matchCode : 15));
+
+    if (literalCount >= 15) {
+        op = WriteLength(op, literalCount - 15);
+    }
+    memcpy(op, literals, (size_t)literalCount * 4);
+    op += (size_t)literalCount * 4;
+
+    if (matchLength > 0) {
+        if (matchCode >= 15) {
+            op = WriteLength(op, matchCode - 15);
+        }
+        op[0] = (uint8_t)dy;
+        op[1] = (uint8_t)(dy >> 8);
+        op[2] = (uint8_t)sx;
+        op[3] = (uint8_t)(sx >> 8);
+        op += 4;
+    }
+    return op;
+}
+
+/**
+ * 압축 결과의 최대 크기
+ * 행마다 리터럴만 있을 때: 토큰 1 + 추가 길이 (width / 255 + 1) + 픽셀
+ */
+size_t SnapshotCodec_Bound(int width, int height)
+{
+    if (width <= 0 || height <= 0) return 0;
+    return (size_t)height * ((size_t)width * 4 + (size_t)width / 255 + 2);
+}
+
+/**
+ * 압축
+ */
+size_t SnapshotCodec_Encode(const PixelBuffer* image, uint8_t* out, size_t capacity)
+{
+    int width = image->width;
+    int height = image->height;
+    if (width <= 0 || height <= 0 || width > MAX_DIMENSION || height > MAX_DIMENSION ||
+        capacity < SnapshotCodec_Bound(width, height)) {
+        return 0;
+    }
+
+    // 해시 → 마지막으로 본 위치 (y << 16 | x)
+    uint32_t* table = (uint32_t*)malloc(HASH_SIZE * sizeof(uint32_t));
+    if (!table) return 0;
+    memset(table, 0xFF, HASH_SIZE * sizeof(uint32_t));
+
+    uint8_t* op = out;
+
+    for (int y = 0; y < height; y++) {
+        const uint32_t* row = PixelBuffer_Row(image, y);
+        const uint32_t* above = y > 0 ? PixelBuffer_Row(image, y - 1) : NULL;
+        int anchor = 0;
+        int x = 0;
+        int misses = 0;
+
+        while (x + MIN_MATCH <= width) {
+            const uint32_t* cur = row + x;
+            int limit = width - x;
+            int bestLength = 0;
+            int bestDy = 0;
+            int bestX = 0;
+
+            // 바로 위 (같은 내용이 세로로 이어짐)
+            if (above && above[x] == cur[0]) {
+                bestLength = MatchLength(cur, above + x, limit);
+                bestDy = 1;
+                bestX = x;
+            }
+
+            // 바로 왼쪽 (같은 색 반복, 원본이 겹침)
+            if (bestLength < limit && x > 0 && cur[-1] == cur[0]) {
+                int length = MatchLength(cur, cur - 1, limit);
+                if (length > bestLength) {
+                    bestLength = length;
+                    bestDy = 0;
+                    bestX = x - 1;
+                }
+            }
+
+            // 그 밖의 반복 (같은 글자, 아이콘)
+            uint32_t hash = HashPixels(cur[0], cur[1]);
+            uint32_t candidate = table[hash];
+            table[hash] = ((uint32_t)y << 16) | (uint32_t)x;
+            if (bestLength < limit && candidate != HASH_EMPTY) {
+                int cy = (int)(candidate >> 16);
+                int cx = (int)(candidate & 0xFFFF);
+                const uint32_t* src = PixelBuffer_Row(image, cy) + cx;
+                int srcLimit = width - cx;
+                if (src[0] == cur[0]) {
+                    int length = MatchLength(cur, src, limit < srcLimit ? limit : srcLimit);
+                    if (length > bestLength) {
+                        bestLength = length;
+                        bestDy = y - cy;
+                        bestX = cx;
+                    }
+                }
+            }
+
+            if (bestLength < MIN_MATCH) {
+                // 일치가 오래 없으면 (사진, 잡음) 건너뛰는 폭을 늘려 압축 시간을 줄임
+                x += 1 + (misses++ >> SKIP_TRIGGER);
+                continue;
+            }
+
+            op = WriteToken(op, row + anchor, x - anchor, bestLength, bestDy, bestX);
+            x += bestLength;
+            anchor = x;
+            misses = 0;
+
+            // 일치 끝 바로 앞 위치도 해시에 (다음 반복의 시작일 때가 많음)
+            if (x - 2 >= 0 && x < width) {
+                table[HashPixels(row[x - 2], row[x - 1])] = ((uint32_t)y << 16) | (uint32_t)(x - 2);
+            }
+        }
+
+        // 행 끝까지 남은 리터럴
+        if (anchor < width) {
+            op = WriteToken(op, row + anchor, width - anchor, 0, 0, 0);
+        }
+    }
+
+    free(table);
+    return (size_t)(op - out);
+}
+
+/**
+ * 추가 길이 읽기 (끝을 넘으면 -1)
+ */
+static inline int ReadLength(const uint8_t** ip, const uint8_t* end, int length)
+{
+    const uint8_t* p = *ip;
+    uint8_t byte;
+    do {
+        if (p >= end) return -1;
+        byte = *p++;
+        length += byte;
+    } while (byte == 255 && length < 0x10000);
+    *ip = p;
+    return length;
+}
+
+/**
+ * 풀기
+ */
+bool SnapshotCodec_Decode(const uint8_t* data, size_t size, const PixelBuffer* image)
+{
+    int width = image->width;
+    int height = image->height;
+    const uint8_t* ip = data;
+    const uint8_t* end = data + size;
+
+    for (int y = 0; y < height; y++) {
+        uint32_t* row = PixelBuffer_Row(image, y);
+        int x = 0;
+
+        while (x < width) {
+            if (ip >= end) return false;
+            int token = *ip++;
+
+            // 리터럴
+            int literalCount = token >> 4;
+            if (literalCount == 15) {
+                literalCount = ReadLength(&ip, end, literalCount);
+                if (literalCount < 0) return false;
+            }
+            if (literalCount > width - x || (size_t)(end - ip) < (size_t)literalCount * 4) {
+                return false;
+            }
+            memcpy(row + x, ip, (size_t)literalCount * 4);
+            ip += (size_t)literalCount * 4;
+            x += literalCount;
+
+            // 리터럴로 행이 끝나면 일치 없음
+            if (x == width) {
+                break;
+            }
+
+            int matchLength = token & 15;
+            if (matchLength == 15) {
+                matchLength = ReadLength(&ip, end, matchLength);
+                if (matchLength < 0) return false;
+            }
+            matchLength += MIN_MATCH;
+            if (end - ip < 4 || matchLength > width - x) {
+                return false;
+            }
+            int dy = ip[0] | (ip[1] << 8);
+            int sx = ip[2] | (ip[3] << 8);
+            ip += 4;
+
+            uint32_t* dst = row + x;
+            if (dy == 0) {
+                // 같은 행 앞쪽에서 복사 (겹치면 앞에서부터, x - 1이면 한 색 채우기)
+                if (sx >= x) return false;
+                const uint32_t* src = row + sx;
+                if (sx == x - 1) {
+                    uint32_t color = src[0];
+                    for (int i = 0; i < matchLength; i++) {
+                        dst[i] = color;
+                    }
+                } else if (sx + matchLength <= x) {
+                    memcpy(dst, src, (size_t)matchLength * 4);
+                } else {
+                    for (int i = 0; i < matchLength; i++) {
+                        dst[i] = src[i];
+                    }
+                }
+            } else {
+                if (dy > y || sx + matchLength > width) return false;
+                memcpy(dst, PixelBuffer_Row(image, y - dy) + sx, (size_t)matchLength * 4);
+            }
+            x += matchLength;
+        }
+    }
+
+    return ip == end;
+}
@@ -0,0 +1,34 @@
+/**
+ * snapshot_codec.h - 화면 스냅샷 무손실 압축 (LZ 계열, 픽셀 단위)
+ *
+ * 32비트 픽셀을 단위로 하는 LZ77 압축이다. 화면 내용은 같은 색이 이어지거나(바탕, 패널)
+ * 윗줄과 같은 경우가 대부분이라 바로 왼쪽/바로 위를 먼저 비교하고, 그 밖의 반복은 해시로 찾는다.
+ * 토큰과 일치 원본이 한 행 안에 머물러 행 간격(stride)이 다른 버퍼로도 바로 풀 수 있다.
+ * 푸는 쪽은 길이를 읽고 복사만 하므로 4K 한 장을 한 프레임 안에 푼다. (플랫폼 독립)
+ */
+
+#ifndef LETSZOOM_SNAPSHOT_CODEC_H
+#define LETSZOOM_SNAPSHOT_CODEC_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "pixel_buffer.h"
+
+/**
+ * 압축 결과의 최대 크기 (압축이 안 되는 내용이어도 넘지 않음)
+ */
+size_t SnapshotCodec_Bound(int width, int height);
+
+/**
+ * 압축 (out에 capacity 바이트까지, 실패하면 0)
+ * 너비/높이는 65535 이하 (일치 위치를 16비트로 기록)
+ */
+size_t SnapshotCodec_Encode(const PixelBuffer* image, uint8_t* out, size_t capacity);
+
+/**
+ * 풀기 (image는 압축할 때와 같은 크기, 데이터가 깨졌으면 false)
+ */
+bool SnapshotCodec_Decode(const uint8_t* data, size_t size, const PixelBuffer* image);
+
+#endif // LETSZOOM_SNAPSHOT_CODEC_H
@@ -0,0 +1,531 @@
+/**
+ * snapshot_history.c - 압축한 정지 화면 기록 구현
+ *
+ * 기록은 오래된 것부터 배열에 두고, 배경 스레드가 압축을 기다리는 가장 오래된 기록부터 압축한다.
+ * 압축하는 동안에는 잠금을 풀어 두므로 넣기/꺼내기가 기다리지 않는다.
+ * 압축 중인 기록이 한도에 밀려나면 배열에서만 빼고 해제는 압축을 마친 스레드가 한다.
+ */
+
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "snapshot_history.h"
+#include "snapshot_codec.h"
+#include "worker_pool.h"
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+
+typedef CRITICAL_SECTION HistoryLock;
+typedef CONDITION_VARIABLE HistorySignal;
+typedef HANDLE HistoryThread;
+#else
+#include <pthread.h>
+
+typedef pthread_mutex_t HistoryLock;
+typedef pthread_cond_t HistorySignal;
+typedef pthread_t HistoryThread;
+#endif
+
+// 기록 하나
+typedef struct {
+    SnapshotView view;
+    int width;
+    int height;
+    FrameSource* still;         // 압축 전 원본 (압축이 끝나면 NULL)
+    PixelBuffer raw;            // still의 전체 픽셀 (still이 살아 있는 동안 유효)
+    uint8_t* packed;            // 압축 결과
+    size_t packedSize;
+    bool keepRaw;               // 압축하지 못해 원본 그대로 보관
+    bool evicted;               // 압축 중에 밀려남 (압축을 마친 스레드가 해제)
+} SnapshotEntry;
+
+struct SnapshotHistory {
+    int maxEntries;
+    size_t maxBytes;
+    HistoryThread thread;
+    bool started;
+
+    // 아래는 lock으로 보호
+    HistoryLock lock;
+    HistorySignal wake;                                     // 새 기록, 버퍼 반환, 종료
+    SnapshotEntry* entries[SNAPSHOT_HISTORY_MAX_ENTRIES];   // 오래된 것부터
+    int count;
+    SnapshotEntry* busy;                                    // 압축 중인 기록
+    PixelBuffer decoded;                                    // 꺼내기 버퍼
+    bool lent;                                              // decoded를 꺼내 준 상태
+    bool warm;                                              // decoded를 미리 만들어 둠 (Trim 전까지)
+    bool stop;
+
+    // 통계
+    unsigned long long compressed;
+    double compressMs;
+    double maxCompressMs;
+    unsigned long long loads;
+    double loadMs;
+    double maxLoadMs;
+    unsigned long long evictions;
+};
+
+#ifdef _WIN32
+static void InitLock(HistoryLock* lock) { InitializeCriticalSection(lock); }
+static void DeleteLock(HistoryLock* lock) { DeleteCriticalSection(lock); }
+static void Lock(HistoryLock* lock) { EnterCriticalSection(lock); }
+static void Unlock(HistoryLock* lock) { LeaveCriticalSection(lock); }
+static void InitSignal(HistorySignal* signal) { InitializeConditionVariable(signal); }
+static void DeleteSignal(HistorySignal* signal) { (void)signal; }
+static void Wait(HistorySignal* signal, HistoryLock* lock) { SleepConditionVariableCS(signal, lock, INFINITE); }
+static void WakeAll(HistorySignal* signal) { WakeAllConditionVariable(signal); }
+#else
+static void InitLock(HistoryLock* lock) { pthread_mutex_init(lock, NULL); }
+static void DeleteLock(HistoryLock* lock) { pthread_mutex_destroy(lock); }
+static void Lock(HistoryLock* lock) { pthread_mutex_lock(lock); }
+static void Unlock(HistoryLock* lock) { pthread_mutex_unlock(lock); }
+static void InitSignal(HistorySignal* signal) { pthread_cond_init(signal, NULL); }
+static void DeleteSignal(HistorySignal* signal) { pthread_cond_destroy(signal); }
+static void Wait(HistorySignal* signal, HistoryLock* lock) { pthread_cond_wait(signal, lock); }
+static void WakeAll(HistorySignal* signal) { pthread_cond_broadcast(signal); }
+#endif
+
+/**
+ * 기록 해제
+ */
+static void FreeEntry(SnapshotEntry* entry)
+{
+    FrameSource_Destroy(entry->still);
+    free(entry->packed);
+    free(entry);
+}
+
+/**
+ * 기록이 차지하는 메모리 (압축 전이면 원본 크기)
+ */
+static size_t EntryBytes(const SnapshotEntry* entry)
+{
+    return entry->packed ? entry->packedSize : (size_t)entry->width * entry->height * 4;
+}
+
+/**
+ * 보관 메모리 합 (lock을 쥔 채 호출)
+ */
+static size_t TotalBytes(const SnapshotHistory* history)
+{
+    size_t bytes = 0;
+    for (int i = 0; i < history->count; i++) {
+        bytes += EntryBytes(history->entries[i]);
+    }
+    return bytes;
+}
+
+/**
+ * 가장 오래된 기록 버리기 (lock을 쥔 채 호출)
+ */
+static void EvictOldest(SnapshotHistory* history)
+{
+    SnapshotEntry* oldest = history->entries[0];
+    history->count--;
+    memmove(history->entries, history->entries + 1, (size_t)history->count * sizeof(SnapshotEntry*));
+    history->evictions++;
+
+    if (oldest == history->busy) {
+        oldest->evicted = true;
+    } else {
+        FreeEntry(oldest);
+    }
+}
+
+/**
+ * 압축할 기록 (가장 오래된 것부터, lock을 쥔 채 호출)
+ */
+static SnapshotEntry* NextPending(const SnapshotHistory* history)
+{
+    for (int i = 0; i < history->count; i++) {
+        SnapshotEntry* entry = history->entries[i];
+        if (entry->still && !entry->keepRaw) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * 가장 최근 기록 크기로 꺼내기 버퍼를 미리 만들어야 하는지 (lock을 쥔 채 호출)
+ */
+static bool NeedsPrepare(const SnapshotHistory* history)
+{
+    if (!history->warm || history->lent || history->count == 0) {
+        return false;
+    }
+
+    const SnapshotEntry* newest = history->entries[history->count - 1];
+    return history->decoded.width != newest->width || history->decoded.height != newest->height;
+}
+
+/**
+ * 기록 하나 압축 (lock을 쥔 채 호출, 압축하는 동안은 풀어 둠)
+ */
+static void CompressEntry(SnapshotHistory* history, SnapshotEntry* entry)
+{
+    history->busy = entry;
+    Unlock(&history->lock);
+
+    double start = WorkerPool_NowMs();
+    size_t capacity = SnapshotCodec_Bound(entry->width, entry->height);
+    uint8_t* packed = (uint8_t*)malloc(capacity);
+    size_t size = packed ? SnapshotCodec_Encode(&entry->raw, packed, capacity) : 0;
+    if (size > 0) {
+        // 한도 계산이 실제 메모리와 맞도록 남는 부분 반환
+        uint8_t* shrunk = (uint8_t*)realloc(packed, size);
+        if (shrunk) packed = shrunk;
+    }
+    double elapsed = WorkerPool_NowMs() - start;
+
+    Lock(&history->lock);
+    history->busy = NULL;
+
+    if (entry->evicted) {
+        Unlock(&history->lock);
+        free(packed);
+        FreeEntry(entry);
+        Lock(&history->lock);
+        return;
+    }
+
+    if (size == 0) {
+        free(packed);
+        entry->keepRaw = true;
+        return;
+    }
+
+    FrameSource* still = entry->still;
+    entry->packed = packed;
+    entry->packedSize = size;
+    entry->still = NULL;
+    memset(&entry->raw, 0, sizeof(PixelBuffer));
+
+    history->compressed++;
+    history->compressMs += elapsed;
+    if (elapsed > history->maxCompressMs) history->maxCompressMs = elapsed;
+
+    // 원본 해제는 잠금 밖에서 (큰 메모리 반환이 넣기/꺼내기를 막지 않도록)
+    Unlock(&history->lock);
+    FrameSource_Destroy(still);
+    Lock(&history->lock);
+}
+
+/**
+ * 꺼내기 버퍼를 미리 만들고 페이지를 채움 (lock을 쥔 채 호출, 만드는 동안은 풀어 둠)
+ * 처음 쓰는 페이지의 할당 비용이 풀기보다 커서, 꺼낼 때가 아니라 미리 치른다.
+ */
+static void PrepareDecoded(SnapshotHistory* history)
+{
+    const SnapshotEntry* newest = history->entries[history->count - 1];
+    int width = newest->width;
+    int height = newest->height;
+    Unlock(&history->lock);
+
+    PixelBuffer buffer;
+    bool created = PixelBuffer_Alloc(&buffer, width, height);
+    if (created) {
+        PixelBuffer_Fill(&buffer, 0);
+    }
+
+    Lock(&history->lock);
+    if (!created) {
+        history->warm = false;  // 메모리가 없으면 꺼낼 때 다시 시도
+        return;
+    }
+
+    // 그 사이에 꺼냈거나 Trim했으면 버림 (해제는 잠금 밖에서)
+    PixelBuffer unused = buffer;
+    if (!history->lent && history->warm) {
+        unused = history->decoded;
+        history->decoded = buffer;
+    }
+    Unlock(&history->lock);
+    PixelBuffer_Free(&unused);
+    Lock(&history->lock);
+}
+
+/**
+ * 배경 스레드 본체
+ */
+static void HistoryLoop(SnapshotHistory* history)
+{
+    Lock(&history->lock);
+    for (;;) {
+        if (history->stop) {
+            break;
+        }
+
+        SnapshotEntry* entry = NextPending(history);
+        if (entry) {
+            CompressEntry(history, entry);
+        } else if (NeedsPrepare(history)) {
+            PrepareDecoded(history);
+        } else {
+            Wait(&history->wake, &history->lock);
+        }
+    }
+    Unlock(&history->lock);
+}
+
+#ifdef _WIN32
+static DWORD WINAPI HistoryThreadMain(LPVOID param)
+{
+    HistoryLoop((SnapshotHistory*)param);
+    return 0;
+}
+
+static bool StartThread(SnapshotHistory* history)
+{
+    history->thread = CreateThread(NULL, 0, HistoryThreadMain, history, 0, NULL);
+    if (history->thread) {
+        // 압축은 화면 갱신보다 급하지 않음
+        SetThreadPriority(history->thread, THREAD_PRIORITY_BELOW_NORMAL);
+    }
+    return history->thread != NULL;
+}
+
+static void JoinThread(HistoryThread thread)
+{
+    WaitForSingleObject(thread, INFINITE);
+    CloseHandle(thread);
+}
+#else
+static void* HistoryThreadMain(void* param)
+{
+    HistoryLoop((SnapshotHistory*)param);
+    return NULL;
+}
+
+static bool StartThread(SnapshotHistory* history)
+{
+    return pthread_create(&history->thread, NULL, HistoryThreadMain, history) == 0;
+}
+
+static void JoinThread(HistoryThread thread)
+{
+    pthread_join(thread, NULL);
+}
+#endif
+
+/**
+ * 기록 생성
+ */
+SnapshotHistory* SnapshotHistory_Create(int maxEntries, size_t maxBytes)
+{
+    if (maxEntries < 1) maxEntries = 1;
+    if (maxEntries > SNAPSHOT_HISTORY_MAX_ENTRIES) maxEntries = SNAPSHOT_HISTORY_MAX_ENTRIES;
+
+    SnapshotHistory* history = (SnapshotHistory*)calloc(1, sizeof(SnapshotHistory));
+    if (!history) return NULL;
+
+    history->maxEntries = maxEntries;
+    history->maxBytes = maxBytes;
+    InitLock(&history->lock);
+    InitSignal(&history->wake);
+
+    history->started = StartThread(history);
+    if (!history->started) {
+        DeleteSignal(&history->wake);
+        DeleteLock(&history->lock);
+        free(history);
+        return NULL;
+    }
+    return history;
+}
+
+/**
+ * 기록 파괴
+ */
+void SnapshotHistory_Destroy(SnapshotHistory* history)
+{
+    if (!history) return;
+
+    Lock(&history->lock);
+    history->stop = true;
+    WakeAll(&history->wake);
+    Unlock(&history->lock);
+
+    if (history->started) {
+        JoinThread(history->thread);
+    }
+
+    for (int i = 0; i < history->count; i++) {
+        FreeEntry(history->entries[i]);
+    }
+    PixelBuffer_Free(&history->decoded);
+
+    DeleteSignal(&history->wake);
+    DeleteLock(&history->lock);
+    free(history);
+}
+
+/**
+ * 정지 화면 넣기
+ */
+bool SnapshotHistory_Push(SnapshotHistory* history, FrameSource* still, const SnapshotView* view)
+{
+    if (!history || !still || !view) {
+        FrameSource_Destroy(still);
+        return false;
+    }
+
+    // 전체 영역의 픽셀 (정지 화면이라 이후 획득 없이 그대로 유효)
+    Frame frame;
+    SnapshotEntry* entry = NULL;
+    if (!FrameSource_Acquire(still, NULL, &frame) ||
+        !(entry = (SnapshotEntry*)calloc(1, sizeof(SnapshotEntry)))) {
+        FrameSource_Destroy(still);
+        return false;
+    }
+
+    entry->view = *view;
+    entry->width = frame.pixels.width;
+    entry->height = frame.pixels.height;
+    entry->still = still;
+    entry->raw = frame.pixels;
+
+    Lock(&history->lock);
+
+    if (history->count == history->maxEntries) {
+        EvictOldest(history);
+    }
+    history->entries[history->count++] = entry;
+
+    // 메모리 한도를 넘으면 오래된 것부터 (방금 넣은 것은 남김)
+    while (history->count > 1 && TotalBytes(history) > history->maxBytes) {
+        EvictOldest(history);
+    }
+
+    history->warm = true;
+    WakeAll(&history->wake);
+    Unlock(&history->lock);
+    return true;
+}
+
+/**
+ * 보관 중인 스냅샷 수
+ */
+int SnapshotHistory_GetCount(SnapshotHistory* history)
+{
+    if (!history) return 0;
+
+    Lock(&history->lock);
+    int count = history->count;
+    Unlock(&history->lock);
+    return count;
+}
+
+/**
+ * 스냅샷 꺼내기
+ */
+const PixelBuffer* SnapshotHistory_Load(SnapshotHistory* history, int age, SnapshotView* view)
+{
+    if (!history) return NULL;
+
+    Lock(&history->lock);
+    if (history->lent || age < 0 || age >= history->count) {
+        Unlock(&history->lock);
+        return NULL;
+    }
+
+    double start = WorkerPool_NowMs();
+    const SnapshotEntry* entry = history->entries[history->count - 1 - age];
+
+    // 미리 만든 버퍼가 없거나 크기가 다르면 지금 만듦 (페이지 할당만큼 느림)
+    PixelBuffer* decoded = &history->decoded;
+    if (decoded->width != entry->width || decoded->height != entry->height) {
+        PixelBuffer_Free(decoded);
+        if (!PixelBuffer_Alloc(decoded, entry->width, entry->height)) {
+            Unlock(&history->lock);
+            return NULL;
+        }
+    }
+
+    // 압축이 끝났으면 풀고, 아직이면 원본 복사
+    bool loaded = true;
+    if (entry->packed) {
+        loaded = SnapshotCodec_Decode(entry->packed, entry->packedSize, decoded);
+    } else {
+        for (int y = 0; y < entry->height; y++) {
+            memcpy(PixelBuffer_Row(decoded, y), PixelBuffer_Row(&entry->raw, y), (size_t)entry->width * 4);
+        }
+    }
+
+    double elapsed = WorkerPool_NowMs() - start;
+    if (loaded) {
+        history->lent = true;
+        history->loads++;
+        history->loadMs += elapsed;
+        if (elapsed > history->maxLoadMs) history->maxLoadMs = elapsed;
+        if (view) {
+            *view = entry->view;
+        }
+    }
+
+    Unlock(&history->lock);
+    return loaded ? decoded : NULL;
+}
+
+/**
+ * 꺼낸 버퍼 돌려주기
+ */
+void SnapshotHistory_Release(SnapshotHistory* history)
+{
+    if (!history) return;
+
+    Lock(&history->lock);
+    history->lent = false;
+    WakeAll(&history->wake);   // 가장 최근 기록과 크기가 다르면 다시 준비
+    Unlock(&history->lock);
+}
+
+/**
+ * 꺼내기 버퍼 해제
+ */
+void SnapshotHistory_Trim(SnapshotHistory* history)
+{
+    if (!history) return;
+
+    Lock(&history->lock);
+    if (!history->lent) {
+        PixelBuffer_Free(&history->decoded);
+        history->warm = false;
+    }
+    Unlock(&history->lock);
+}
+
+/**
+ * 통계 가져오기
+ */
+void SnapshotHistory_GetStats(SnapshotHistory* history, SnapshotHistoryStats* stats)
+{
+    if (!history || !stats) return;
+
+    memset(stats, 0, sizeof(SnapshotHistoryStats));
+
+    Lock(&history->lock);
+    stats->entries = history->count;
+    for (int i = 0; i < history->count; i++) {
+        const SnapshotEntry* entry = history->entries[i];
+        if (!entry->packed) {
+            stats->pending++;
+        }
+        stats->bytes += EntryBytes(entry);
+        stats->rawBytes += (size_t)entry->width * entry->height * 4;
+    }
+    stats->maxBytes = history->maxBytes;
+    stats->compressed = history->compressed;
+    stats->meanCompressMs = history->compressed > 0 ? history->compressMs / history->compressed : 0.0;
+    stats->maxCompressMs = history->maxCompressMs;
+    stats->loads = history->loads;
+    stats->meanLoadMs = history->loads > 0 ? history->loadMs / history->loads : 0.0;
+    stats->maxLoadMs = history->maxLoadMs;
+    stats->evictions = history->evictions;
+    Unlock(&history->lock);
+}
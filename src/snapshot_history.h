@@ -0,0 +1,94 @@
+/**
+ * snapshot_history.h - 압축한 정지 화면 기록 (최근 확대 화면 다시 띄우기)
+ *
+ * 정지 확대를 닫을 때의 화면을 그때의 배율/확대 중심과 함께 순환 기록에 넣는다.
+ * 압축(snapshot_codec)은 배경 스레드가 하므로 넣는 쪽은 기다리지 않고,
+ * 압축이 끝나기 전에 꺼내면 원본을 그대로 복사한다.
+ * 개수나 메모리 한도를 넘으면 가장 오래된 기록부터 버린다.
+ * 꺼낼 때 쓰는 버퍼는 배경 스레드가 미리 만들어 페이지를 채워 두므로 풀기만 하면 된다.
+ * 플랫폼 독립 인터페이스 (Windows 스레드 / pthread)
+ */
+
+#ifndef LETSZOOM_SNAPSHOT_HISTORY_H
+#define LETSZOOM_SNAPSHOT_HISTORY_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "frame_source.h"
+#include "pixel_buffer.h"
+
+// 기록할 수 있는 최대 개수
+#define SNAPSHOT_HISTORY_MAX_ENTRIES 64
+
+// 화면과 함께 저장하는 확대 상태
+typedef struct {
+    float zoom;             // 확대 배율 (1.0 = 100%)
+    float centerX;          // 확대 중심 (스냅샷 좌표, 서브픽셀)
+    float centerY;
+} SnapshotView;
+
+// 기록 통계
+typedef struct {
+    int entries;                        // 보관 중인 스냅샷
+    int pending;                        // 압축을 기다리는 스냅샷
+    size_t bytes;                       // 보관 메모리 (압축 전이면 원본 크기)
+    size_t rawBytes;                    // 보관 중인 스냅샷의 원본 크기 합
+    size_t maxBytes;                    // 메모리 한도
+    unsigned long long compressed;      // 누적 압축 수
+    double meanCompressMs;              // 배경 스레드 압축 시간
+    double maxCompressMs;
+    unsigned long long loads;           // 누적 꺼낸 수
+    double meanLoadMs;                  // 꺼내기 (풀기) 시간
+    double maxLoadMs;
+    unsigned long long evictions;       // 한도를 넘어 버린 스냅샷
+} SnapshotHistoryStats;
+
+typedef struct SnapshotHistory SnapshotHistory;
+
+/**
+ * 기록 생성 (배경 압축 스레드 시작)
+ * maxEntries: 최대 개수 (1 - SNAPSHOT_HISTORY_MAX_ENTRIES), maxBytes: 보관 메모리 한도
+ */
+SnapshotHistory* SnapshotHistory_Create(int maxEntries, size_t maxBytes);
+
+/**
+ * 기록 파괴 (압축 중이면 끝날 때까지 기다림, 꺼낸 버퍼도 해제)
+ */
+void SnapshotHistory_Destroy(SnapshotHistory* history);
+
+/**
+ * 정지 화면 넣기
+ * still: 정지 화면 공급원 (소유권을 넘겨받음, 압축이 끝나면 파괴; 실패해도 파괴)
+ * 넣은 것이 가장 최근 기록(age 0)이 된다.
+ */
+bool SnapshotHistory_Push(SnapshotHistory* history, FrameSource* still, const SnapshotView* view);
+
+/**
+ * 보관 중인 스냅샷 수
+ */
+int SnapshotHistory_GetCount(SnapshotHistory* history);
+
+/**
+ * 스냅샷 꺼내기 (age: 0 = 가장 최근)
+ * 돌려주는 버퍼는 기록이 가지고 있으며 SnapshotHistory_Release 전까지 유효하다.
+ * 한 번에 하나만 꺼낼 수 있다 (이미 꺼냈으면 NULL).
+ */
+const PixelBuffer* SnapshotHistory_Load(SnapshotHistory* history, int age, SnapshotView* view);
+
+/**
+ * 꺼낸 버퍼 돌려주기 (다음 꺼내기에 재사용)
+ */
+void SnapshotHistory_Release(SnapshotHistory* history);
+
+/**
+ * 꺼내기 버퍼 해제 (유휴 시간이 지났을 때, 꺼낸 중이면 아무것도 안 함)
+ * 다음 꺼내기는 버퍼를 새로 만드는 시간만큼 느려진다.
+ */
+void SnapshotHistory_Trim(SnapshotHistory* history);
+
+/**
+ * 통계 가져오기
+ */
+void SnapshotHistory_GetStats(SnapshotHistory* history, SnapshotHistoryStats* stats);
+
+#endif // LETSZOOM_SNAPSHOT_HISTORY_H
@@ -0,0 +1,217 @@
+/**
+ * spotlight.c - 스포트라이트 마스크 구현
+ *
+ * 밝은 영역 경계까지의 거리 d = |max(|p - c| - 반크기, 0)| - 반지름을 픽셀 중심에서 재고,
+ * t = clamp(d / feather, 0, 1)의 smoothstep에 dim을 곱해 알파로 쓴다 (색은 검은색이라 0).
+ * 행마다 y 항은 상수이므로 x 방향 8개(AVX2)/4개(SSE2)씩 float로 계산한다.
+ * 곱셈/덧셈 순서가 같고 sqrt는 정확히 반올림되므로 스칼라와 결과가 같다.
+ */
+
+#include "spotlight.h"
+#include <math.h>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define SPOTLIGHT_HAVE_X86 1
+#include <immintrin.h>
+#define SSE2_TARGET __attribute__((target("sse2")))
+#define AVX2_TARGET __attribute__((target("avx2")))
+#else
+#define SPOTLIGHT_HAVE_X86 0
+#endif
+
+// 행 하나의 가장자리 계산에 필요한 상수
+typedef struct {
+    float offsetX;          // 0.5 - centerX (픽셀 x + offsetX = 중심에서 픽셀 중심까지)
+    float halfWidth;
+    float edgeY2;           // 이 행의 max(|dy| - halfHeight, 0)^2
+    float radius;
+    float invFeather;
+    float dim;
+} SpotlightRow;
+
+/**
+ * 바깥 픽셀 (미리 곱한 검은색)
+ */
+static inline uint32_t DimPixel(int dim)
+{
+    return (uint32_t)dim << 24;
+}
+
+/**
+ * 스칼라 가장자리 행 (x0부터 count개)
+ */
+static void EdgeRowScalar(uint32_t* out, int x0, int count, const SpotlightRow* r)
+{
+    for (int i = 0; i < count; i++) {
+        float dx = fabsf((float)(x0 + i) + r->offsetX) - r->halfWidth;
+        float ex = dx > 0.0f ? dx : 0.0f;
+        float d = sqrtf(ex * ex + r->edgeY2) - r->radius;
+        float t = d * r->invFeather;
+        t = t > 0.0f ? t : 0.0f;
+        t = t < 1.0f ? t : 1.0f;
+        float s = t * t * (3.0f - 2.0f * t);
+        out[i] = (uint32_t)(int)(s * r->dim + 0.5f) << 24;
+    }
+}
+
+#if SPOTLIGHT_HAVE_X86
+/**
+ * SSE2 가장자리 행 (4픽셀씩, 남은 픽셀은 스칼라)
+ */
+SSE2_TARGET static void EdgeRowSse2(uint32_t* out, int x0, int count, const SpotlightRow* r)
+{
+    const __m128 sign = _mm_set1_ps(-0.0f);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 two = _mm_set1_ps(2.0f);
+    const __m128 three = _mm_set1_ps(3.0f);
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 offsetX = _mm_set1_ps(r->offsetX);
+    const __m128 halfWidth = _mm_set1_ps(r->halfWidth);
+    const __m128 edgeY2 = _mm_set1_ps(r->edgeY2);
+    const __m128 radius = _mm_set1_ps(r->radius);
+    const __m128 invFeather = _mm_set1_ps(r->invFeather);
+    const __m128 dim = _mm_set1_ps(r->dim);
+
+    __m128i x = _mm_add_epi32(_mm_set1_epi32(x0), _mm_setr_epi32(0, 1, 2, 3));
+    int i = 0;
+
+    for (; i + 4 <= count; i += 4) {
+        __m128 dx = _mm_andnot_ps(sign, _mm_add_ps(_mm_cvtepi32_ps(x), offsetX));
+        __m128 ex = _mm_max_ps(_mm_sub_ps(dx, halfWidth), zero);
+        __m128 d = _mm_sub_ps(_mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(ex, ex), edgeY2)), radius);
+        __m128 t = _mm_min_ps(_mm_max_ps(_mm_mul_ps(d, invFeather), zero), one);
+        __m128 s = _mm_mul_ps(_mm_mul_ps(t, t), _mm_sub_ps(three, _mm_mul_ps(two, t)));
+        __m128i alpha = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(s, dim), half));
+        _mm_storeu_si128((__m128i*)(out + i), _mm_slli_epi32(alpha, 24));
+        x = _mm_add_epi32(x, _mm_set1_epi32(4));
+    }
+
+    EdgeRowScalar(out + i, x0 + i, count - i, r);
+}
+
+/**
+ * AVX2 가장자리 행 (8픽셀씩, 남은 픽셀은 SSE2)
+ */
+AVX2_TARGET static void EdgeRowAvx2(uint32_t* out, int x0, int count, const SpotlightRow* r)
+{
+    const __m256 sign = _mm256_set1_ps(-0.0f);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 two = _mm256_set1_ps(2.0f);
+    const __m256 three = _mm256_set1_ps(3.0f);
+    const __m256 half = _mm256_set1_ps(0.5f);
+    const __m256 offsetX = _mm256_set1_ps(r->offsetX);
+    const __m256 halfWidth = _mm256_set1_ps(r->halfWidth);
+    const __m256 edgeY2 = _mm256_set1_ps(r->edgeY2);
+    const __m256 radius = _mm256_set1_ps(r->radius);
+    const __m256 invFeather = _mm256_set1_ps(r->invFeather);
+    const __m256 dim = _mm256_set1_ps(r->dim);
+
+    __m256i x = _mm256_add_epi32(_mm256_set1_epi32(x0), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+    int i = 0;
+
+    for (; i + 8 <= count; i += 8) {
+        __m256 dx = _mm256_andnot_ps(sign, _mm256_add_ps(_mm256_cvtepi32_ps(x), offsetX));
+        __m256 ex = _mm256_max_ps(_mm256_sub_ps(dx, halfWidth), zero);
+        __m256 d = _mm256_sub_ps(_mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(ex, ex), edgeY2)), radius);
+        __m256 t = _mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(d, invFeather), zero), one);
+        __m256 s = _mm256_mul_ps(_mm256_mul_ps(t, t), _mm256_sub_ps(three, _mm256_mul_ps(two, t)));
+        __m256i alpha = _mm256_cvttps_epi32(_mm256_add_ps(_mm256_mul_ps(s, dim), half));
+        _mm256_storeu_si256((__m256i*)(out + i), _mm256_slli_epi32(alpha, 24));
+        x = _mm256_add_epi32(x, _mm256_set1_epi32(8));
+    }
+
+    EdgeRowSse2(out + i, x0 + i, count - i, r);
+}
+#endif
+
+/**
+ * 가장자리 행 (ISA 선택)
+ */
+static void EdgeRow(ScalerIsa isa, uint32_t* out, int x0, int count, const SpotlightRow* r)
+{
+#if SPOTLIGHT_HAVE_X86
+    if (isa == SCALER_ISA_AVX2) {
+        EdgeRowAvx2(out, x0, count, r);
+        return;
+    }
+    if (isa == SCALER_ISA_SSE2) {
+        EdgeRowSse2(out, x0, count, r);
+        return;
+    }
+#endif
+    (void)isa;
+    EdgeRowScalar(out, x0, count, r);
+}
+
+/**
+ * 행의 [left, right) 구간을 한 색으로
+ */
+static void FillSpan(uint32_t* row, int left, int right, uint32_t color)
+{
+    for (int x = left; x < right; x++) {
+        row[x] = color;
+    }
+}
+
+/**
+ * 마스크가 바깥 어둡기와 다를 수 있는 영역
+ */
+bool Spotlight_GetBounds(const SpotlightShape* shape, int width, int height, FrameRect* bounds)
+{
+    // 경계에서 feather만큼 떨어지면 t = 1 (바깥과 같음)
+    float extentX = shape->halfWidth + shape->radius + shape->feather;
+    float extentY = shape->halfHeight + shape->radius + shape->feather;
+
+    FrameRect box = {(int)floorf(shape->centerX - extentX), (int)floorf(shape->centerY - extentY),
+                     (int)ceilf(shape->centerX + extentX), (int)ceilf(shape->centerY + extentY)};
+    FrameRect layer = {0, 0, width, height};
+    return FrameRect_Intersect(bounds, &box, &layer);
+}
+
+/**
+ * rect 영역의 마스크 그리기
+ */
+void Spotlight_Render(ScalerIsa isa, const PixelBuffer* layer, const SpotlightShape* shape, const FrameRect* rect)
+{
+    FrameRect full = {0, 0, layer->width, layer->height};
+    FrameRect area;
+    if (!FrameRect_Intersect(&area, rect, &full)) {
+        return;
+    }
+
+    uint32_t dim = DimPixel(shape->dim);
+
+    // 가장자리 영역 (없으면 전부 바깥)
+    FrameRect edge;
+    if (!Spotlight_GetBounds(shape, layer->width, layer->height, &edge) ||
+        !FrameRect_Intersect(&edge, &edge, &area)) {
+        edge.left = edge.right = area.left;
+        edge.top = edge.bottom = area.top;
+    }
+
+    SpotlightRow r;
+    r.offsetX = 0.5f - shape->centerX;
+    r.halfWidth = shape->halfWidth;
+    r.radius = shape->radius;
+    r.invFeather = 1.0f / (shape->feather > 1.0f ? shape->feather : 1.0f);
+    r.dim = (float)shape->dim;
+
+    for (int y = area.top; y < area.bottom; y++) {
+        uint32_t* row = PixelBuffer_Row(layer, y);
+
+        if (y < edge.top || y >= edge.bottom) {
+            FillSpan(row, area.left, area.right, dim);
+            continue;
+        }
+
+        float dy = fabsf((float)y + 0.5f - shape->centerY) - shape->halfHeight;
+        float ey = dy > 0.0f ? dy : 0.0f;
+        r.edgeY2 = ey * ey;
+
+        FillSpan(row, area.left, edge.left, dim);
+        EdgeRow(isa, row + edge.left, edge.left, edge.right - edge.left, &r);
+        FillSpan(row, edge.right, area.right, dim);
+    }
+}
@@ -0,0 +1,40 @@
+/**
+ * spotlight.h - 스포트라이트 마스크 (커서 주변만 밝게, 나머지는 어둡게)
+ *
+ * 레이어드 창에 올릴 미리 곱한 BGRA 픽셀을 만든다. 바깥은 검은색을 dim 불투명도로 덮고,
+ * 밝은 영역(모서리가 둥근 사각형, 반너비/반높이가 0이면 원) 둘레 feather 폭에서
+ * smoothstep으로 부드럽게 밝아진다. 어둡게 섞는 일은 컴포지터가 하므로 화면을 캡처하지 않는다.
+ * 가장자리 계산은 SIMD(SSE2/AVX2)이며 ISA와 관계없이 값이 같다. (플랫폼 독립)
+ */
+
+#ifndef LETSZOOM_SPOTLIGHT_H
+#define LETSZOOM_SPOTLIGHT_H
+
+#include <stdbool.h>
+#include "frame_source.h"
+#include "pixel_buffer.h"
+#include "scaler.h"
+
+// 스포트라이트 모양 (버퍼 좌표)
+typedef struct {
+    float centerX;          // 중심 (서브픽셀)
+    float centerY;
+    float halfWidth;        // 둥근 모서리 안쪽 사각형 반너비 (원이면 0)
+    float halfHeight;
+    float radius;           // 모서리 반지름 (원이면 원의 반지름)
+    float feather;          // 부드러운 가장자리 폭 (1 이상)
+    int dim;                // 바깥 어둡기 (0-255, 검은색 불투명도)
+} SpotlightShape;
+
+/**
+ * 마스크가 바깥 어둡기와 다를 수 있는 영역 (버퍼 안으로 자름, 버퍼 밖이면 false)
+ */
+bool Spotlight_GetBounds(const SpotlightShape* shape, int width, int height, FrameRect* bounds);
+
+/**
+ * rect 영역의 마스크 그리기 (가장자리 영역만 커널로 계산하고 나머지는 채우기)
+ * 커서를 따라 움직일 때는 직전 영역과 새 영역을 합친 rect만 다시 그리면 된다.
+ */
+void Spotlight_Render(ScalerIsa isa, const PixelBuffer* layer, const SpotlightShape* shape, const FrameRect* rect);
+
+#endif // LETSZOOM_SPOTLIGHT_H
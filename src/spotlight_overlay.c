@@ -0,0 +1,492 @@
+/**
+ * spotlight_overlay.c - 스포트라이트 오버레이 구현
+ *
+ * 마스크는 모니터 크기 DIB 하나에 남아 있으므로 커서가 움직이면 직전 가장자리 영역과
+ * 새 가장자리 영역을 합친 사각형만 다시 그리고, UpdateLayeredWindowIndirect에도
+ * 그 사각형만 넘겨 컴포지터로 올리는 양을 줄인다. 커서가 멈춘 주기에는 아무것도 하지 않는다.
+ */
+
+#include "spotlight_overlay.h"
+#include "dib_buffer.h"
+#include "frame_pacer.h"
+#include "monitor.h"
+#include "residency.h"
+#include "spotlight.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+// 윈도우 클래스 이름
+#define SPOTLIGHT_CLASS_NAME L"LetsZoomSpotlightWindow"
+
+#define WM_SPOTLIGHT_FRAME (WM_APP + 1)     // 프레임 신호 (페이서 → 창)
+
+// 타이머 ID (페이서를 만들 수 없을 때)
+#define TIMER_UPDATE 1
+#define UPDATE_INTERVAL 16  // ~60 FPS
+
+// 부드러운 가장자리 폭 (크기에 대한 비율)
+#define FEATHER_RATIO 0.35f
+
+// 사각형 모양의 가로 배율 (높이의 절반 × 이 값 = 너비의 절반)
+#define RECT_ASPECT 4.0f
+
+// 전역 변수
+static HINSTANCE g_hInstance = NULL;
+static HWND g_hwndSpot = NULL;
+static bool g_bActive = false;
+
+// 모양 설정
+static bool g_rectangle = false;
+static int g_size = 150;                    // 96 DPI 기준 픽셀
+static int g_dimPercent = 70;
+
+// 모니터와 마스크 레이어
+static MonitorInfo g_monitor = {0};
+static DibBuffer g_layer = {0};             // 모니터 크기 미리 곱한 BGRA (창과 함께 상주)
+static ScalerIsa g_isa = SCALER_ISA_SCALAR;
+static FramePacer* g_pacer = NULL;
+
+// 직전 프레임
+static bool g_fullRedraw = true;            // 레이어 전체를 다시 그려야 함 (새 레이어, 설정 변경)
+static bool g_hasEdge = false;
+static FrameRect g_lastEdge = {0};          // 직전 가장자리 영역 (레이어 좌표)
+static POINT g_lastCursor = {0};
+
+// 프레임 비용
+static SpotlightStats g_stats = {0};
+
+// 닫은 뒤 창과 레이어를 남겨 두는 상주 관리
+static ResidencyClient g_residency = {0};
+
+/**
+ * 레이어 생성 (g_monitor 크기)
+ */
+static bool CreateLayer(void)
+{
+    int width = g_monitor.bounds.right - g_monitor.bounds.left;
+    int height = g_monitor.bounds.bottom - g_monitor.bounds.top;
+    if (g_layer.hdc && g_layer.pixels.width == width && g_layer.pixels.height == height) {
+        return true;
+    }
+
+    DibBuffer_Destroy(&g_layer);
+    if (!DibBuffer_Create(&g_layer, width, height)) {
+        OutputDebugStringW(L"[SpotlightOverlay] Failed to create layer buffer\n");
+        return false;
+    }
+
+    g_fullRedraw = true;
+    return true;
+}
+
+/**
+ * 남겨 둔 창과 레이어 해제 (유휴 시간이 지났거나 종료할 때)
+ */
+static void ReleaseResidentResources(void)
+{
+    if (g_hwndSpot) {
+        DestroyWindow(g_hwndSpot);
+        g_hwndSpot = NULL;
+    }
+
+    DibBuffer_Destroy(&g_layer);
+    OutputDebugStringW(L"[SpotlightOverlay] Resident resources released\n");
+}
+
+/**
+ * 커서 위치의 스포트라이트 모양 (레이어 좌표)
+ */
+static SpotlightShape BuildShape(POINT cursor)
+{
+    float size = (float)Monitor_Scale(&g_monitor, g_size);
+
+    SpotlightShape shape;
+    shape.centerX = (float)(cursor.x - g_monitor.bounds.left) + 0.5f;
+    shape.centerY = (float)(cursor.y - g_monitor.bounds.top) + 0.5f;
+    shape.feather = fmaxf(size * FEATHER_RATIO, 1.0f);
+    if (g_rectangle) {
+        shape.halfWidth = size * RECT_ASPECT;
+        shape.halfHeight = size;
+        shape.radius = 0.0f;
+    } else {
+        shape.halfWidth = 0.0f;
+        shape.halfHeight = 0.0f;
+        shape.radius = size;
+    }
+    shape.dim = (g_dimPercent * 255 + 50) / 100;
+    return shape;
+}
+
+/**
+ * 사각형 합치기 (경계 사각형)
+ */
+static void MergeRect(FrameRect* target, const FrameRect* rect)
+{
+    if (rect->left < target->left) target->left = rect->left;
+    if (rect->top < target->top) target->top = rect->top;
+    if (rect->right > target->right) target->right = rect->right;
+    if (rect->bottom > target->bottom) target->bottom = rect->bottom;
+}
+
+/**
+ * 레이어의 바뀐 영역을 창에 올리기
+ */
+static bool PresentLayer(const FrameRect* dirty)
+{
+    POINT ptDst = {g_monitor.bounds.left, g_monitor.bounds.top};
+    POINT ptSrc = {0, 0};
+    SIZE size = {g_layer.pixels.width, g_layer.pixels.height};
+    BLENDFUNCTION blend = {AC_SRC_OVER, 0, 255, AC_SRC_ALPHA};
+    RECT dirtyRect = {dirty->left, dirty->top, dirty->right, dirty->bottom};
+
+    UPDATELAYEREDWINDOWINFO info = {0};
+    info.cbSize = sizeof(info);
+    info.pptDst = &ptDst;
+    info.psize = &size;
+    info.hdcSrc = g_layer.hdc;
+    info.pptSrc = &ptSrc;
+    info.pblend = &blend;
+    info.dwFlags = ULW_ALPHA;
+    info.prcDirty = &dirtyRect;
+
+    return UpdateLayeredWindowIndirect(g_hwndSpot, &info) != FALSE;
+}
+
+/**
+ * 통계에 프레임 하나 추가
+ */
+static void AddFrameStats(double renderMs, double presentMs, const FrameRect* dirty)
+{
+    SpotlightStats* s = &g_stats;
+    double pixels = (double)(dirty->right - dirty->left) * (dirty->bottom - dirty->top);
+
+    s->frames++;
+    s->meanRenderMs += (renderMs - s->meanRenderMs) / (double)s->frames;
+    s->meanPresentMs += (presentMs - s->meanPresentMs) / (double)s->frames;
+    s->meanPixels += (pixels - s->meanPixels) / (double)s->frames;
+    if (renderMs > s->maxRenderMs) s->maxRenderMs = renderMs;
+    if (presentMs > s->maxPresentMs) s->maxPresentMs = presentMs;
+}
+
+/**
+ * 커서가 다른 모니터로 가면 창과 레이어를 그 모니터로 옮김
+ */
+static bool FollowCursorMonitor(POINT cursor)
+{
+    if (MonitorFromPoint(cursor, MONITOR_DEFAULTTONEAREST) == g_monitor.handle) {
+        return true;
+    }
+
+    OutputDebugStringW(L"[SpotlightOverlay] Cursor moved to another monitor\n");
+    if (!Monitor_FromPoint(cursor, &g_monitor) || !CreateLayer()) {
+        return false;
+    }
+
+    // 새 모니터의 주사율에 맞춘 프레임 신호
+    if (g_pacer) {
+        FramePacer_Destroy(g_pacer);
+        g_pacer = FramePacer_Create(g_hwndSpot, WM_SPOTLIGHT_FRAME);
+        if (g_pacer) {
+            FramePacer_SetContinuous(g_pacer, true);
+        } else {
+            SetTimer(g_hwndSpot, TIMER_UPDATE, UPDATE_INTERVAL, NULL);
+        }
+    }
+
+    g_fullRedraw = true;
+    return true;
+}
+
+/**
+ * 커서를 따라 마스크 갱신 (커서가 그대로면 아무것도 안 함)
+ */
+static void UpdateSpotlight(void)
+{
+    POINT cursor;
+    GetCursorPos(&cursor);
+    if (!g_fullRedraw && cursor.x == g_lastCursor.x && cursor.y == g_lastCursor.y) {
+        return;
+    }
+
+    if (!FollowCursorMonitor(cursor)) {
+        SpotlightOverlay_Hide();
+        return;
+    }
+
+    double start = FramePacer_Now();
+    SpotlightShape shape = BuildShape(cursor);
+    FrameRect edge;
+    bool hasEdge = Spotlight_GetBounds(&shape, g_layer.pixels.width, g_layer.pixels.height, &edge);
+
+    // 다시 그릴 영역: 처음이면 전체, 아니면 직전 가장자리 + 새 가장자리
+    FrameRect dirty = {0, 0, g_layer.pixels.width, g_layer.pixels.height};
+    if (!g_fullRedraw) {
+        if (g_hasEdge) {
+            dirty = g_lastEdge;
+            if (hasEdge) MergeRect(&dirty, &edge);
+        } else if (hasEdge) {
+            dirty = edge;
+        } else {
+            dirty.right = dirty.left;
+        }
+    }
+
+    if (dirty.right > dirty.left && dirty.bottom > dirty.top) {
+        Spotlight_Render(g_isa, &g_layer.pixels, &shape, &dirty);
+        double rendered = FramePacer_Now();
+
+        if (!PresentLayer(&dirty)) {
+            OutputDebugStringW(L"[SpotlightOverlay] Failed to update layered window\n");
+        }
+        AddFrameStats(rendered - start, FramePacer_Now() - rendered, &dirty);
+    }
+
+    g_fullRedraw = false;
+    g_hasEdge = hasEdge;
+    g_lastEdge = edge;
+    g_lastCursor = cursor;
+}
+
+/**
+ * 스포트라이트 윈도우 프로시저
+ */
+static LRESULT CALLBACK SpotlightWndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam)
+{
+    switch (msg) {
+        case WM_CREATE:
+            OutputDebugStringW(L"[SpotlightOverlay] Window created\n");
+            return 0;
+
+        case WM_SPOTLIGHT_FRAME:
+            UpdateSpotlight();
+            FramePacer_FrameDone(g_pacer);
+            return 0;
+
+        case WM_TIMER:
+            if (wParam == TIMER_UPDATE) {
+                UpdateSpotlight();
+            }
+            return 0;
+
+        case WM_DESTROY:
+            OutputDebugStringW(L"[SpotlightOverlay] Window destroyed\n");
+            return 0;
+
+        default:
+            return DefWindowProc(hwnd, msg, wParam, lParam);
+    }
+}
+
+/**
+ * 스포트라이트 윈도우 클래스 등록
+ */
+static bool RegisterSpotlightWindow(HINSTANCE hInstance)
+{
+    WNDCLASSEXW wc = {0};
+
+    wc.cbSize = sizeof(WNDCLASSEXW);
+    wc.lpfnWndProc = SpotlightWndProc;
+    wc.hInstance = hInstance;
+    wc.hCursor = LoadCursor(NULL, IDC_ARROW);
+    wc.lpszClassName = SPOTLIGHT_CLASS_NAME;
+
+    if (!RegisterClassExW(&wc)) {
+        DWORD error = GetLastError();
+        if (error != ERROR_CLASS_ALREADY_EXISTS) {
+            OutputDebugStringW(L"[SpotlightOverlay] Failed to register window class\n");
+            return false;
+        }
+    }
+
+    OutputDebugStringW(L"[SpotlightOverlay] Window class registered\n");
+    return true;
+}
+
+/**
+ * 스포트라이트 오버레이 초기화
+ */
+bool SpotlightOverlay_Initialize(HINSTANCE hInstance)
+{
+    if (g_hInstance) {
+        return true;  // 이미 초기화됨
+    }
+
+    g_hInstance = hInstance;
+
+    if (!RegisterSpotlightWindow(hInstance)) {
+        g_hInstance = NULL;
+        return false;
+    }
+
+    g_isa = Scaler_DetectIsa();
+    g_residency.name = L"spotlight";
+    g_residency.release = ReleaseResidentResources;
+
+    OutputDebugStringW(L"[SpotlightOverlay] Initialized\n");
+    return true;
+}
+
+/**
+ * 스포트라이트 오버레이 정리
+ */
+void SpotlightOverlay_Shutdown(void)
+{
+    if (g_bActive) {
+        SpotlightOverlay_Hide();
+    }
+
+    // 남겨 둔 창/레이어 해제 (클래스 등록 해제 전에 창부터)
+    Residency_ReleaseNow(&g_residency);
+
+    if (g_hInstance) {
+        UnregisterClassW(SPOTLIGHT_CLASS_NAME, g_hInstance);
+        g_hInstance = NULL;
+    }
+
+    OutputDebugStringW(L"[SpotlightOverlay] Shutdown\n");
+}
+
+/**
+ * 스포트라이트 시작
+ */
+bool SpotlightOverlay_Show(void)
+{
+    if (g_bActive) {
+        return true;  // 이미 활성화됨
+    }
+
+    OutputDebugStringW(L"[SpotlightOverlay] Showing spotlight\n");
+
+    POINT cursor;
+    GetCursorPos(&cursor);
+    if (!Monitor_FromPoint(cursor, &g_monitor)) {
+        OutputDebugStringW(L"[SpotlightOverlay] Failed to get monitor info\n");
+        return false;
+    }
+
+    // 남겨 둔 창/레이어가 있으면 재사용 (모니터 크기가 다르면 레이어만 다시)
+    Residency_Activate(&g_residency, g_hwndSpot != NULL);
+
+    if (!CreateLayer()) {
+        ReleaseResidentResources();
+        return false;
+    }
+
+    // 클릭 투과, 포커스를 가져가지 않는 레이어드 창 (모니터 전체)
+    if (!g_hwndSpot) {
+        g_hwndSpot = CreateWindowExW(
+            WS_EX_TOPMOST | WS_EX_LAYERED | WS_EX_TRANSPARENT | WS_EX_TOOLWINDOW | WS_EX_NOACTIVATE,
+            SPOTLIGHT_CLASS_NAME,
+            L"LetsZoom Spotlight",
+            WS_POPUP,
+            g_monitor.bounds.left, g_monitor.bounds.top,
+            g_layer.pixels.width, g_layer.pixels.height,
+            NULL, NULL,
+            g_hInstance,
+            NULL
+        );
+
+        if (!g_hwndSpot) {
+            OutputDebugStringW(L"[SpotlightOverlay] Failed to create window\n");
+            ReleaseResidentResources();
+            return false;
+        }
+    }
+
+    // 첫 프레임은 레이어 전체 (보이기 전에 올려 두어 지난 세션 내용이 비치지 않게)
+    memset(&g_stats, 0, sizeof(g_stats));
+    g_fullRedraw = true;
+    g_hasEdge = false;
+    UpdateSpotlight();
+
+    ShowWindow(g_hwndSpot, SW_SHOWNOACTIVATE);
+    Residency_FrameShown(&g_residency);
+
+    // 창이 있는 모니터의 디스플레이 주기마다 (실패하면 일반 타이머)
+    g_pacer = FramePacer_Create(g_hwndSpot, WM_SPOTLIGHT_FRAME);
+    if (g_pacer) {
+        FramePacer_SetContinuous(g_pacer, true);
+    } else {
+        SetTimer(g_hwndSpot, TIMER_UPDATE, UPDATE_INTERVAL, NULL);
+    }
+
+    g_bActive = true;
+
+    OutputDebugStringW(L"[SpotlightOverlay] Spotlight shown\n");
+    return true;
+}
+
+/**
+ * 스포트라이트 종료
+ */
+void SpotlightOverlay_Hide(void)
+{
+    if (!g_bActive) {
+        return;
+    }
+
+    OutputDebugStringW(L"[SpotlightOverlay] Hiding spotlight\n");
+
+    // 프레임 신호 중지
+    if (g_pacer) {
+        FramePacer_Destroy(g_pacer);
+        g_pacer = NULL;
+    } else if (g_hwndSpot) {
+        KillTimer(g_hwndSpot, TIMER_UPDATE);
+    }
+
+    // 윈도우는 숨기기만 (다음 활성화에 재사용, 유휴 시간이 지나면 상주 관리가 해제)
+    if (g_hwndSpot) {
+        ShowWindow(g_hwndSpot, SW_HIDE);
+    }
+
+    g_bActive = false;
+
+    // 프레임 비용 (그리기 + 창 갱신, 커서가 움직인 프레임만)
+    if (g_stats.frames > 0) {
+        WCHAR msg[256];
+        swprintf_s(msg, 256, L"[SpotlightOverlay] %llu frames, render mean %.3f ms (max %.3f), present mean %.3f ms (max %.3f), %.0f px/frame\n",
+                   g_stats.frames, g_stats.meanRenderMs, g_stats.maxRenderMs,
+                   g_stats.meanPresentMs, g_stats.maxPresentMs, g_stats.meanPixels);
+        OutputDebugStringW(msg);
+    }
+
+    // 유지 시간 뒤 창/레이어 해제 예약 (유지 시간이 0이면 바로 해제)
+    Residency_Deactivate(&g_residency);
+
+    OutputDebugStringW(L"[SpotlightOverlay] Spotlight hidden\n");
+}
+
+/**
+ * 스포트라이트 활성 상태 확인
+ */
+bool SpotlightOverlay_IsActive(void)
+{
+    return g_bActive;
+}
+
+/**
+ * 모양 설정
+ */
+void SpotlightOverlay_SetStyle(bool rectangle, int size, int dimPercent)
+{
+    if (size < 20) size = 20;
+    if (size > 800) size = 800;
+    if (dimPercent < 0) dimPercent = 0;
+    if (dimPercent > 100) dimPercent = 100;
+
+    g_rectangle = rectangle;
+    g_size = size;
+    g_dimPercent = dimPercent;
+    g_fullRedraw = true;
+}
+
+/**
+ * 프레임 비용 통계
+ */
+void SpotlightOverlay_GetStats(SpotlightStats* stats)
+{
+    if (!stats) return;
+    *stats = g_stats;
+}
@@ -0,0 +1,63 @@
+/**
+ * spotlight_overlay.h - 스포트라이트 오버레이 (커서 주변만 밝게, 나머지 화면은 어둡게)
+ *
+ * 커서가 있는 모니터를 덮는 클릭 투과 레이어드 창에 스포트라이트 마스크를 올린다.
+ * 디스플레이 주기마다 커서를 따라가며, 직전 위치와 새 위치의 가장자리 영역만 다시 그려 올린다.
+ * 어둡게 섞는 일은 컴포지터가 하므로 화면을 캡처하지 않고, 아래 창은 그대로 조작할 수 있다.
+ */
+
+#ifndef LETSZOOM_SPOTLIGHT_OVERLAY_H
+#define LETSZOOM_SPOTLIGHT_OVERLAY_H
+
+#include <windows.h>
+#include <stdbool.h>
+
+// 프레임 비용 (마지막 스포트라이트 세션)
+typedef struct {
+    unsigned long long frames;      // 다시 그린 프레임 (커서가 멈춘 주기는 제외)
+    double meanRenderMs;            // 마스크 그리기
+    double maxRenderMs;
+    double meanPresentMs;           // 레이어드 창 갱신 (바뀐 영역만)
+    double maxPresentMs;
+    double meanPixels;              // 프레임당 다시 그린 픽셀
+} SpotlightStats;
+
+/**
+ * 스포트라이트 오버레이 초기화
+ */
+bool SpotlightOverlay_Initialize(HINSTANCE hInstance);
+
+/**
+ * 스포트라이트 오버레이 정리
+ */
+void SpotlightOverlay_Shutdown(void);
+
+/**
+ * 스포트라이트 시작 (커서가 있는 모니터)
+ */
+bool SpotlightOverlay_Show(void);
+
+/**
+ * 스포트라이트 종료
+ */
+void SpotlightOverlay_Hide(void);
+
+/**
+ * 스포트라이트 활성 상태 확인
+ */
+bool SpotlightOverlay_IsActive(void);
+
+/**
+ * 모양 설정 (켜져 있으면 다음 프레임부터 적용)
+ * rectangle: false면 원, true면 가로로 긴 사각형 (읽는 줄 강조)
+ * size: 원의 반지름 / 사각형 높이의 절반 (20-800, 96 DPI 기준 픽셀)
+ * dimPercent: 바깥 어둡기 (0-100%)
+ */
+void SpotlightOverlay_SetStyle(bool rectangle, int size, int dimPercent);
+
+/**
+ * 프레임 비용 통계 (켜져 있으면 지금까지, 아니면 마지막 세션)
+ */
+void SpotlightOverlay_GetStats(SpotlightStats* stats);
+
+#endif // LETSZOOM_SPOTLIGHT_OVERLAY_H
@@ -0,0 +1,266 @@
+/**
+ * tile_cache.c - 확대 타일 LRU 캐시 구현
+ */
+
+#include "tile_cache.h"
+#include <stdlib.h>
+#include <string.h>
+
+// 해시 버킷 수 (2의 거듭제곱)
+#define TILE_BUCKETS 1024
+
+typedef struct TileEntry TileEntry;
+
+struct TileEntry {
+    TileKey key;
+    FrameRect source;
+    PixelBuffer pixels;
+    TileEntry* hashNext;
+    TileEntry* lruPrev;     // 최근 사용 쪽
+    TileEntry* lruNext;     // 오래된 쪽
+};
+
+struct TileCache {
+    TileEntry* buckets[TILE_BUCKETS];
+    TileEntry* lruHead;     // 가장 최근 사용
+    TileEntry* lruTail;     // 가장 오래됨
+    TileEntry* freeList;    // 버퍼를 가진 채 쉬고 있는 항목 (lruNext로 연결)
+    size_t tileBytes;
+    size_t maxBytes;
+    size_t allocatedBytes;
+    TileCacheStats stats;
+};
+
+static unsigned int HashKey(const TileKey* key)
+{
+    uint32_t zoomBits;
+    memcpy(&zoomBits, &key->zoom, sizeof(zoomBits));
+
+    uint32_t h = (uint32_t)key->tileX * 0x9E3779B1u;
+    h ^= (uint32_t)key->tileY * 0x85EBCA77u;
+    h ^= zoomBits * 0xC2B2AE3Du;
+    h ^= (uint32_t)key->filter;
+    h ^= (uint32_t)key->color << 4;
+    h ^= (uint32_t)key->linearLight << 8;
+    h ^= h >> 15;
+    return h & (TILE_BUCKETS - 1);
+}
+
+static bool KeyEquals(const TileKey* a, const TileKey* b)
+{
+    return a->tileX == b->tileX && a->tileY == b->tileY &&
+           a->zoom == b->zoom && a->filter == b->filter && a->color == b->color &&
+           a->linearLight == b->linearLight;
+}
+
+static void LruUnlink(TileCache* cache, TileEntry* entry)
+{
+    if (entry->lruPrev) entry->lruPrev->lruNext = entry->lruNext;
+    else cache->lruHead = entry->lruNext;
+
+    if (entry->lruNext) entry->lruNext->lruPrev = entry->lruPrev;
+    else cache->lruTail = entry->lruPrev;
+
+    entry->lruPrev = entry->lruNext = NULL;
+}
+
+static void LruPushFront(TileCache* cache, TileEntry* entry)
+{
+    entry->lruPrev = NULL;
+    entry->lruNext = cache->lruHead;
+    if (cache->lruHead) cache->lruHead->lruPrev = entry;
+    cache->lruHead = entry;
+    if (!cache->lruTail) cache->lruTail = entry;
+}
+
+static void HashUnlink(TileCache* cache, TileEntry* entry)
+{
+    TileEntry** link = &cache->buckets[HashKey(&entry->key)];
+    while (*link && *link != entry) {
+        link = &(*link)->hashNext;
+    }
+    if (*link) {
+        *link = entry->hashNext;
+    }
+    entry->hashNext = NULL;
+}
+
+static TileEntry* Find(const TileCache* cache, const TileKey* key)
+{
+    TileEntry* entry = cache->buckets[HashKey(key)];
+    while (entry && !KeyEquals(&entry->key, key)) {
+        entry = entry->hashNext;
+    }
+    return entry;
+}
+
+/**
+ * 항목을 캐시에서 빼서 쉬는 목록으로 (버퍼는 유지)
+ */
+static void Retire(TileCache* cache, TileEntry* entry)
+{
+    HashUnlink(cache, entry);
+    LruUnlink(cache, entry);
+    entry->lruNext = cache->freeList;
+    cache->freeList = entry;
+    cache->stats.tiles--;
+}
+
+/**
+ * 캐시 생성
+ */
+TileCache* TileCache_Create(size_t maxBytes)
+{
+    TileCache* cache = (TileCache*)calloc(1, sizeof(TileCache));
+    if (!cache) return NULL;
+
+    cache->tileBytes = (size_t)TILE_SIZE * TILE_SIZE * 4;
+    cache->maxBytes = maxBytes < cache->tileBytes ? cache->tileBytes : maxBytes;
+    cache->stats.maxBytes = cache->maxBytes;
+    return cache;
+}
+
+/**
+ * 캐시 파괴
+ */
+void TileCache_Destroy(TileCache* cache)
+{
+    if (!cache) return;
+
+    TileCache_Clear(cache);
+
+    TileEntry* entry = cache->freeList;
+    while (entry) {
+        TileEntry* next = entry->lruNext;
+        PixelBuffer_Free(&entry->pixels);
+        free(entry);
+        entry = next;
+    }
+
+    free(cache);
+}
+
+/**
+ * 타일 찾기
+ */
+const PixelBuffer* TileCache_Lookup(TileCache* cache, const TileKey* key)
+{
+    TileEntry* entry = Find(cache, key);
+    if (!entry) {
+        cache->stats.misses++;
+        return NULL;
+    }
+
+    cache->stats.hits++;
+    if (entry != cache->lruHead) {
+        LruUnlink(cache, entry);
+        LruPushFront(cache, entry);
+    }
+    return &entry->pixels;
+}
+
+/**
+ * 새 타일 자리 확보
+ */
+const PixelBuffer* TileCache_Insert(TileCache* cache, const TileKey* key, const FrameRect* source)
+{
+    TileEntry* entry = Find(cache, key);
+    if (entry) {
+        Retire(cache, entry);
+    }
+
+    // 쉬는 항목 → 새 할당 → 가장 오래된 타일 순으로 사용
+    if (cache->freeList) {
+        entry = cache->freeList;
+        cache->freeList = entry->lruNext;
+        entry->lruNext = NULL;
+    } else if (cache->allocatedBytes + cache->tileBytes <= cache->maxBytes || !cache->lruTail) {
+        entry = (TileEntry*)calloc(1, sizeof(TileEntry));
+        if (!entry) return NULL;
+
+        if (!PixelBuffer_Alloc(&entry->pixels, TILE_SIZE, TILE_SIZE)) {
+            free(entry);
+            return NULL;
+        }
+        cache->allocatedBytes += cache->tileBytes;
+    } else {
+        entry = cache->lruTail;
+        HashUnlink(cache, entry);
+        LruUnlink(cache, entry);
+        cache->stats.tiles--;
+        cache->stats.evictions++;
+    }
+
+    entry->key = *key;
+    entry->source = *source;
+
+    unsigned int bucket = HashKey(key);
+    entry->hashNext = cache->buckets[bucket];
+    cache->buckets[bucket] = entry;
+    LruPushFront(cache, entry);
+    cache->stats.tiles++;
+
+    return &entry->pixels;
+}
+
+/**
+ * 타일 제거
+ */
+void TileCache_Remove(TileCache* cache, const TileKey* key)
+{
+    TileEntry* entry = Find(cache, key);
+    if (entry) {
+        Retire(cache, entry);
+    }
+}
+
+/**
+ * 소스 영역이 겹치는 타일 제거
+ */
+int TileCache_InvalidateRect(TileCache* cache, const FrameRect* rect)
+{
+    int removed = 0;
+    TileEntry* entry = cache->lruHead;
+
+    while (entry) {
+        TileEntry* next = entry->lruNext;
+        if (FrameRect_Intersects(&entry->source, rect)) {
+            Retire(cache, entry);
+            removed++;
+        }
+        entry = next;
+    }
+
+    cache->stats.invalidations += removed;
+    return removed;
+}
+
+/**
+ * 모든 타일 제거
+ */
+void TileCache_Clear(TileCache* cache)
+{
+    while (cache->lruHead) {
+        Retire(cache, cache->lruHead);
+    }
+}
+
+/**
+ * 통계 가져오기
+ */
+void TileCache_GetStats(const TileCache* cache, TileCacheStats* stats)
+{
+    *stats = cache->stats;
+    stats->bytes = cache->allocatedBytes;
+}
+
+/**
+ * 통계 초기화
+ */
+void TileCache_ResetStats(TileCache* cache)
+{
+    int tiles = cache->stats.tiles;
+    memset(&cache->stats, 0, sizeof(TileCacheStats));
+    cache->stats.tiles = tiles;
+    cache->stats.maxBytes = cache->maxBytes;
+}
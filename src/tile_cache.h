@@ -0,0 +1,88 @@
+/**
+ * tile_cache.h - 확대 타일 LRU 캐시
+ *
+ * 확대 결과를 고정 크기 타일로 나누어 (타일 위치, 배율, 필터)별로 보관한다.
+ * 타일 위치는 "확대된 데스크톱" 좌표 격자 기준이라 패닝해도 같은 타일이 재사용된다.
+ * 플랫폼 독립 코드
+ */
+
+#ifndef LETSZOOM_TILE_CACHE_H
+#define LETSZOOM_TILE_CACHE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "frame_source.h"
+#include "pixel_buffer.h"
+#include "scaler.h"
+
+// 타일 한 변 (출력 픽셀)
+#define TILE_SIZE 256
+
+// 타일 키
+typedef struct {
+    int tileX;              // 확대 좌표 / TILE_SIZE
+    int tileY;
+    float zoom;
+    ScaleFilter filter;
+    ColorFilter color;
+    bool linearLight;
+} TileKey;
+
+// 캐시 통계
+typedef struct {
+    unsigned long long hits;
+    unsigned long long misses;
+    unsigned long long evictions;
+    unsigned long long invalidations;   // 화면 변경으로 버린 타일
+    int tiles;                          // 현재 보관 중인 타일 수
+    size_t bytes;                       // 현재 타일 메모리
+    size_t maxBytes;                    // 메모리 한도
+} TileCacheStats;
+
+typedef struct TileCache TileCache;
+
+/**
+ * 캐시 생성 (maxBytes: 타일 메모리 한도)
+ */
+TileCache* TileCache_Create(size_t maxBytes);
+
+/**
+ * 캐시 파괴
+ */
+void TileCache_Destroy(TileCache* cache);
+
+/**
+ * 타일 찾기 (있으면 가장 최근 사용으로 표시)
+ */
+const PixelBuffer* TileCache_Lookup(TileCache* cache, const TileKey* key);
+
+/**
+ * 새 타일 자리 확보 (한도를 넘으면 가장 오래된 타일을 재사용)
+ * source: 타일이 읽는 소스 영역 (데스크톱 좌표, 변경 시 무효화용)
+ * 반환된 버퍼에 호출자가 확대 결과를 쓴다.
+ */
+const PixelBuffer* TileCache_Insert(TileCache* cache, const TileKey* key, const FrameRect* source);
+
+/**
+ * 타일 제거 (확대 실패 시)
+ */
+void TileCache_Remove(TileCache* cache, const TileKey* key);
+
+/**
+ * 소스 영역이 rect와 겹치는 타일 모두 제거 (화면 내용 변경)
+ * 제거한 타일 수 반환
+ */
+int TileCache_InvalidateRect(TileCache* cache, const FrameRect* rect);
+
+/**
+ * 모든 타일 제거
+ */
+void TileCache_Clear(TileCache* cache);
+
+/**
+ * 통계 가져오기 / 초기화 (보관 중인 타일은 그대로)
+ */
+void TileCache_GetStats(const TileCache* cache, TileCacheStats* stats);
+void TileCache_ResetStats(TileCache* cache);
+
+#endif // LETSZOOM_TILE_CACHE_H
@@ -0,0 +1,501 @@
+/**
+ * tile_hash.c - 타일 내용 해시 구현
+ *
+ * 64바이트(16픽셀) 줄무늬마다 64비트 레인 8개에 (데이터 ^ 키)의 상하위 32비트 곱과
+ * 이웃 레인의 데이터를 더하고, 행이 끝날 때마다 레인을 섞는다 (xxh3 누적 방식).
+ * 곱셈이 32x32→64비트라 SSE2의 pmuludq로 그대로 계산되어 ISA별 결과가 같다.
+ * 해시는 바뀐 곳 찾기용이며 암호학적 용도가 아니다.
+ */
+
+#include "tile_hash.h"
+#include "worker_pool.h"
+#include <stdlib.h>
+#include <string.h>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define TILE_HASH_HAVE_X86 1
+#include <immintrin.h>
+#define SSE2_TARGET __attribute__((target("sse2")))
+#define AVX2_TARGET __attribute__((target("avx2")))
+#else
+#define TILE_HASH_HAVE_X86 0
+#endif
+
+// 줄무늬 (한 번에 누적하는 픽셀 수, 64비트 레인 8개)
+#define STRIPE_PIXELS 16
+#define STRIPE_BYTES (STRIPE_PIXELS * 4)
+#define STRIPE_LANES 8
+
+// 타일 한 행의 줄무늬 수
+#define TILE_STRIPES (TILE_HASH_SIZE / STRIPE_PIXELS)
+
+// 행 끝 섞기 곱수 (32비트 소수)
+#define SCRAMBLE_PRIME 0x9E3779B1u
+
+// 줄무늬 위치별 키 (같은 행의 줄무늬가 서로 바뀌어도 해시가 달라지도록)
+static const uint64_t g_stripeKeys[TILE_STRIPES][STRIPE_LANES] = {
+    {0x183CF2B72B173ABBULL, 0x0CADCA65C401DA69ULL, 0x975DAAE328ACFA57ULL, 0x8C4ECF10E70C46C8ULL,
+     0xA23923AECA706C5FULL, 0xF2D099A966649598ULL, 0x9D4A356E08CEFAF1ULL, 0x764DFFED0A6FF331ULL},
+    {0x3598243375B4985FULL, 0xEA7E7EA19E922D87ULL, 0xB3100955427790EEULL, 0x7910B49B564A4B8DULL,
+     0x694084BA31B58556ULL, 0x5DC32A157F804579ULL, 0xA3520B212C6E3DCBULL, 0xF5FC3DCBBF925BE8ULL},
+    {0xEA8FB0D1FDC8D1E5ULL, 0x21FD577EF1410B44ULL, 0xD235DF4C69363805ULL, 0xFA05285BC001D29FULL,
+     0x2CC92411B45725B4ULL, 0x7C9C3B072D353545ULL, 0xA9C1CC3898057932ULL, 0xDC22CF0D62A5416EULL},
+    {0x79C90EF085BEDFBFULL, 0x6CE408E1DC765355ULL, 0xAAFD91BB251C04ADULL, 0x536FD7F82794F731ULL,
+     0x3BAC6CE22136035CULL, 0x957BA502C1E4A5F1ULL, 0x9BAB771BBE6E85F7ULL, 0x60F9EB85C6320E24ULL}
+};
+
+// 행 끝 섞기 키
+static const uint64_t g_scrambleKey[STRIPE_LANES] = {
+    0x33717E6837BAC2AAULL, 0x06EE42B9B33FCBDEULL, 0x6FD1865A809DEA65ULL, 0xD4A8F5C3EC319799ULL,
+    0xB2DA4836BA744D0FULL, 0x7320E3092DE309C8ULL, 0x212BE2F485E73331ULL, 0x7E0F482DD49FF161ULL
+};
+
+// 누적 초기값
+static const uint64_t g_initialAcc[STRIPE_LANES] = {
+    0x00000000C2B2AE3DULL, 0x9E3779B185EBCA87ULL, 0xC2B2AE3D27D4EB4FULL, 0x165667B19E3779F9ULL,
+    0x85EBCA77C2B2AE63ULL, 0x0000000085EBCA77ULL, 0x27D4EB2F165667C5ULL, 0x000000009E3779B1ULL
+};
+
+// 해시 타일 하나
+typedef struct {
+    uint64_t hash;
+    FrameRect coverage;     // 해시한 범위 (타일 안, 데스크톱 좌표), 비어 있으면 해시 없음
+} TileHashEntry;
+
+struct TileHasher {
+    int desktopWidth;
+    int desktopHeight;
+    int columns;
+    int rows;
+    TileHashEntry* entries;
+    ScalerIsa isa;
+
+    // 한 타일 행 작업 공간 (columns개)
+    FrameRect* covers;
+    int* xs;
+    int* widths;
+    uint64_t* hashes;
+    uint64_t* acc;              // 타일마다 레인 8개
+
+    FrameRect changed[TILE_HASH_MAX_RECTS];
+    TileHashStats stats;
+};
+
+/**
+ * 행 하나의 줄무늬 순회 (마지막 불완전 줄무늬는 0으로 채운 복사본으로 처리)
+ * stripe(acc, data, key)를 줄무늬마다 호출한다.
+ */
+#define FOR_EACH_STRIPE(row, width, stripe, acc)                                            \
+    do {                                                                                    \
+        int full_ = (width) / STRIPE_PIXELS;                                                \
+        int tail_ = (width) % STRIPE_PIXELS;                                                \
+        for (int s_ = 0; s_ < full_; s_++) {                                                \
+            stripe(acc, (const uint8_t*)(row) + s_ * STRIPE_BYTES, g_stripeKeys[s_]);       \
+        }                                                                                   \
+        if (tail_ > 0) {                                                                    \
+            uint8_t padded_[STRIPE_BYTES] = {0};                                            \
+            memcpy(padded_, (const uint8_t*)(row) + full_ * STRIPE_BYTES, (size_t)tail_ * 4); \
+            stripe(acc, padded_, g_stripeKeys[full_]);                                      \
+        }                                                                                   \
+    } while (0)
+
+/**
+ * 스칼라 줄무늬 누적
+ */
+static inline void StripeScalar(uint64_t* acc, const uint8_t* data, const uint64_t* key)
+{
+    for (int i = 0; i < STRIPE_LANES; i++) {
+        uint64_t d;
+        memcpy(&d, data + i * 8, 8);
+        uint64_t dk = d ^ key[i];
+        acc[i ^ 1] += d;
+        acc[i] += (dk & 0xFFFFFFFFu) * (dk >> 32);
+    }
+}
+
+/**
+ * 스칼라 타일 행 누적
+ * 타일 count개 (xs/widths: 버퍼 안 x 위치와 너비)의 y부터 height행을 픽셀 행 순서로 읽는다.
+ * acc: 타일마다 레인 8개
+ */
+static void AccumulateScalar(uint64_t* acc, const PixelBuffer* pixels, const int* xs, const int* widths,
+                             int count, int y, int height)
+{
+    for (int r = 0; r < height; r++) {
+        const uint32_t* row = PixelBuffer_Row(pixels, y + r);
+
+        for (int t = 0; t < count; t++) {
+            uint64_t* a = acc + t * STRIPE_LANES;
+            FOR_EACH_STRIPE(row + xs[t], widths[t], StripeScalar, a);
+
+            for (int i = 0; i < STRIPE_LANES; i++) {
+                uint64_t v = a[i];
+                v ^= v >> 47;
+                v ^= g_scrambleKey[i];
+                a[i] = v * SCRAMBLE_PRIME;
+            }
+        }
+    }
+}
+
+#if TILE_HASH_HAVE_X86
+/**
+ * SSE2 줄무늬 누적 (레인 2개씩 4개 레지스터)
+ */
+SSE2_TARGET static inline void StripeSse2(__m128i* acc, const uint8_t* data, const uint64_t* key)
+{
+    for (int j = 0; j < 4; j++) {
+        __m128i d = _mm_loadu_si128((const __m128i*)(data + j * 16));
+        __m128i k = _mm_loadu_si128((const __m128i*)(key + j * 2));
+        __m128i dk = _mm_xor_si128(d, k);
+        __m128i product = _mm_mul_epu32(dk, _mm_srli_epi64(dk, 32));
+        __m128i swapped = _mm_shuffle_epi32(d, _MM_SHUFFLE(1, 0, 3, 2));
+        acc[j] = _mm_add_epi64(acc[j], _mm_add_epi64(product, swapped));
+    }
+}
+
+/**
+ * SSE2 타일 행 누적
+ */
+SSE2_TARGET static void AccumulateSse2(uint64_t* acc, const PixelBuffer* pixels, const int* xs, const int* widths,
+                                       int count, int y, int height)
+{
+    __m128i prime = _mm_set1_epi32((int)SCRAMBLE_PRIME);
+
+    for (int r = 0; r < height; r++) {
+        const uint32_t* row = PixelBuffer_Row(pixels, y + r);
+
+        for (int t = 0; t < count; t++) {
+            uint64_t* out = acc + t * STRIPE_LANES;
+            __m128i a[4];
+            for (int j = 0; j < 4; j++) {
+                a[j] = _mm_loadu_si128((const __m128i*)(out + j * 2));
+            }
+
+            FOR_EACH_STRIPE(row + xs[t], widths[t], StripeSse2, a);
+
+            // a = (a ^ (a >> 47) ^ key) * prime (64x32 곱 = 하위 곱 + 상위 곱 << 32)
+            for (int j = 0; j < 4; j++) {
+                __m128i v = _mm_xor_si128(a[j], _mm_srli_epi64(a[j], 47));
+                v = _mm_xor_si128(v, _mm_loadu_si128((const __m128i*)(g_scrambleKey + j * 2)));
+                __m128i lo = _mm_mul_epu32(v, prime);
+                __m128i hi = _mm_mul_epu32(_mm_srli_epi64(v, 32), prime);
+                _mm_storeu_si128((__m128i*)(out + j * 2), _mm_add_epi64(lo, _mm_slli_epi64(hi, 32)));
+            }
+        }
+    }
+}
+
+/**
+ * AVX2 줄무늬 누적 (레인 4개씩 2개 레지스터, 셔플은 128비트 레인 안에서 이웃끼리)
+ */
+AVX2_TARGET static inline void StripeAvx2(__m256i* acc, const uint8_t* data, const uint64_t* key)
+{
+    for (int j = 0; j < 2; j++) {
+        __m256i d = _mm256_loadu_si256((const __m256i*)(data + j * 32));
+        __m256i k = _mm256_loadu_si256((const __m256i*)(key + j * 4));
+        __m256i dk = _mm256_xor_si256(d, k);
+        __m256i product = _mm256_mul_epu32(dk, _mm256_srli_epi64(dk, 32));
+        __m256i swapped = _mm256_shuffle_epi32(d, _MM_SHUFFLE(1, 0, 3, 2));
+        acc[j] = _mm256_add_epi64(acc[j], _mm256_add_epi64(product, swapped));
+    }
+}
+
+/**
+ * AVX2 타일 행 누적
+ */
+AVX2_TARGET static void AccumulateAvx2(uint64_t* acc, const PixelBuffer* pixels, const int* xs, const int* widths,
+                                       int count, int y, int height)
+{
+    __m256i prime = _mm256_set1_epi32((int)SCRAMBLE_PRIME);
+
+    for (int r = 0; r < height; r++) {
+        const uint32_t* row = PixelBuffer_Row(pixels, y + r);
+
+        for (int t = 0; t < count; t++) {
+            uint64_t* out = acc + t * STRIPE_LANES;
+            __m256i a[2];
+            for (int j = 0; j < 2; j++) {
+                a[j] = _mm256_loadu_si256((const __m256i*)(out + j * 4));
+            }
+
+            FOR_EACH_STRIPE(row + xs[t], widths[t], StripeAvx2, a);
+
+            for (int j = 0; j < 2; j++) {
+                __m256i v = _mm256_xor_si256(a[j], _mm256_srli_epi64(a[j], 47));
+                v = _mm256_xor_si256(v, _mm256_loadu_si256((const __m256i*)(g_scrambleKey + j * 4)));
+                __m256i lo = _mm256_mul_epu32(v, prime);
+                __m256i hi = _mm256_mul_epu32(_mm256_srli_epi64(v, 32), prime);
+                _mm256_storeu_si256((__m256i*)(out + j * 4), _mm256_add_epi64(lo, _mm256_slli_epi64(hi, 32)));
+            }
+        }
+    }
+}
+#endif
+
+/**
+ * 64비트 섞기 (murmur3 fmix64)
+ */
+static inline uint64_t Mix64(uint64_t h)
+{
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDULL;
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+/**
+ * 같은 타일 행의 타일 count개 해시 (width <= TILE_HASH_SIZE)
+ * 타일 하나씩 세로로 읽으면 행마다 페이지를 건너뛰어 프리페치가 듣지 않으므로
+ * 타일 행 전체를 픽셀 행 순서로 읽으며 타일별 누적값을 번갈아 갱신한다.
+ */
+static void HashTiles(ScalerIsa isa, const PixelBuffer* pixels, const int* xs, const int* widths, int count,
+                      int y, int height, uint64_t* acc, uint64_t* hashes)
+{
+    for (int t = 0; t < count; t++) {
+        memcpy(acc + t * STRIPE_LANES, g_initialAcc, sizeof(g_initialAcc));
+    }
+
+#if TILE_HASH_HAVE_X86
+    if (isa == SCALER_ISA_AVX2) {
+        AccumulateAvx2(acc, pixels, xs, widths, count, y, height);
+    } else if (isa == SCALER_ISA_SSE2) {
+        AccumulateSse2(acc, pixels, xs, widths, count, y, height);
+    } else
+#endif
+    {
+        (void)isa;
+        AccumulateScalar(acc, pixels, xs, widths, count, y, height);
+    }
+
+    // 크기를 섞어 0으로 채운 꼬리와 실제 검은 픽셀을 구분
+    for (int t = 0; t < count; t++) {
+        uint64_t h = Mix64(((uint64_t)(uint32_t)widths[t] << 32) | (uint32_t)height);
+        for (int i = 0; i < STRIPE_LANES; i++) {
+            h = Mix64(h ^ acc[t * STRIPE_LANES + i]);
+        }
+        hashes[t] = h;
+    }
+}
+
+/**
+ * 타일 하나의 해시
+ */
+uint64_t TileHasher_HashRect(ScalerIsa isa, const PixelBuffer* pixels, int x, int y, int width, int height)
+{
+    uint64_t acc[STRIPE_LANES];
+    uint64_t hash;
+    if (width > TILE_HASH_SIZE) width = TILE_HASH_SIZE;
+
+    HashTiles(isa, pixels, &x, &width, 1, y, height, acc, &hash);
+    return hash;
+}
+
+/**
+ * 해시 격자 생성
+ */
+TileHasher* TileHasher_Create(int desktopWidth, int desktopHeight)
+{
+    if (desktopWidth <= 0 || desktopHeight <= 0) return NULL;
+
+    TileHasher* hasher = (TileHasher*)calloc(1, sizeof(TileHasher));
+    if (!hasher) return NULL;
+
+    hasher->desktopWidth = desktopWidth;
+    hasher->desktopHeight = desktopHeight;
+    hasher->columns = (desktopWidth + TILE_HASH_SIZE - 1) / TILE_HASH_SIZE;
+    hasher->rows = (desktopHeight + TILE_HASH_SIZE - 1) / TILE_HASH_SIZE;
+    hasher->entries = (TileHashEntry*)calloc((size_t)hasher->columns * hasher->rows, sizeof(TileHashEntry));
+    hasher->covers = (FrameRect*)malloc(sizeof(FrameRect) * hasher->columns);
+    hasher->xs = (int*)malloc(sizeof(int) * hasher->columns);
+    hasher->widths = (int*)malloc(sizeof(int) * hasher->columns);
+    hasher->hashes = (uint64_t*)malloc(sizeof(uint64_t) * hasher->columns);
+    hasher->acc = (uint64_t*)malloc(sizeof(uint64_t) * STRIPE_LANES * hasher->columns);
+    if (!hasher->entries || !hasher->covers || !hasher->xs || !hasher->widths || !hasher->hashes || !hasher->acc) {
+        TileHasher_Destroy(hasher);
+        return NULL;
+    }
+
+    hasher->isa = Scaler_DetectIsa();
+    return hasher;
+}
+
+/**
+ * 해시 격자 파괴
+ */
+void TileHasher_Destroy(TileHasher* hasher)
+{
+    if (!hasher) return;
+
+    free(hasher->entries);
+    free(hasher->covers);
+    free(hasher->xs);
+    free(hasher->widths);
+    free(hasher->hashes);
+    free(hasher->acc);
+    free(hasher);
+}
+
+/**
+ * 해시 커널 ISA 지정
+ */
+void TileHasher_SetIsa(TileHasher* hasher, ScalerIsa isa)
+{
+    if (hasher) {
+        hasher->isa = isa;
+    }
+}
+
+/**
+ * 바뀐 타일 구간 하나를 사각형 목록에 추가
+ * 윗 행에서 좌우 범위가 같은 사각형이 바로 위에 있으면 아래로 늘린다.
+ */
+static bool AddRun(TileHasher* hasher, int* count, const FrameRect* run)
+{
+    for (int i = 0; i < *count; i++) {
+        FrameRect* r = &hasher->changed[i];
+        if (r->bottom == run->top && r->left == run->left && r->right == run->right) {
+            r->bottom = run->bottom;
+            return true;
+        }
+    }
+
+    if (*count == TILE_HASH_MAX_RECTS) {
+        return false;
+    }
+    hasher->changed[(*count)++] = *run;
+    return true;
+}
+
+/**
+ * 프레임 타일 해시 후 직전 값과 비교
+ */
+int TileHasher_Update(TileHasher* hasher, const PixelBuffer* pixels, const FrameRect* bounds,
+                      const FrameRect** changed)
+{
+    *changed = hasher->changed;
+
+    // 픽셀이 있는 데스크톱 안쪽만
+    FrameRect desktop = {0, 0, hasher->desktopWidth, hasher->desktopHeight};
+    FrameRect frame = {bounds->left, bounds->top, bounds->left + pixels->width, bounds->top + pixels->height};
+    FrameRect area;
+    if (!FrameRect_Intersect(&area, &frame, &desktop) || !FrameRect_Intersect(&area, &area, bounds)) {
+        return 0;
+    }
+
+    double start = WorkerPool_NowMs();
+    int tileX0 = area.left / TILE_HASH_SIZE;
+    int tileY0 = area.top / TILE_HASH_SIZE;
+    int tileX1 = (area.right - 1) / TILE_HASH_SIZE;
+    int tileY1 = (area.bottom - 1) / TILE_HASH_SIZE;
+    int rects = 0;
+    int tiles = 0;
+    int changedTiles = 0;
+    bool overflow = false;
+
+    for (int ty = tileY0; ty <= tileY1; ty++) {
+        int count = tileX1 - tileX0 + 1;
+        for (int i = 0; i < count; i++) {
+            int tx = tileX0 + i;
+            FrameRect tile = {tx * TILE_HASH_SIZE, ty * TILE_HASH_SIZE,
+                              (tx + 1) * TILE_HASH_SIZE, (ty + 1) * TILE_HASH_SIZE};
+            FrameRect_Intersect(&hasher->covers[i], &tile, &area);
+            hasher->xs[i] = hasher->covers[i].left - bounds->left;
+            hasher->widths[i] = hasher->covers[i].right - hasher->covers[i].left;
+        }
+
+        const FrameRect* first = &hasher->covers[0];
+        HashTiles(hasher->isa, pixels, hasher->xs, hasher->widths, count,
+                  first->top - bounds->top, first->bottom - first->top, hasher->acc, hasher->hashes);
+
+        bool open = false;
+        FrameRect run = {0};
+
+        for (int i = 0; i < count; i++) {
+            const FrameRect* cover = &hasher->covers[i];
+            uint64_t hash = hasher->hashes[i];
+
+            // 해시한 범위가 다르면 (캡처 영역 가장자리가 움직임) 비교할 수 없으므로 바뀐 것으로 봄
+            TileHashEntry* entry = &hasher->entries[ty * hasher->columns + tileX0 + i];
+            bool differs = entry->hash != hash ||
+                           memcmp(&entry->coverage, cover, sizeof(FrameRect)) != 0;
+            entry->hash = hash;
+            entry->coverage = *cover;
+            tiles++;
+
+            if (differs) {
+                changedTiles++;
+                if (open) {
+                    run.right = cover->right;
+                } else {
+                    run = *cover;
+                    open = true;
+                }
+            } else if (open) {
+                overflow = overflow || !AddRun(hasher, &rects, &run);
+                open = false;
+            }
+        }
+
+        if (open) {
+            overflow = overflow || !AddRun(hasher, &rects, &run);
+        }
+    }
+
+    TileHashStats* s = &hasher->stats;
+    s->frames++;
+    if (changedTiles == 0) s->framesUnchanged++;
+    s->tilesHashed += (unsigned long long)tiles;
+    s->tilesChanged += (unsigned long long)changedTiles;
+    s->lastTiles = tiles;
+    s->lastChanged = changedTiles;
+    s->hashMs += WorkerPool_NowMs() - start;
+
+    return overflow ? -1 : rects;
+}
+
+/**
+ * 영역의 해시 버리기
+ */
+void TileHasher_Invalidate(TileHasher* hasher, const FrameRect* rect)
+{
+    FrameRect desktop = {0, 0, hasher->desktopWidth, hasher->desktopHeight};
+    FrameRect area;
+    if (!FrameRect_Intersect(&area, rect, &desktop)) {
+        return;
+    }
+
+    for (int ty = area.top / TILE_HASH_SIZE; ty <= (area.bottom - 1) / TILE_HASH_SIZE; ty++) {
+        for (int tx = area.left / TILE_HASH_SIZE; tx <= (area.right - 1) / TILE_HASH_SIZE; tx++) {
+            memset(&hasher->entries[ty * hasher->columns + tx], 0, sizeof(TileHashEntry));
+        }
+    }
+}
+
+/**
+ * 모든 해시 버리기
+ */
+void TileHasher_Reset(TileHasher* hasher)
+{
+    if (hasher) {
+        memset(hasher->entries, 0, sizeof(TileHashEntry) * (size_t)hasher->columns * hasher->rows);
+    }
+}
+
+/**
+ * 통계 가져오기
+ */
+void TileHasher_GetStats(const TileHasher* hasher, TileHashStats* stats)
+{
+    *stats = hasher->stats;
+}
+
+/**
+ * 통계 초기화
+ */
+void TileHasher_ResetStats(TileHasher* hasher)
+{
+    memset(&hasher->stats, 0, sizeof(TileHashStats));
+}
@@ -0,0 +1,83 @@
+/**
+ * tile_hash.h - 타일 내용 해시 (변경 정보 없는 프레임의 바뀐 영역 찾기)
+ *
+ * 데스크톱을 고정 크기 타일 격자로 나누고 타일마다 내용 해시를 보관한다.
+ * 새 프레임의 타일 해시를 직전 값과 비교해 바뀐 타일만 사각형 목록으로 돌려준다.
+ * 격자가 데스크톱 좌표 기준이라 캡처 영역이 움직여도 겹치는 타일은 계속 비교된다.
+ * 해시는 SIMD(SSE2/AVX2)로 계산하며 ISA와 관계없이 값이 같다. (플랫폼 독립)
+ */
+
+#ifndef LETSZOOM_TILE_HASH_H
+#define LETSZOOM_TILE_HASH_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "frame_source.h"
+#include "pixel_buffer.h"
+#include "scaler.h"
+
+// 해시 타일 한 변 (소스 픽셀)
+#define TILE_HASH_SIZE 64
+
+// 한 프레임에서 돌려줄 최대 사각형 수 (넘으면 전체가 바뀐 것으로 취급)
+#define TILE_HASH_MAX_RECTS 128
+
+// 해시 통계
+typedef struct {
+    unsigned long long frames;          // 해시한 프레임 수
+    unsigned long long framesUnchanged; // 바뀐 타일이 없던 프레임
+    unsigned long long tilesHashed;     // 누적 해시한 타일
+    unsigned long long tilesChanged;    // 누적 바뀐 타일
+    int lastTiles;                      // 마지막 프레임의 타일 수
+    int lastChanged;                    // 마지막 프레임의 바뀐 타일 수
+    double hashMs;                      // 누적 해시 시간 (밀리초)
+} TileHashStats;
+
+typedef struct TileHasher TileHasher;
+
+/**
+ * 해시 격자 생성 (데스크톱 크기)
+ */
+TileHasher* TileHasher_Create(int desktopWidth, int desktopHeight);
+
+/**
+ * 해시 격자 파괴
+ */
+void TileHasher_Destroy(TileHasher* hasher);
+
+/**
+ * 해시 커널 ISA 지정 (생성 시 자동 감지, 비교 측정용)
+ */
+void TileHasher_SetIsa(TileHasher* hasher, ScalerIsa isa);
+
+/**
+ * 프레임 타일 해시 후 직전 값과 비교
+ * pixels/bounds: 획득한 프레임 (bounds는 데스크톱 좌표)
+ * changed: 바뀐 영역 (데스크톱 좌표, 다음 호출 전까지 유효)
+ * 바뀐 사각형 수를 돌려주고, 너무 많으면 -1 (전체가 바뀐 것으로 취급)
+ */
+int TileHasher_Update(TileHasher* hasher, const PixelBuffer* pixels, const FrameRect* bounds,
+                      const FrameRect** changed);
+
+/**
+ * 다른 경로로 바뀐 것을 알게 된 영역의 해시 버리기 (다음 비교에서 바뀐 것으로 봄)
+ */
+void TileHasher_Invalidate(TileHasher* hasher, const FrameRect* rect);
+
+/**
+ * 모든 해시 버리기
+ */
+void TileHasher_Reset(TileHasher* hasher);
+
+/**
+ * 타일 하나의 해시 (ISA 비교/측정용)
+ */
+uint64_t TileHasher_HashRect(ScalerIsa isa, const PixelBuffer* pixels, int x, int y, int width, int height);
+
+/**
+ * 통계 가져오기 / 초기화
+ */
+void TileHasher_GetStats(const TileHasher* hasher, TileHashStats* stats);
+void TileHasher_ResetStats(TileHasher* hasher);
+
+#endif // LETSZOOM_TILE_HASH_H
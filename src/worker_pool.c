@@ -0,0 +1,263 @@
+/**
+ * worker_pool.c - 작업 스레드 풀 구현
+ *
+ * 작업 번호 하나를 잠금 아래에서 가져가는 방식이라 작업이 적고 굵은 경우(밴드 몇 개)에 맞다.
+ * 호출 스레드도 작업을 가져가므로 스레드 N개 풀은 배경 스레드 N-1개를 만든다.
+ */
+
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "worker_pool.h"
+#include <stdlib.h>
+
+#ifdef _WIN32
+#include <windows.h>
+
+typedef CRITICAL_SECTION PoolLock;
+typedef CONDITION_VARIABLE PoolSignal;
+typedef HANDLE PoolThread;
+#else
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+
+typedef pthread_mutex_t PoolLock;
+typedef pthread_cond_t PoolSignal;
+typedef pthread_t PoolThread;
+#endif
+
+struct WorkerPool {
+    int threads;                                    // 호출 스레드 포함
+    int started;                                    // 만든 배경 스레드 수
+    PoolThread handles[WORKER_POOL_MAX_THREADS - 1];
+
+    // 아래는 lock으로 보호
+    PoolLock lock;
+    PoolSignal wake;                                // 새 작업 또는 종료
+    PoolSignal done;                                // 작업이 모두 끝남
+    WorkerTaskFn task;
+    void* context;
+    int count;
+    int next;                                       // 다음에 가져갈 작업 번호
+    int finished;
+    bool stop;
+};
+
+#ifdef _WIN32
+static void InitLock(PoolLock* lock) { InitializeCriticalSection(lock); }
+static void DeleteLock(PoolLock* lock) { DeleteCriticalSection(lock); }
+static void Lock(PoolLock* lock) { EnterCriticalSection(lock); }
+static void Unlock(PoolLock* lock) { LeaveCriticalSection(lock); }
+static void InitSignal(PoolSignal* signal) { InitializeConditionVariable(signal); }
+static void DeleteSignal(PoolSignal* signal) { (void)signal; }
+static void Wait(PoolSignal* signal, PoolLock* lock) { SleepConditionVariableCS(signal, lock, INFINITE); }
+static void WakeAll(PoolSignal* signal) { WakeAllConditionVariable(signal); }
+#else
+static void InitLock(PoolLock* lock) { pthread_mutex_init(lock, NULL); }
+static void DeleteLock(PoolLock* lock) { pthread_mutex_destroy(lock); }
+static void Lock(PoolLock* lock) { pthread_mutex_lock(lock); }
+static void Unlock(PoolLock* lock) { pthread_mutex_unlock(lock); }
+static void InitSignal(PoolSignal* signal) { pthread_cond_init(signal, NULL); }
+static void DeleteSignal(PoolSignal* signal) { pthread_cond_destroy(signal); }
+static void Wait(PoolSignal* signal, PoolLock* lock) { pthread_cond_wait(signal, lock); }
+static void WakeAll(PoolSignal* signal) { pthread_cond_broadcast(signal); }
+#endif
+
+/**
+ * 남은 작업을 가져가 실행 (lock을 쥔 채 호출, 쥔 채 돌아옴)
+ */
+static void RunTasks(WorkerPool* pool)
+{
+    while (pool->next < pool->count) {
+        int index = pool->next++;
+        WorkerTaskFn task = pool->task;
+        void* context = pool->context;
+
+        Unlock(&pool->lock);
+        task(context, index);
+        Lock(&pool->lock);
+
+        if (++pool->finished == pool->count) {
+            WakeAll(&pool->done);
+        }
+    }
+}
+
+/**
+ * 배경 스레드 본체
+ */
+static void WorkerLoop(WorkerPool* pool)
+{
+    Lock(&pool->lock);
+    for (;;) {
+        while (!pool->stop && pool->next >= pool->count) {
+            Wait(&pool->wake, &pool->lock);
+        }
+        if (pool->stop) {
+            break;
+        }
+        RunTasks(pool);
+    }
+    Unlock(&pool->lock);
+}
+
+#ifdef _WIN32
+static DWORD WINAPI WorkerThread(LPVOID param)
+{
+    WorkerLoop((WorkerPool*)param);
+    return 0;
+}
+
+static bool StartThread(WorkerPool* pool, PoolThread* thread)
+{
+    *thread = CreateThread(NULL, 0, WorkerThread, pool, 0, NULL);
+    return *thread != NULL;
+}
+
+static void JoinThread(PoolThread thread)
+{
+    WaitForSingleObject(thread, INFINITE);
+    CloseHandle(thread);
+}
+#else
+static void* WorkerThread(void* param)
+{
+    WorkerLoop((WorkerPool*)param);
+    return NULL;
+}
+
+static bool StartThread(WorkerPool* pool, PoolThread* thread)
+{
+    return pthread_create(thread, NULL, WorkerThread, pool) == 0;
+}
+
+static void JoinThread(PoolThread thread)
+{
+    pthread_join(thread, NULL);
+}
+#endif
+
+/**
+ * 논리 코어 수
+ */
+int WorkerPool_GetCpuCount(void)
+{
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    int count = (int)info.dwNumberOfProcessors;
+#else
+    int count = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    return count > 0 ? count : 1;
+}
+
+/**
+ * 단조 시각 (밀리초)
+ */
+double WorkerPool_NowMs(void)
+{
+#ifdef _WIN32
+    LARGE_INTEGER frequency, counter;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart * 1000.0 / (double)frequency.QuadPart;
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec * 1000.0 + (double)now.tv_nsec / 1000000.0;
+#endif
+}
+
+/**
+ * 풀 생성
+ */
+WorkerPool* WorkerPool_Create(int threads)
+{
+    if (threads <= 0) {
+        threads = WorkerPool_GetCpuCount();
+        if (threads > WORKER_POOL_AUTO_THREADS) threads = WORKER_POOL_AUTO_THREADS;
+    }
+    if (threads > WORKER_POOL_MAX_THREADS) threads = WORKER_POOL_MAX_THREADS;
+
+    WorkerPool* pool = (WorkerPool*)calloc(1, sizeof(WorkerPool));
+    if (!pool) return NULL;
+
+    InitLock(&pool->lock);
+    InitSignal(&pool->wake);
+    InitSignal(&pool->done);
+
+    // 스레드를 일부만 만들었으면 만든 만큼만 사용
+    while (pool->started < threads - 1 && StartThread(pool, &pool->handles[pool->started])) {
+        pool->started++;
+    }
+    pool->threads = pool->started + 1;
+    return pool;
+}
+
+/**
+ * 풀 파괴
+ */
+void WorkerPool_Destroy(WorkerPool* pool)
+{
+    if (!pool) return;
+
+    Lock(&pool->lock);
+    pool->stop = true;
+    WakeAll(&pool->wake);
+    Unlock(&pool->lock);
+
+    for (int i = 0; i < pool->started; i++) {
+        JoinThread(pool->handles[i]);
+    }
+
+    DeleteSignal(&pool->done);
+    DeleteSignal(&pool->wake);
+    DeleteLock(&pool->lock);
+    free(pool);
+}
+
+/**
+ * 스레드 수
+ */
+int WorkerPool_GetThreads(const WorkerPool* pool)
+{
+    return pool ? pool->threads : 1;
+}
+
+/**
+ * 작업 실행
+ */
+void WorkerPool_Run(WorkerPool* pool, WorkerTaskFn task, void* context, int count)
+{
+    if (!task || count <= 0) return;
+
+    if (!pool || pool->threads == 1 || count == 1) {
+        for (int i = 0; i < count; i++) {
+            task(context, i);
+        }
+        return;
+    }
+
+    Lock(&pool->lock);
+    pool->task = task;
+    pool->context = context;
+    pool->count = count;
+    pool->next = 0;
+    pool->finished = 0;
+    WakeAll(&pool->wake);
+
+    // 호출 스레드도 작업을 나눠 받은 뒤 나머지가 끝나기를 기다림
+    RunTasks(pool);
+    while (pool->finished < pool->count) {
+        Wait(&pool->done, &pool->lock);
+    }
+
+    pool->task = NULL;
+    pool->context = NULL;
+    pool->count = 0;
+    pool->next = 0;
+    Unlock(&pool->lock);
+}
@@ -0,0 +1,57 @@
+/**
+ * worker_pool.h - 작업 스레드 풀 (포크-조인)
+ *
+ * 한 번의 WorkerPool_Run이 작업 count개를 풀 스레드와 호출 스레드가 나눠 처리하고
+ * 모두 끝나면 돌아온다. 확대 출력을 밴드로 나눠 병렬로 확대하는 데 쓴다.
+ * 플랫폼 독립 인터페이스 (Windows 스레드 / pthread)
+ */
+
+#ifndef LETSZOOM_WORKER_POOL_H
+#define LETSZOOM_WORKER_POOL_H
+
+#include <stdbool.h>
+
+// 풀 하나의 최대 스레드 수 (호출 스레드 포함)
+#define WORKER_POOL_MAX_THREADS 16
+
+// 자동 선택 시 최대 스레드 수 (그 이상은 메모리 대역폭에 막혀 이득이 적음)
+#define WORKER_POOL_AUTO_THREADS 8
+
+// 작업 함수 (index: 0 ~ count-1)
+typedef void (*WorkerTaskFn)(void* context, int index);
+
+typedef struct WorkerPool WorkerPool;
+
+/**
+ * 풀 생성
+ * threads: 호출 스레드를 포함한 스레드 수 (0 이하면 코어 수, 최대 WORKER_POOL_AUTO_THREADS)
+ * 1이면 스레드를 만들지 않고 호출 스레드에서 차례로 실행한다.
+ */
+WorkerPool* WorkerPool_Create(int threads);
+
+/**
+ * 풀 파괴 (실행 중인 WorkerPool_Run이 없어야 함)
+ */
+void WorkerPool_Destroy(WorkerPool* pool);
+
+/**
+ * 호출 스레드를 포함한 스레드 수
+ */
+int WorkerPool_GetThreads(const WorkerPool* pool);
+
+/**
+ * 작업 count개 실행 (모두 끝날 때까지 대기, 한 번에 한 스레드만 호출)
+ */
+void WorkerPool_Run(WorkerPool* pool, WorkerTaskFn task, void* context, int count);
+
+/**
+ * 논리 코어 수
+ */
+int WorkerPool_GetCpuCount(void);
+
+/**
+ * 단조 시각 (밀리초, 작업 시간 측정용)
+ */
+double WorkerPool_NowMs(void);
+
+#endif // LETSZOOM_WORKER_POOL_H
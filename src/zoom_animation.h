@@ -0,0 +1,55 @@
+/**
+ * zoom_animation.h - 확대 배율/중심 전환 애니메이션
+ *
+ * 시작 값에서 목표 값까지 정해진 시간 동안 감속 곡선(ease-out)으로 보간한다.
+ * 시간은 호출자가 밀리초로 넘긴다 (플랫폼 독립)
+ */
+
+#ifndef LETSZOOM_ZOOM_ANIMATION_H
+#define LETSZOOM_ZOOM_ANIMATION_H
+
+#include <stdbool.h>
+
+// 애니메이션 대상 값
+typedef struct {
+    float zoom;         // 확대 배율 (1.0 = 100%)
+    float panX;         // 패닝 오프셋 (데스크톱 픽셀)
+    float panY;
+} ZoomState;
+
+typedef struct {
+    ZoomState from;
+    ZoomState to;
+    double startMs;
+    double durationMs;
+    bool active;
+} ZoomAnimation;
+
+/**
+ * 감속 곡선 (t: 0~1, cubic ease-out)
+ */
+float ZoomAnimation_Ease(float t);
+
+/**
+ * 애니메이션 시작 (durationMs가 0 이하면 바로 목표 값)
+ * 진행 중에 다시 호출하면 현재 값에서 새 목표로 이어진다.
+ */
+void ZoomAnimation_Start(ZoomAnimation* anim, const ZoomState* to, double nowMs, double durationMs);
+
+/**
+ * 현재 값 계산
+ * 아직 진행 중이면 true, 목표에 도달했으면 false (state = 목표 값)
+ */
+bool ZoomAnimation_Sample(ZoomAnimation* anim, double nowMs, ZoomState* state);
+
+/**
+ * 패닝만 바로 이동 (드래그 중, 배율 전환은 그대로 진행)
+ */
+void ZoomAnimation_SetPan(ZoomAnimation* anim, float panX, float panY);
+
+/**
+ * 목표 값으로 바로 이동 (애니메이션 없음)
+ */
+void ZoomAnimation_Jump(ZoomAnimation* anim, const ZoomState* state);
+
+#endif // LETSZOOM_ZOOM_ANIMATION_H
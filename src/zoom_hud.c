@@ -0,0 +1,236 @@
+/**
+ * zoom_hud.c - 확대 오버레이 HUD 구현
+ *
+ * 스프라이트는 검은 바탕의 DIB 섹션에 GDI로 그린 뒤 알파를 채운다.
+ * 십자선과 힌트는 잉크 밝기를 알파로 쓰고 (AlphaBlend), 배율 표시는 불투명 (BitBlt).
+ */
+
+#include "zoom_hud.h"
+#include "dib_buffer.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+// 화면 위 위치가 정해진 스프라이트
+typedef struct {
+    DibBuffer dib;
+    int x;
+    int y;
+    bool opaque;        // 알파 없이 복사
+} HudSprite;
+
+struct ZoomHud {
+    int width;              // 모니터 크기
+    int height;
+    MonitorInfo monitor;
+    HFONT font;
+
+    HudSprite cross;        // 화면 중앙 십자선
+    HudSprite hint;         // 아래쪽 단축키 힌트
+    HudSprite badge;        // 왼쪽 위 배율 표시
+    int badgeZoom;          // badge에 그린 배율 (0이면 아직 없음)
+    bool badgeFrozen;
+
+    unsigned long long rebuilds;
+};
+
+/**
+ * 스프라이트 버퍼 준비 (크기가 같으면 재사용, 0으로 지워 검은 바탕)
+ */
+static bool PrepareSprite(HudSprite* sprite, int x, int y, int width, int height)
+{
+    if (sprite->dib.hdc && sprite->dib.pixels.width == width && sprite->dib.pixels.height == height) {
+        GdiFlush();
+        PixelBuffer_Fill(&sprite->dib.pixels, 0);
+    } else {
+        DibBuffer_Destroy(&sprite->dib);
+        if (!DibBuffer_Create(&sprite->dib, width, height)) {
+            OutputDebugStringW(L"[ZoomHud] Failed to create sprite\n");
+            return false;
+        }
+    }
+
+    sprite->x = x;
+    sprite->y = y;
+    return true;
+}
+
+/**
+ * GDI 그리기를 마치고 알파 채우기
+ */
+static void FinishSprite(HudSprite* sprite, ZoomHud* hud)
+{
+    GdiFlush();
+    if (sprite->opaque) {
+        PixelBuffer_SetOpaque(&sprite->dib.pixels);
+    } else {
+        PixelBuffer_AlphaFromInk(&sprite->dib.pixels);
+    }
+    hud->rebuilds++;
+}
+
+/**
+ * 스프라이트에 흰 글자 (가운데 정렬)
+ */
+static void DrawSpriteText(HudSprite* sprite, HFONT font, const WCHAR* text)
+{
+    HDC hdc = sprite->dib.hdc;
+    SetBkMode(hdc, TRANSPARENT);
+    SetTextColor(hdc, RGB(255, 255, 255));
+    HFONT hOldFont = font ? (HFONT)SelectObject(hdc, font) : NULL;
+
+    RECT rect = {0, 0, sprite->dib.pixels.width, sprite->dib.pixels.height};
+    DrawTextW(hdc, text, -1, &rect, DT_CENTER | DT_VCENTER | DT_SINGLELINE);
+
+    if (hOldFont) {
+        SelectObject(hdc, hOldFont);
+    }
+}
+
+/**
+ * 십자선 (크기는 모니터 DPI에 맞춤)
+ */
+static void BuildCross(ZoomHud* hud)
+{
+    int penWidth = Monitor_Scale(&hud->monitor, 2);
+    int crossSize = Monitor_Scale(&hud->monitor, 20);
+    int center = crossSize + penWidth;
+    int size = center * 2;
+
+    if (!PrepareSprite(&hud->cross, hud->width / 2 - center, hud->height / 2 - center, size, size)) {
+        return;
+    }
+
+    HDC hdc = hud->cross.dib.hdc;
+    HPEN hPen = CreatePen(PS_SOLID, penWidth, RGB(255, 0, 0));
+    HPEN hOldPen = (HPEN)SelectObject(hdc, hPen);
+
+    MoveToEx(hdc, center - crossSize, center, NULL);
+    LineTo(hdc, center + crossSize, center);
+    MoveToEx(hdc, center, center - crossSize, NULL);
+    LineTo(hdc, center, center + crossSize);
+
+    SelectObject(hdc, hOldPen);
+    DeleteObject(hPen);
+
+    FinishSprite(&hud->cross, hud);
+}
+
+/**
+ * 단축키 힌트
+ */
+static void BuildHint(ZoomHud* hud)
+{
+    int margin = Monitor_Scale(&hud->monitor, 20);
+    int top = hud->height - Monitor_Scale(&hud->monitor, 60);
+    if (!PrepareSprite(&hud->hint, margin, top, hud->width - margin * 2, hud->height - margin - top)) {
+        return;
+    }
+
+    DrawSpriteText(&hud->hint, hud->font, L"ESC: 종료 | 휠: 줌 | 드래그: 이동 | +/-: 줌 조절 | I/G/H/D: 색 필터");
+    FinishSprite(&hud->hint, hud);
+}
+
+/**
+ * 배율 표시 (검은 배경 + 흰 글자)
+ */
+static void BuildBadge(ZoomHud* hud, int zoomLevel, bool frozen)
+{
+    int margin = Monitor_Scale(&hud->monitor, 20);
+    int right = Monitor_Scale(&hud->monitor, 300);
+    int bottom = Monitor_Scale(&hud->monitor, 60);
+    if (!PrepareSprite(&hud->badge, margin, margin, right - margin, bottom - margin)) {
+        return;
+    }
+
+    WCHAR zoomText[64];
+    swprintf_s(zoomText, 64, frozen ? L"확대: %d%% (정지)" : L"확대: %d%%", zoomLevel);
+    DrawSpriteText(&hud->badge, hud->font, zoomText);
+    FinishSprite(&hud->badge, hud);
+
+    hud->badgeZoom = zoomLevel;
+    hud->badgeFrozen = frozen;
+}
+
+/**
+ * 스프라이트 합성
+ */
+static void DrawSprite(const HudSprite* sprite, HDC hdc)
+{
+    if (!sprite->dib.hdc) return;
+
+    int width = sprite->dib.pixels.width;
+    int height = sprite->dib.pixels.height;
+    if (sprite->opaque) {
+        BitBlt(hdc, sprite->x, sprite->y, width, height, sprite->dib.hdc, 0, 0, SRCCOPY);
+    } else {
+        BLENDFUNCTION blend = {AC_SRC_OVER, 0, 255, AC_SRC_ALPHA};
+        AlphaBlend(hdc, sprite->x, sprite->y, width, height, sprite->dib.hdc, 0, 0, width, height, blend);
+    }
+}
+
+/**
+ * HUD 생성
+ */
+ZoomHud* ZoomHud_Create(const MonitorInfo* monitor)
+{
+    if (!monitor) return NULL;
+
+    ZoomHud* hud = (ZoomHud*)calloc(1, sizeof(ZoomHud));
+    if (!hud) return NULL;
+
+    hud->monitor = *monitor;
+    hud->width = monitor->bounds.right - monitor->bounds.left;
+    hud->height = monitor->bounds.bottom - monitor->bounds.top;
+    hud->badge.opaque = true;
+
+    // 스프라이트는 검은 바탕에 그려 알파를 만들므로 ClearType 색 번짐 없는 안티앨리어싱
+    hud->font = CreateFontW(-Monitor_Scale(monitor, 16), 0, 0, 0, FW_NORMAL, FALSE, FALSE, FALSE,
+                            DEFAULT_CHARSET, OUT_DEFAULT_PRECIS, CLIP_DEFAULT_PRECIS, ANTIALIASED_QUALITY,
+                            DEFAULT_PITCH | FF_DONTCARE, L"Segoe UI");
+
+    // 내용이 바뀌지 않는 요소는 미리 그려 둠
+    BuildCross(hud);
+    BuildHint(hud);
+    return hud;
+}
+
+/**
+ * HUD 파괴
+ */
+void ZoomHud_Destroy(ZoomHud* hud)
+{
+    if (!hud) return;
+
+    DibBuffer_Destroy(&hud->cross.dib);
+    DibBuffer_Destroy(&hud->hint.dib);
+    DibBuffer_Destroy(&hud->badge.dib);
+
+    if (hud->font) {
+        DeleteObject(hud->font);
+    }
+    free(hud);
+}
+
+/**
+ * HUD 합성
+ */
+void ZoomHud_Draw(ZoomHud* hud, HDC hdc, int zoomLevel, bool frozen)
+{
+    if (!hud) return;
+
+    if (hud->badgeZoom != zoomLevel || hud->badgeFrozen != frozen) {
+        BuildBadge(hud, zoomLevel, frozen);
+    }
+
+    DrawSprite(&hud->cross, hdc);
+    DrawSprite(&hud->badge, hdc);
+    DrawSprite(&hud->hint, hdc);
+}
+
+/**
+ * 스프라이트를 다시 그린 횟수
+ */
+unsigned long long ZoomHud_GetRebuilds(const ZoomHud* hud)
+{
+    return hud ? hud->rebuilds : 0;
+}
@@ -0,0 +1,37 @@
+/**
+ * zoom_hud.h - 확대 오버레이 HUD (십자선, 배율 표시, 힌트)
+ *
+ * 각 요소를 premultiplied DIB 스프라이트로 한 번 그려 두고 내용이 바뀔 때만 다시 그린다.
+ * 프레임마다 펜/브러시 생성이나 문자열 포맷, DrawTextW 배치 없이 스프라이트만 합성한다.
+ */
+
+#ifndef LETSZOOM_ZOOM_HUD_H
+#define LETSZOOM_ZOOM_HUD_H
+
+#include <windows.h>
+#include <stdbool.h>
+#include "monitor.h"
+
+typedef struct ZoomHud ZoomHud;
+
+/**
+ * HUD 생성 (모니터 크기와 DPI에 맞춘 글꼴과 스프라이트)
+ */
+ZoomHud* ZoomHud_Create(const MonitorInfo* monitor);
+
+/**
+ * HUD 파괴
+ */
+void ZoomHud_Destroy(ZoomHud* hud);
+
+/**
+ * HUD를 hdc에 합성 (배율 표시는 zoomLevel/frozen이 바뀔 때만 다시 그림)
+ */
+void ZoomHud_Draw(ZoomHud* hud, HDC hdc, int zoomLevel, bool frozen);
+
+/**
+ * 스프라이트를 다시 그린 횟수 (생성 포함)
+ */
+unsigned long long ZoomHud_GetRebuilds(const ZoomHud* hud);
+
+#endif // LETSZOOM_ZOOM_HUD_H
@@ -3,7 +3,20 @@
  */
 
 #include "zoom_overlay.h"
+#include "cursor_predictor.h"
+#include "frame_pacer.h"
+#include "frame_source.h"
+#include "frame_timing.h"
+#include "magnifier_view.h"
+#include "monitor.h"
+#include "residency.h"
+#include "snapshot_history.h"
+#include "zoom_animation.h"
+#include "zoom_hud.h"
+#include "zoom_renderer.h"
+#include <math.h>
 #include <stdio.h>
+#include <string.h>
 
 // 윈도우 클래스 이름
 #define ZOOM_CLASS_NAME L"LetsZoomOverlayWindow"
@@ -12,196 +25,971 @@
 static HINSTANCE g_hInstance = NULL;
 static HWND g_hwndZoom = NULL;
 static bool g_bActive = false;
-static int g_zoomLevel = 200;
+static float g_zoom = 2.0f;              // 확대 배율 (1.0 = 100%, 연속 값)
 static bool g_smoothZoom = true;
-
-// 패닝 관련
-static int g_panOffsetX = 0;
-static int g_panOffsetY = 0;
+static bool g_sharpZoom = false;        // 부드러운 확대에 Lanczos-3 사용
+static bool g_linearLight = false;      // 부드러운 확대를 선형 광량에서 보간
+static bool g_freezeFrame = false;      // 정지 확대 (시작할 때 한 번만 캡처)
+static ColorFilter g_colorFilter = COLOR_FILTER_NONE;   // 색 필터 (확대 중 단축키로 켜고 끔, 다음 확대에도 유지)
+
+// 패닝 관련 (데스크톱 픽셀, 서브픽셀까지 유지)
+static float g_panOffsetX = 0.0f;
+static float g_panOffsetY = 0.0f;
 static bool g_bDragging = false;
 static POINT g_ptDragStart = {0};
-static POINT g_ptPanStart = {0};
-
-// 렌더링 관련
-static HDC g_hdcScreen = NULL;
-static HDC g_hdcMem = NULL;
-static HBITMAP g_hbmScreen = NULL;
-static HBITMAP g_hbmOld = NULL;
+static float g_panStartX = 0.0f;
+static float g_panStartY = 0.0f;
+
+// 배율 범위와 단계 (휠 한 칸/키 한 번마다 곱함, 고해상도 휠은 이동량만큼 나눠서)
+#define ZOOM_MIN 1.0f
+#define ZOOM_MAX 20.0f
+#define ZOOM_STEP_FACTOR 1.25f
+
+// 돋보기 모드 (커서를 따라다니는 작은 창, 그 영역만 캡처/확대)
+static bool g_lensMode = false;             // 이번 세션이 돋보기
+static bool g_windowLens = false;           // g_hwndZoom이 돋보기 창 스타일로 만들어짐
+static int g_lensWidth = 400;               // 돋보기 크기 (96 DPI 기준 픽셀)
+static int g_lensHeight = 300;
+static int g_lensZoomLevel = 300;           // 돋보기 배율 (%)
+static RECT g_windowRect = {0};             // 마지막으로 놓은 창 위치 (가상 데스크톱 좌표)
+static bool g_lensHotkeys = false;          // 돋보기 조절 단축키 등록됨
+
+// 돋보기 조절 단축키 (돋보기 창은 휠/키 입력을 받지 않으므로 떠 있는 동안만 전역으로 등록)
+// Ctrl+Alt+= / Ctrl+Alt+-: 배율, Ctrl+Alt+] / Ctrl+Alt+[: 크기
+#define LENS_HOTKEY_ZOOM_IN 1
+#define LENS_HOTKEY_ZOOM_OUT 2
+#define LENS_HOTKEY_GROW 3
+#define LENS_HOTKEY_SHRINK 4
+#define LENS_SIZE_STEP 1.25f
+
+// 창 확대 모드 (시작할 때 커서 아래 창 하나만 캡처, 창이 움직이거나 크기가 바뀌면 따라감)
+static bool g_windowMode = false;           // 이번 세션이 창 확대
+static HWND g_targetWindow = NULL;
+static FrameRect g_targetBounds = {0};      // 대상 창의 보이는 영역 (가상 데스크톱 좌표)
+static float g_zoomMin = ZOOM_MIN;          // 공급원이 출력보다 작으면 (창 확대, 다른 모니터의 기록) 출력을 채우는 배율
+
+// 렌더링 관련 (커서가 있는 모니터 하나만 덮음, 돋보기면 그 모니터 안의 작은 창)
+static MonitorInfo g_monitor = {0};
 static int g_screenWidth = 0;
 static int g_screenHeight = 0;
-
-// 타이머 ID
+static int g_viewWidth = 0;                 // 확대 출력 크기 (창 크기)
+static int g_viewHeight = 0;
+static ZoomHud* g_hud = NULL;               // 모니터 DPI에 맞춘 HUD 스프라이트
+static ZoomCaptureBackend g_captureBackend = ZOOM_CAPTURE_GDI;
+static FrameSource* g_source = NULL;        // 화면 프레임 공급원 (실시간이면 닫은 뒤에도 남겨 둠)
+static bool g_sourceFrozen = false;         // g_source가 정지 화면
+static bool g_sourceWindow = false;         // g_source가 창 공급원 (세션마다 새로 만듦)
+static ZoomCaptureBackend g_sourceBackend = ZOOM_CAPTURE_GDI;
+static ZoomPipeline* g_pipeline = NULL;     // 획득 → 확대 (렌더 스레드에서만 사용)
+static ZoomRenderer* g_renderer = NULL;     // 렌더 스레드 + 삼중 백 버퍼 (HUD는 창 DC에 따로 그림)
+static WorkerPool* g_workers = NULL;        // 확대를 가로 밴드로 나눠 처리할 스레드 (렌더 스레드가 호출)
+static int g_scaleThreads = 0;              // 확대 스레드 수 설정 (0=자동, 1=렌더 스레드만)
+static int g_workersThreads = 0;            // g_workers를 만들 때의 설정
+static MagnifierView* g_magnifier = NULL;   // Magnification API 세션이면 창을 덮는 확대 컨트롤
+static bool g_magnifierFailed = false;      // 만들지 못했으면 이후 GDI
+
+// 프레임 통계 (마지막 확대 세션)
+static ZoomStats g_stats = {0};
+static TileCacheStats g_tileStats = {0};
+static ZoomRenderStats g_renderStats = {0};
+static MagnifierStats g_magnifierStats = {0};
+
+// 닫은 뒤 창/렌더러/실시간 공급원을 남겨 두는 상주 관리
+static ResidencyClient g_residency = {0};
+
+// 확대 타일 캐시 메모리 한도 (4K 화면 약 1.5장 분량)
+#define TILE_CACHE_BYTES (64u * 1024 * 1024)
+
+// 정지 화면 기록 (정지 확대를 닫을 때의 화면과 배율/확대 중심, PageUp/PageDown으로 다시 띄움)
+static SnapshotHistory* g_history = NULL;
+static int g_recallAge = -1;                        // 이번 세션이 띄운 기록 (0 = 가장 최근, -1 = 새 캡처)
+static const PixelBuffer* g_recallPixels = NULL;    // 꺼낸 기록 (g_recallAge >= 0인 동안 유효)
+static SnapshotView g_recallView = {0};
+static float g_centerX = 0.0f;                      // 마지막 확대 중심 (공급원 좌표)
+static float g_centerY = 0.0f;
+
+// 기록 한도 (4K 화면 내용이면 한 장에 1MB 안팎으로 압축됨)
+#define HISTORY_ENTRIES 32
+#define HISTORY_BYTES (48u * 1024 * 1024)
+
+// 확대/이동 전환 애니메이션 (g_zoom, g_panOffsetX/Y는 목표 값)
+static ZoomAnimation g_animation = {0};
+static int g_animationMs = 150;
+
+// 프레임 신호 (디스플레이 주기, 바뀐 것이 있을 때만 다시 그림)
+static FramePacer* g_pacer = NULL;
+static int g_shownZoomLevel = 0;                // 화면에 표시된 배율 값 (%)
+static double g_showTimeMs = 0.0;               // 확대 시작 시각 (CPU 사용률 측정)
+static double g_showCpuMs = 0.0;
+static FrameTiming g_timing = {0};
+static FrameTimingStats g_timingStats = {0};   // 마지막 확대 세션
+static bool g_framePainted = false;             // 직전 주기 이후 새 프레임을 그림
+
+// 커서 예측 (확대 중심을 프레임이 표시될 시각의 커서 위치로)
+static CursorPredictor g_predictor = {0};
+static CursorPredictionStats g_predictionStats = {0};  // 마지막 확대 세션
+static double g_predictGain = 0.75;             // 예측 강도 (0 = 끔)
+static double g_predictSmoothingMs = 16.0;      // 속도 평활 시간 상수
+
+#define WM_ZOOM_FRAME (WM_APP + 1)      // 프레임 신호 (페이서 → 창)
+#define WM_ZOOM_PRESENT (WM_APP + 2)    // 새 프레임 완성 (렌더 스레드 → 창)
+
+#ifndef WM_DPICHANGED
+#define WM_DPICHANGED 0x02E0
+#endif
+
+#ifndef WDA_EXCLUDEFROMCAPTURE
+#define WDA_EXCLUDEFROMCAPTURE 0x00000011
+#endif
+
+// 첫 프레임을 기다리는 최대 시간 (창을 띄우기 전에 캡처)
+#define FIRST_FRAME_TIMEOUT 500
+
+// 타이머 ID (페이서를 만들 수 없을 때)
 #define TIMER_UPDATE 1
 #define UPDATE_INTERVAL 16  // ~60 FPS
 
+// 실시간 전체 화면 확대가 쉬는 조건: 화면도 입력도 이만큼 연속으로 그대로면 매 주기 대신 낮은 주기로 확인만
+// (캡처/해시/확대가 주기마다 돌지 않음, 화면이 바뀌거나 입력이 오면 바로 매 주기로 돌아감)
+#define IDLE_AFTER_FRAMES 30
+#define TIMER_IDLE_POLL 2
+#define IDLE_POLL_INTERVAL 100  // 10 FPS
+static int g_unchangedFrames = 0;           // 출력이 바뀌지 않은 연속 프레임
+static bool g_idlePolling = false;          // 낮은 주기로 확인 중
+
 /**
- * 렌더링 리소스 생성
+ * 이번 세션의 캡처 방식
+ * 돋보기는 항상 GDI: 레이어드 창은 BitBlt 캡처에 찍히지 않아 돋보기가 자기 자신을 확대하지 않고,
+ * 작은 영역만 복사하면 되므로 Desktop Duplication의 이점도 없다.
+ * Magnification API는 픽셀을 주지 않으므로 정지 화면은 GDI로 한 번 캡처한다.
+ * 창 확대는 창 공급원(PrintWindow)을 쓰므로 GDI 세션과 같이 다룬다.
  */
-static bool CreateRenderResources(void)
+static ZoomCaptureBackend SessionBackend(void)
+{
+    if (g_lensMode || g_windowMode) {
+        return ZOOM_CAPTURE_GDI;
+    }
+    if (g_captureBackend == ZOOM_CAPTURE_MAGNIFIER && (g_freezeFrame || g_magnifierFailed)) {
+        return ZOOM_CAPTURE_GDI;
+    }
+    return g_captureBackend;
+}
+
+/**
+ * 화면 프레임 공급원 생성 (Desktop Duplication 실패 시 GDI, 창 확대면 그 창만)
+ */
+static FrameSource* CreateFrameSource(void)
 {
-    // 화면 크기 가져오기
-    g_screenWidth = GetSystemMetrics(SM_CXSCREEN);
-    g_screenHeight = GetSystemMetrics(SM_CYSCREEN);
+    if (g_windowMode) {
+        return FrameSource_CreateWindow(g_targetWindow);
+    }
 
-    // 화면 DC 가져오기
-    g_hdcScreen = GetDC(NULL);
-    if (!g_hdcScreen) {
-        OutputDebugStringW(L"[ZoomOverlay] Failed to get screen DC\n");
-        return false;
+    // 기록에서 꺼낸 화면 (복사 없이 꺼낸 버퍼를 그대로)
+    if (g_freezeFrame && g_recallPixels) {
+        return FrameSource_CreateStill(g_recallPixels);
+    }
+
+    FrameRect area = {g_monitor.bounds.left, g_monitor.bounds.top, g_monitor.bounds.right, g_monitor.bounds.bottom};
+
+    if (g_freezeFrame) {
+        // 오버레이 창을 띄우기 전에 한 번만 캡처 (한 번이면 GDI로 충분)
+        FrameSource* live = FrameSource_CreateGdi(&area);
+        FrameSource* snapshot = live ? FrameSource_CreateSnapshot(live) : NULL;
+        FrameSource_Destroy(live);
+        return snapshot;
+    }
+
+    if (SessionBackend() == ZOOM_CAPTURE_DUPLICATION) {
+        FrameSource* source = FrameSource_CreateDuplication(&area);
+        if (source && source->width == g_screenWidth && source->height == g_screenHeight) {
+            return source;
+        }
+
+        FrameSource_Destroy(source);
+        OutputDebugStringW(L"[ZoomOverlay] Desktop Duplication unavailable, using GDI\n");
+    }
+
+    return FrameSource_CreateGdi(&area);
+}
+
+/**
+ * 모니터에 묶인 리소스 해제 (렌더러 버퍼, 실시간 공급원, HUD)
+ */
+static void ReleaseMonitorResources(void)
+{
+    if (g_renderer) {
+        ZoomRenderer_Destroy(g_renderer);
+        g_renderer = NULL;
+    }
+
+    if (g_source) {
+        FrameSource_Destroy(g_source);
+        g_source = NULL;
+    }
+
+    if (g_hud) {
+        ZoomHud_Destroy(g_hud);
+        g_hud = NULL;
     }
+}
+
+/**
+ * 남겨 둔 리소스 해제 (유휴 시간이 지났거나 종료할 때)
+ */
+static void ReleaseResidentResources(void)
+{
+    ReleaseMonitorResources();
+
+    // 렌더러가 없으니 확대 스레드도 쉬고 있음
+    WorkerPool_Destroy(g_workers);
+    g_workers = NULL;
+
+    if (g_hwndZoom) {
+        DestroyWindow(g_hwndZoom);
+        g_hwndZoom = NULL;
+    }
+
+    memset(&g_monitor, 0, sizeof(g_monitor));
+    memset(&g_windowRect, 0, sizeof(g_windowRect));
 
-    // 메모리 DC 생성
-    g_hdcMem = CreateCompatibleDC(g_hdcScreen);
-    if (!g_hdcMem) {
-        OutputDebugStringW(L"[ZoomOverlay] Failed to create memory DC\n");
-        ReleaseDC(NULL, g_hdcScreen);
-        g_hdcScreen = NULL;
+    // 압축된 기록은 남기고 꺼내기 버퍼만 해제
+    SnapshotHistory_Trim(g_history);
+    OutputDebugStringW(L"[ZoomOverlay] Resident resources released\n");
+}
+
+/**
+ * 렌더링 리소스 생성 (커서가 있는 모니터 크기만큼, 돋보기면 돋보기 크기만큼)
+ * 창 확대면 대상 창이 있는 모니터 크기만큼.
+ * 같은 모니터에 남겨 둔 렌더러/HUD와 같은 방식의 실시간 공급원은 다시 쓴다.
+ */
+static bool CreateRenderResources(void)
+{
+    POINT cursor;
+    GetCursorPos(&cursor);
+    if (g_windowMode) {
+        cursor.x = (g_targetBounds.left + g_targetBounds.right) / 2;
+        cursor.y = (g_targetBounds.top + g_targetBounds.bottom) / 2;
+    }
+    MonitorInfo monitor;
+    if (!Monitor_FromPoint(cursor, &monitor)) {
+        OutputDebugStringW(L"[ZoomOverlay] Failed to get monitor info\n");
         return false;
     }
 
-    // 비트맵 생성
-    g_hbmScreen = CreateCompatibleBitmap(g_hdcScreen, g_screenWidth, g_screenHeight);
-    if (!g_hbmScreen) {
-        OutputDebugStringW(L"[ZoomOverlay] Failed to create bitmap\n");
-        DeleteDC(g_hdcMem);
-        ReleaseDC(NULL, g_hdcScreen);
-        g_hdcMem = NULL;
-        g_hdcScreen = NULL;
+    // 다른 모니터거나 해상도/DPI가 바뀌었으면 남겨 둔 버퍼는 쓸 수 없음
+    if (memcmp(&monitor, &g_monitor, sizeof(MonitorInfo)) != 0) {
+        ReleaseMonitorResources();
+    }
+    g_monitor = monitor;
+    g_screenWidth = g_monitor.bounds.right - g_monitor.bounds.left;
+    g_screenHeight = g_monitor.bounds.bottom - g_monitor.bounds.top;
+
+    // 출력 크기 (돋보기는 모니터 DPI에 맞추고 모니터보다 크지 않게)
+    int viewWidth = g_screenWidth;
+    int viewHeight = g_screenHeight;
+    if (g_lensMode) {
+        viewWidth = Monitor_Scale(&g_monitor, g_lensWidth);
+        viewHeight = Monitor_Scale(&g_monitor, g_lensHeight);
+        if (viewWidth > g_screenWidth) viewWidth = g_screenWidth;
+        if (viewHeight > g_screenHeight) viewHeight = g_screenHeight;
+    }
+    if (g_renderer && (viewWidth != g_viewWidth || viewHeight != g_viewHeight)) {
+        ZoomRenderer_Destroy(g_renderer);
+        g_renderer = NULL;
+    }
+    g_viewWidth = viewWidth;
+    g_viewHeight = viewHeight;
+
+    // 정지 화면과 창 공급원은 매번 새로 만들고, 실시간 공급원은 방식이 같으면 재사용
+    ZoomCaptureBackend backend = SessionBackend();
+    if (g_source && (g_freezeFrame || g_windowMode || g_sourceFrozen || g_sourceWindow ||
+                     g_sourceBackend != backend)) {
+        FrameSource_Destroy(g_source);
+        g_source = NULL;
+    }
+
+    // Magnification API는 창 안의 확대 컨트롤이 직접 그림 (창을 놓은 뒤 StartRendering에서 생성)
+    // 모니터 전체를 원본으로 쓰므로 이전 창 확대 세션의 최소 배율은 버림
+    if (backend == ZOOM_CAPTURE_MAGNIFIER) {
+        memset(&g_stats, 0, sizeof(g_stats));
+        memset(&g_tileStats, 0, sizeof(g_tileStats));
+        g_zoomMin = ZOOM_MIN;
+        OutputDebugStringW(L"[ZoomOverlay] Using Magnification API for this session\n");
+        return true;
+    }
+
+    if (!g_source) {
+        g_source = CreateFrameSource();
+        if (!g_source) {
+            OutputDebugStringW(L"[ZoomOverlay] Failed to create frame source\n");
+            return false;
+        }
+        g_sourceFrozen = g_freezeFrame;
+        g_sourceWindow = g_windowMode;
+        g_sourceBackend = backend;
+    }
+
+    // 공급원이 출력보다 작으면 (창 확대, 더 작은 모니터에서 넣은 기록) 출력을 빈틈없이 채우는 배율보다 작아지지 않게
+    float fillX = (float)g_viewWidth / g_source->width;
+    float fillY = (float)g_viewHeight / g_source->height;
+    g_zoomMin = fmaxf(ZOOM_MIN, fmaxf(fillX, fillY));
+    if (g_zoomMin > ZOOM_MAX) g_zoomMin = ZOOM_MAX;
+
+    g_pipeline = ZoomPipeline_Create(g_source);
+    if (!g_pipeline) {
+        OutputDebugStringW(L"[ZoomOverlay] Failed to create zoom pipeline\n");
         return false;
     }
 
-    g_hbmOld = (HBITMAP)SelectObject(g_hdcMem, g_hbmScreen);
+    // 확대 스레드 (설정이 바뀌었으면 다시 만듦, 만들지 못하면 렌더 스레드 혼자 확대)
+    if (g_workers && g_workersThreads != g_scaleThreads) {
+        WorkerPool_Destroy(g_workers);
+        g_workers = NULL;
+    }
+    if (!g_workers && g_scaleThreads != 1) {
+        g_workers = WorkerPool_Create(g_scaleThreads);
+        g_workersThreads = g_scaleThreads;
+        if (!g_workers) {
+            OutputDebugStringW(L"[ZoomOverlay] Scaling threads unavailable\n");
+        }
+    }
+    ZoomPipeline_SetWorkers(g_pipeline, g_workers);
+
+    // 변경 정보 없이 오는 프레임(GDI)은 타일 해시로 바뀐 곳만 다시 확대
+    if (!ZoomPipeline_EnableContentHash(g_pipeline, true)) {
+        OutputDebugStringW(L"[ZoomOverlay] Content hashing unavailable\n");
+    }
+
+    // 변경 정보가 있는 공급원이면 패닝 시 확대 타일 재사용 (GDI는 매 프레임 전체가 바뀜)
+    memset(&g_tileStats, 0, sizeof(g_tileStats));
+    if (g_freezeFrame || backend == ZOOM_CAPTURE_DUPLICATION) {
+        if (!ZoomPipeline_EnableTileCache(g_pipeline, TILE_CACHE_BYTES)) {
+            OutputDebugStringW(L"[ZoomOverlay] Tile cache unavailable\n");
+        }
+    }
+
+    if (!g_hud && !g_lensMode) {
+        g_hud = ZoomHud_Create(&g_monitor);
+    }
 
-    OutputDebugStringW(L"[ZoomOverlay] Render resources created\n");
+    WCHAR msg[160];
+    swprintf_s(msg, 160, L"[ZoomOverlay] Render resources created for %ls (%dx%d%ls, %u dpi)\n",
+               g_monitor.device, g_viewWidth, g_viewHeight,
+               g_lensMode ? L" lens" : g_windowMode ? L" window" : L"", g_monitor.dpi);
+    OutputDebugStringW(msg);
     return true;
 }
 
 /**
- * 렌더링 리소스 해제
+ * 확대 창을 화면 캡처에서 빼기 (실시간 캡처가 자기 출력을 다시 확대하지 않도록)
+ * WDA_EXCLUDEFROMCAPTURE는 Windows 10 2004부터 지원, 그 전에는 실패하고 창이 캡처에 찍힌다.
+ */
+static void ExcludeFromCapture(HWND hwnd)
+{
+    if (!SetWindowDisplayAffinity(hwnd, WDA_EXCLUDEFROMCAPTURE)) {
+        OutputDebugStringW(L"[ZoomOverlay] Capture exclusion unavailable, live capture may include the overlay\n");
+    }
+}
+
+/**
+ * 전체 화면 창을 레이어드로 바꾸거나 되돌림 (Magnification 컨트롤을 띄우는 창은 레이어드여야 함)
+ * 돋보기 창은 처음부터 레이어드라 그대로 둔다.
+ */
+static void SetLayered(bool layered)
+{
+    if (!g_hwndZoom || g_windowLens) {
+        return;
+    }
+
+    LONG_PTR exStyle = GetWindowLongPtr(g_hwndZoom, GWL_EXSTYLE);
+    if (layered) {
+        SetWindowLongPtr(g_hwndZoom, GWL_EXSTYLE, exStyle | WS_EX_LAYERED);
+        SetLayeredWindowAttributes(g_hwndZoom, 0, 255, LWA_ALPHA);
+    } else if (exStyle & WS_EX_LAYERED) {
+        SetWindowLongPtr(g_hwndZoom, GWL_EXSTYLE, exStyle & ~WS_EX_LAYERED);
+    }
+}
+
+/**
+ * 이번 확대 세션의 리소스 해제 (파이프라인, 정지 화면)
+ * 렌더러와 실시간 공급원, 창은 상주 관리에 맡긴다.
+ * saveSnapshot: 새로 캡처한 정지 화면을 지금 배율/확대 중심과 함께 기록에 넣음 (넣으면 기록이 파괴)
  */
-static void DestroyRenderResources(void)
+static void DestroyRenderResources(bool saveSnapshot)
 {
-    if (g_hbmOld) {
-        SelectObject(g_hdcMem, g_hbmOld);
-        g_hbmOld = NULL;
+    // Magnification 컨트롤은 세션마다 새로 만듦 (창은 남겨 둠)
+    if (g_magnifier) {
+        MagnifierView_GetStats(g_magnifier, &g_magnifierStats);
+        MagnifierView_Destroy(g_magnifier);
+        g_magnifier = NULL;
+        SetLayered(false);
+    }
+
+    // 렌더 스레드가 쉬는 것을 확인한 뒤 파이프라인 분리
+    if (g_renderer) {
+        ZoomRenderer_WaitIdle(g_renderer, INFINITE);
+        ZoomRenderer_GetStats(g_renderer, &g_renderStats);
+        ZoomRenderer_SetPipeline(g_renderer, NULL);
     }
 
-    if (g_hbmScreen) {
-        DeleteObject(g_hbmScreen);
-        g_hbmScreen = NULL;
+    if (g_pipeline) {
+        ZoomPipeline_GetStats(g_pipeline, &g_stats);
+        ZoomPipeline_GetTileStats(g_pipeline, &g_tileStats);
+        ZoomPipeline_Destroy(g_pipeline);
+        g_pipeline = NULL;
     }
 
-    if (g_hdcMem) {
-        DeleteDC(g_hdcMem);
-        g_hdcMem = NULL;
+    if (g_source && (g_sourceFrozen || g_sourceWindow)) {
+        if (saveSnapshot && g_sourceFrozen && g_recallAge < 0 && g_history) {
+            // 압축은 기록의 배경 스레드가 함 (여기서는 넘기기만)
+            SnapshotView view = {g_zoom, g_centerX, g_centerY};
+            SnapshotHistory_Push(g_history, g_source, &view);
+        } else {
+            FrameSource_Destroy(g_source);
+        }
+        g_source = NULL;
     }
 
-    if (g_hdcScreen) {
-        ReleaseDC(NULL, g_hdcScreen);
-        g_hdcScreen = NULL;
+    // 꺼낸 기록을 빌려 쓴 공급원이 없어졌으므로 버퍼 반환
+    if (g_recallPixels) {
+        SnapshotHistory_Release(g_history);
+        g_recallPixels = NULL;
     }
 
-    OutputDebugStringW(L"[ZoomOverlay] Render resources destroyed\n");
+    // HUD 스프라이트는 내용이 바뀔 때만 다시 그림 (남겨 둔 HUD는 누적)
+    WCHAR msg[128];
+    swprintf_s(msg, 128, L"[ZoomOverlay] Render resources destroyed (HUD sprites built %llu times)\n",
+               ZoomHud_GetRebuilds(g_hud));
+    OutputDebugStringW(msg);
 }
 
 /**
- * 화면 확대 렌더링
+ * 프로세스 CPU 사용 시간 (밀리초, 커널 + 사용자)
  */
-static void RenderZoom(HDC hdc)
+static double GetProcessCpuMs(void)
+{
+    FILETIME creation, exitTime, kernel, user;
+    if (!GetProcessTimes(GetCurrentProcess(), &creation, &exitTime, &kernel, &user)) {
+        return 0.0;
+    }
+
+    ULONGLONG k = ((ULONGLONG)kernel.dwHighDateTime << 32) | kernel.dwLowDateTime;
+    ULONGLONG u = ((ULONGLONG)user.dwHighDateTime << 32) | user.dwLowDateTime;
+    return (double)(k + u) / 10000.0;
+}
+
+/**
+ * 창 위치 (전체 모드는 모니터 전체, 돋보기는 커서 중심)
+ */
+static RECT WindowBounds(POINT cursor)
+{
+    RECT rect = g_monitor.bounds;
+    if (g_lensMode) {
+        rect.left = cursor.x - g_viewWidth / 2;
+        rect.top = cursor.y - g_viewHeight / 2;
+        rect.right = rect.left + g_viewWidth;
+        rect.bottom = rect.top + g_viewHeight;
+    }
+    return rect;
+}
+
+/**
+ * 창을 현재 모드/커서에 맞게 놓기 (위치가 그대로면 아무것도 안 함)
+ */
+static void PlaceWindow(POINT cursor)
+{
+    RECT rect = WindowBounds(cursor);
+    if (!g_hwndZoom || EqualRect(&rect, &g_windowRect)) {
+        return;
+    }
+
+    SetWindowPos(g_hwndZoom, HWND_TOPMOST, rect.left, rect.top,
+                 rect.right - rect.left, rect.bottom - rect.top, SWP_NOACTIVATE);
+    g_windowRect = rect;
+}
+
+/**
+ * 표시용 배율 (%)
+ */
+static int ZoomPercent(void)
+{
+    return (int)lroundf(g_zoom * 100.0f);
+}
+
+/**
+ * Magnification 컨트롤에 뷰 적용 (창 스레드에서 바로 그림)
+ * 원본 영역은 정수 픽셀이라 확대 중심의 서브픽셀은 버려진다.
+ */
+static void UpdateMagnifier(const ZoomView* view)
+{
+    // 출력을 채우는 원본 크기와 위치 (모니터 안으로 제한)
+    int width = (int)ceil(g_viewWidth / view->zoom);
+    int height = (int)ceil(g_viewHeight / view->zoom);
+    if (width > g_screenWidth) width = g_screenWidth;
+    if (height > g_screenHeight) height = g_screenHeight;
+
+    int left = (int)lround(view->centerX - width / 2.0);
+    int top = (int)lround(view->centerY - height / 2.0);
+    if (left > g_screenWidth - width) left = g_screenWidth - width;
+    if (top > g_screenHeight - height) top = g_screenHeight - height;
+    if (left < 0) left = 0;
+    if (top < 0) top = 0;
+
+    RECT source = {g_monitor.bounds.left + left, g_monitor.bounds.top + top,
+                   g_monitor.bounds.left + left + width, g_monitor.bounds.top + top + height};
+    if (!MagnifierView_Update(g_magnifier, view->zoom, &source, view->filter != SCALE_FILTER_NEAREST, view->color)) {
+        return;
+    }
+
+    // 창의 WM_PAINT를 거치지 않으므로 표시 기록을 여기서
+    g_shownZoomLevel = ZoomPercent();
+    FrameTiming_AddFrame(&g_timing, FramePacer_Now());
+    g_framePainted = true;
+    if (g_bActive) {
+        Residency_FrameShown(&g_residency);
+    }
+}
+
+/**
+ * 낮은 주기 확인 켜고 끄기 (켜져 있으면 타이머가 한 번씩 프레임을 요청)
+ */
+static void SetIdlePolling(bool idle)
+{
+    if (idle == g_idlePolling) {
+        return;
+    }
+    g_idlePolling = idle;
+
+    if (idle) {
+        SetTimer(g_hwndZoom, TIMER_IDLE_POLL, IDLE_POLL_INTERVAL, NULL);
+        OutputDebugStringW(L"[ZoomOverlay] Screen unchanged, polling at low rate\n");
+    } else {
+        KillTimer(g_hwndZoom, TIMER_IDLE_POLL);
+    }
+}
+
+/**
+ * 현재 뷰를 렌더 스레드에 요청 (기다리지 않음, 완성되면 WM_ZOOM_PRESENT)
+ */
+static void UpdateZoom(void)
 {
     POINT cursor;
     GetCursorPos(&cursor);
+    double now = FramePacer_Now();
+
+    // 전환 중이면 보간된 배율/패닝
+    ZoomState state;
+    bool animating = ZoomAnimation_Sample(&g_animation, now, &state);
+
+    // 프레임이 표시될 시각(렌더 스레드 처리 + 한 주기 뒤)의 커서 위치
+    // 드래그 중에는 패닝이 실제 커서를 따라가므로 예측하지 않음
+    double cursorX = cursor.x;
+    double cursorY = cursor.y;
+    if (!g_bDragging) {
+        ZoomRenderStats renderStats = {0};
+        MagnifierStats magnifierStats = {0};
+        ZoomRenderer_GetStats(g_renderer, &renderStats);
+        MagnifierView_GetStats(g_magnifier, &magnifierStats);
+        double renderMs = g_magnifier ? magnifierStats.meanMs : renderStats.meanMs;
+        CursorPredictor_AddSample(&g_predictor, now, cursorX, cursorY);
+        CursorPredictor_Predict(&g_predictor, now + renderMs + FramePacer_GetPeriodMs(g_pacer),
+                                &cursorX, &cursorY);
+
+        // 예측이 모니터 밖으로 넘치지 않게
+        cursorX = fmax(g_monitor.bounds.left, fmin(cursorX, g_monitor.bounds.right - 1));
+        cursorY = fmax(g_monitor.bounds.top, fmin(cursorY, g_monitor.bounds.bottom - 1));
+        cursor.x = lround(cursorX);
+        cursor.y = lround(cursorY);
+    }
+
+    // 돋보기 창은 커서를 따라감 (레이어드 창이라 다음 캡처에 찍히지 않음)
+    if (g_lensMode) {
+        PlaceWindow(cursor);
+    }
 
-    // 확대 배율 계산
-    float zoom = (float)g_zoomLevel / 100.0f;
+    // 확대 중심은 커서 위치 + 패닝 오프셋 (모니터 기준 좌표, 창 확대면 창 기준 좌표)
+    long originX = g_windowMode ? g_targetBounds.left : g_monitor.bounds.left;
+    long originY = g_windowMode ? g_targetBounds.top : g_monitor.bounds.top;
+    ZoomView view;
+    view.zoom = state.zoom;
+    view.centerX = (float)(cursorX - originX) + state.panX;
+    view.centerY = (float)(cursorY - originY) + state.panY;
+    g_centerX = view.centerX;
+    g_centerY = view.centerY;
+    view.filter = !g_smoothZoom ? SCALE_FILTER_NEAREST :
+                  g_sharpZoom ? SCALE_FILTER_LANCZOS3 : SCALE_FILTER_BILINEAR;
+    view.color = g_colorFilter;
+    view.linearLight = g_linearLight;
+    view.transient = animating;
+
+    // 보이는 영역만 획득하고, 바뀐 부분만 다시 확대 (바뀐 것이 없으면 알림 없음)
+    // Magnification API면 배율과 원본 영역만 넘기고 확대는 컴포지터가 함
+    if (g_magnifier) {
+        UpdateMagnifier(&view);
+    } else {
+        ZoomRenderer_Submit(g_renderer, &view);
+    }
 
-    // 캡처할 영역 크기 (확대 후 화면 전체를 채우도록)
-    int captureWidth = (int)(g_screenWidth / zoom);
-    int captureHeight = (int)(g_screenHeight / zoom);
+    // 전환 중이거나 실시간 화면이면 매 주기, 아니면 입력이 있을 때만
+    // (커서가 멈춘 뒤 예측이 제자리로 돌아올 때까지도 매 주기)
+    // 실시간 전체 화면도 화면과 입력이 한동안 그대로면 낮은 주기로 확인만 함
+    // (돋보기/창 확대는 창 위치를 따라가야 하고, Magnification API는 바뀐 것을 알려 주지 않으므로 제외)
+    bool input = animating || CursorPredictor_IsMoving(&g_predictor);
+    bool live = !g_freezeFrame;
+    if (live && !input && g_pacer && !g_magnifier && !g_lensMode && !g_windowMode) {
+        g_unchangedFrames++;
+    } else {
+        g_unchangedFrames = 0;
+    }
+    bool idle = g_unchangedFrames >= IDLE_AFTER_FRAMES;
+    SetIdlePolling(idle);
+    FramePacer_SetContinuous(g_pacer, input || (live && !idle));
+}
 
-    // 캡처 영역의 중심을 커서 위치 + 패닝 오프셋으로
-    int captureX = cursor.x - captureWidth / 2 + g_panOffsetX;
-    int captureY = cursor.y - captureHeight / 2 + g_panOffsetY;
+/**
+ * 확대 결과와 UI를 창에 그리기 (확대 프레임을 그렸으면 true)
+ */
+static bool PresentZoom(HDC hdc)
+{
+    // 완성된 가장 최근 프레임 (렌더 스레드가 다음 프레임을 쓰는 중이어도 기다리지 않음)
+    bool presented = ZoomRenderer_Present(g_renderer, hdc);
+    g_shownZoomLevel = ZoomPercent();
 
-    // 화면 경계 체크
-    if (captureX < 0) captureX = 0;
-    if (captureY < 0) captureY = 0;
-    if (captureX + captureWidth > g_screenWidth) {
-        captureX = g_screenWidth - captureWidth;
+    // 십자선, 배율 표시, 힌트 (미리 그려 둔 스프라이트 합성, 돋보기는 확대 화면만)
+    if (!g_lensMode) {
+        ZoomHud_Draw(g_hud, hdc, g_shownZoomLevel, g_freezeFrame);
     }
-    if (captureY + captureHeight > g_screenHeight) {
-        captureY = g_screenHeight - captureHeight;
+    return presented;
+}
+
+/**
+ * 렌더 스레드와 프레임 신호 시작 (창을 g_monitor에 맞춘 뒤)
+ */
+static bool StartRendering(void)
+{
+    memset(&g_renderStats, 0, sizeof(g_renderStats));
+    memset(&g_magnifierStats, 0, sizeof(g_magnifierStats));
+
+    // Magnification API: 창을 덮는 확대 컨트롤 (만들지 못하면 이번 세션부터 GDI로 다시 준비)
+    if (SessionBackend() == ZOOM_CAPTURE_MAGNIFIER) {
+        SetLayered(true);
+        g_magnifier = MagnifierView_Create(g_hwndZoom, g_viewWidth, g_viewHeight);
+        if (!g_magnifier) {
+            OutputDebugStringW(L"[ZoomOverlay] Magnifier unavailable, using GDI\n");
+            g_magnifierFailed = true;
+            SetLayered(false);
+            DestroyRenderResources(false);
+            if (!CreateRenderResources()) {
+                return false;
+            }
+        }
+    } else {
+        // 이전 세션이 Magnification API였으면 일반 창으로 되돌림 (WM_PAINT로 직접 그림)
+        SetLayered(false);
     }
 
-    // 화면 캡처
-    BitBlt(g_hdcMem, 0, 0, g_screenWidth, g_screenHeight, g_hdcScreen, 0, 0, SRCCOPY);
+    // 새 프레임이 완성되면 창에 WM_ZOOM_PRESENT (남겨 둔 렌더러는 버퍼와 스레드를 그대로 씀)
+    // Magnification API 세션은 렌더 스레드를 쓰지 않음 (남겨 둔 렌더러는 다음 세션에 재사용)
+    if (!g_magnifier) {
+        if (g_renderer) {
+            ZoomRenderer_SetPipeline(g_renderer, g_pipeline);
+        } else {
+            g_renderer = ZoomRenderer_Create(g_pipeline, g_viewWidth, g_viewHeight, g_hwndZoom, WM_ZOOM_PRESENT);
+            if (!g_renderer) {
+                OutputDebugStringW(L"[ZoomOverlay] Failed to create zoom renderer\n");
+                return false;
+            }
+        }
+    }
 
-    // 확대하여 그리기
-    if (g_smoothZoom) {
-        // 부드러운 확대 (HALFTONE 모드)
-        int oldMode = SetStretchBltMode(hdc, HALFTONE);
-        SetBrushOrgEx(hdc, 0, 0, NULL);
-        StretchBlt(
-            hdc, 0, 0, g_screenWidth, g_screenHeight,
-            g_hdcMem, captureX, captureY, captureWidth, captureHeight,
-            SRCCOPY
-        );
-        SetStretchBltMode(hdc, oldMode);
+    // 창이 있는 모니터의 디스플레이 주기에 맞춘 프레임 신호 (실패하면 일반 타이머)
+    SetIdlePolling(false);
+    g_unchangedFrames = 0;
+    g_pacer = FramePacer_Create(g_hwndZoom, WM_ZOOM_FRAME);
+    FrameTiming_Reset(&g_timing, FramePacer_GetPeriodMs(g_pacer));
+    CursorPredictor_Reset(&g_predictor, g_predictSmoothingMs, g_predictGain);
+    if (g_pacer) {
+        FramePacer_SetContinuous(g_pacer, !g_freezeFrame);
     } else {
-        // 빠른 확대 (COLORONCOLOR 모드)
-        SetStretchBltMode(hdc, COLORONCOLOR);
-        StretchBlt(
-            hdc, 0, 0, g_screenWidth, g_screenHeight,
-            g_hdcMem, captureX, captureY, captureWidth, captureHeight,
-            SRCCOPY
-        );
+        SetTimer(g_hwndZoom, TIMER_UPDATE, UPDATE_INTERVAL, NULL);
+    }
+    return true;
+}
+
+/**
+ * 확대 중에 렌더링 리소스를 다시 만들고 창을 옮김 (모니터 이동, 돋보기 크기 변경)
+ * 실패하면 확대를 끝내고 false
+ */
+static bool RestartRendering(void)
+{
+    if (g_pacer) {
+        FramePacer_Destroy(g_pacer);
+        g_pacer = NULL;
+    }
+    DestroyRenderResources(false);
+
+    if (!CreateRenderResources()) {
+        ZoomOverlay_Hide();
+        return false;
+    }
+
+    POINT cursor;
+    GetCursorPos(&cursor);
+    PlaceWindow(cursor);
+
+    if (!StartRendering()) {
+        ZoomOverlay_Hide();
+        return false;
+    }
+    return true;
+}
+
+/**
+ * 커서가 다른 모니터로 가면 오버레이와 버퍼를 그 모니터로 옮김 (실시간 확대만)
+ * 버퍼는 항상 모니터 하나 크기라 가상 데스크톱 전체를 캡처/복사하지 않는다.
+ * 확대 중에는 창이 모니터 하나를 덮으므로 false를 돌려주면 확대를 끝낸 것.
+ */
+static bool FollowCursorMonitor(void)
+{
+    // 정지 화면은 시작한 모니터의 캡처만 있음, 드래그 중에는 커서가 밖으로 나가도 유지
+    if (g_freezeFrame || g_bDragging) {
+        return true;
+    }
+
+    POINT cursor;
+    GetCursorPos(&cursor);
+    if (MonitorFromPoint(cursor, MONITOR_DEFAULTTONEAREST) == g_monitor.handle) {
+        return true;
     }
 
-    // 십자선 그리기 (선택 사항)
-    HPEN hPen = CreatePen(PS_SOLID, 2, RGB(255, 0, 0));
-    HPEN hOldPen = (HPEN)SelectObject(hdc, hPen);
+    OutputDebugStringW(L"[ZoomOverlay] Cursor moved to another monitor\n");
+    return RestartRendering();
+}
+
+/**
+ * 창 확대의 대상 창을 따라감
+ * 이동만 했으면 확대 중심의 기준만 옮기고 (창 공급원 좌표는 창 기준이라 그대로),
+ * 크기가 바뀌었거나 다른 모니터로 갔으면 공급원과 버퍼를 다시 만든다.
+ * 창이 닫히거나 최소화되면 확대를 끝내고 false.
+ */
+static bool FollowTargetWindow(void)
+{
+    FrameRect bounds;
+    if (!FrameSource_GetWindowBounds(g_targetWindow, &bounds)) {
+        OutputDebugStringW(L"[ZoomOverlay] Target window closed or minimized\n");
+        ZoomOverlay_Hide();
+        return false;
+    }
 
-    int centerX = g_screenWidth / 2;
-    int centerY = g_screenHeight / 2;
-    int crossSize = 20;
+    bool resized = bounds.right - bounds.left != g_targetBounds.right - g_targetBounds.left ||
+                   bounds.bottom - bounds.top != g_targetBounds.bottom - g_targetBounds.top;
+    g_targetBounds = bounds;
 
-    MoveToEx(hdc, centerX - crossSize, centerY, NULL);
-    LineTo(hdc, centerX + crossSize, centerY);
-    MoveToEx(hdc, centerX, centerY - crossSize, NULL);
-    LineTo(hdc, centerX, centerY + crossSize);
+    POINT center = {(bounds.left + bounds.right) / 2, (bounds.top + bounds.bottom) / 2};
+    if (!resized && MonitorFromPoint(center, MONITOR_DEFAULTTONEAREST) == g_monitor.handle) {
+        return true;
+    }
 
-    SelectObject(hdc, hOldPen);
-    DeleteObject(hPen);
+    OutputDebugStringW(L"[ZoomOverlay] Target window resized or moved to another monitor\n");
+    if (!RestartRendering()) {
+        return false;
+    }
 
-    // UI 오버레이 그리기 (줌 레벨 표시)
-    SetBkMode(hdc, TRANSPARENT);
-    SetTextColor(hdc, RGB(255, 255, 255));
+    // 창이 작아졌으면 다시 모니터를 채우는 배율로 (전환 없이 바로)
+    if (g_zoom < g_zoomMin) {
+        g_zoom = g_zoomMin;
+        ZoomState state = {g_zoom, g_panOffsetX, g_panOffsetY};
+        ZoomAnimation_Jump(&g_animation, &state);
+    }
+    return true;
+}
 
-    WCHAR zoomText[64];
-    swprintf_s(zoomText, 64, L"확대: %d%%", g_zoomLevel);
+/**
+ * 확대 대상을 따라감 (창 확대면 대상 창, 아니면 커서가 있는 모니터)
+ */
+static bool FollowTarget(void)
+{
+    return g_windowMode ? FollowTargetWindow() : FollowCursorMonitor();
+}
 
-    RECT textRect = {20, 20, 300, 60};
+/**
+ * 목표 배율/패닝(g_zoom, g_panOffsetX/Y)으로 전환 시작
+ */
+static void AnimateToTarget(void)
+{
+    ZoomState target;
+    target.zoom = g_zoom;
+    target.panX = g_panOffsetX;
+    target.panY = g_panOffsetY;
 
-    // 반투명 배경
-    HBRUSH hBrush = CreateSolidBrush(RGB(0, 0, 0));
-    HBRUSH hOldBrush = (HBRUSH)SelectObject(hdc, hBrush);
-    HPEN hTransPen = CreatePen(PS_NULL, 0, 0);
-    HPEN hOldTransPen = (HPEN)SelectObject(hdc, hTransPen);
+    ZoomAnimation_Start(&g_animation, &target, FramePacer_Now(), g_animationMs);
+    FramePacer_RequestFrame(g_pacer);
+}
 
-    Rectangle(hdc, textRect.left, textRect.top, textRect.right, textRect.bottom);
+/**
+ * 목표 배율에 단계 곱하기 (steps: 휠 칸 수, 고해상도 휠이면 소수, 음수면 축소)
+ * 배율을 곱으로 바꾸므로 어느 배율에서든 한 칸의 체감 변화가 같다.
+ */
+static void ZoomBySteps(float steps)
+{
+    g_zoom *= powf(ZOOM_STEP_FACTOR, steps);
+    if (g_zoom > ZOOM_MAX) g_zoom = ZOOM_MAX;
+    if (g_zoom < g_zoomMin) g_zoom = g_zoomMin;
+    AnimateToTarget();
+}
 
-    SelectObject(hdc, hOldTransPen);
-    SelectObject(hdc, hOldBrush);
-    DeleteObject(hTransPen);
-    DeleteObject(hBrush);
+/**
+ * 색 필터 켜고 끄기 (켜진 필터를 다시 고르면 끔)
+ */
+static void ToggleColorFilter(ColorFilter filter)
+{
+    g_colorFilter = (g_colorFilter == filter) ? COLOR_FILTER_NONE : filter;
 
-    // 텍스트
-    DrawTextW(hdc, zoomText, -1, &textRect, DT_CENTER | DT_VCENTER | DT_SINGLELINE);
+    wchar_t msg[64];
+    swprintf_s(msg, 64, L"[ZoomOverlay] Color filter: %d\n", (int)g_colorFilter);
+    OutputDebugStringW(msg);
 
-    // ESC 힌트
-    WCHAR hintText[] = L"ESC: 종료 | 휠: 줌 | 드래그: 이동 | +/-: 줌 조절";
-    RECT hintRect = {20, g_screenHeight - 60, g_screenWidth - 20, g_screenHeight - 20};
-    DrawTextW(hdc, hintText, -1, &hintRect, DT_CENTER | DT_VCENTER | DT_SINGLELINE);
+    // 정지 화면은 입력이 있을 때만 그리므로 새 필터로 한 프레임 요청
+    FramePacer_RequestFrame(g_pacer);
+}
+
+/**
+ * 꺼낸 기록의 배율/확대 중심으로 바로 맞춤 (지금 커서 위치에서 그 중심이 보이도록 패닝)
+ */
+static void ApplyRecallView(void)
+{
+    POINT cursor;
+    GetCursorPos(&cursor);
+
+    g_zoom = g_recallView.zoom;
+    if (g_zoom > ZOOM_MAX) g_zoom = ZOOM_MAX;
+    if (g_zoom < g_zoomMin) g_zoom = g_zoomMin;
+    g_panOffsetX = g_recallView.centerX - (float)(cursor.x - g_monitor.bounds.left);
+    g_panOffsetY = g_recallView.centerY - (float)(cursor.y - g_monitor.bounds.top);
+
+    ZoomState state = {g_zoom, g_panOffsetX, g_panOffsetY};
+    ZoomAnimation_Jump(&g_animation, &state);
+}
+
+/**
+ * 기록 꺼내기 (g_recallAge, g_recallPixels, g_recallView를 채움)
+ */
+static bool LoadRecall(int age)
+{
+    g_recallPixels = SnapshotHistory_Load(g_history, age, &g_recallView);
+    if (!g_recallPixels) {
+        g_recallAge = -1;
+        return false;
+    }
+    g_recallAge = age;
+    return true;
+}
+
+/**
+ * 정지 확대 중에 이전/다음 기록으로 바꿈 (step: 1 = 더 오래된 것, -1 = 더 최근 것)
+ * 새로 캡처한 화면이면 먼저 기록에 넣으므로 돌아올 수 있다.
+ * 공급원만 바꾸고 창과 렌더러는 그대로 쓴다.
+ */
+static void StepHistory(int step)
+{
+    if (!g_history || !g_freezeFrame || g_lensMode || g_windowMode) {
+        return;
+    }
+
+    // 새 캡처는 넣은 뒤 age 0이 되므로 그 다음부터
+    int count = SnapshotHistory_GetCount(g_history);
+    int age = g_recallAge < 0 ? step : g_recallAge + step;
+    int limit = g_recallAge < 0 ? count + 1 : count;
+    if (age < 0 || age >= limit) {
+        return;
+    }
+
+    if (g_pacer) {
+        FramePacer_Destroy(g_pacer);
+        g_pacer = NULL;
+    }
+    DestroyRenderResources(true);
+
+    // 넣으면서 한도에 밀려 줄었으면 남은 것 중 가장 오래된 것
+    count = SnapshotHistory_GetCount(g_history);
+    if (age >= count) age = count - 1;
+
+    if (!LoadRecall(age) || !CreateRenderResources()) {
+        OutputDebugStringW(L"[ZoomOverlay] Failed to recall snapshot\n");
+        ZoomOverlay_Hide();
+        return;
+    }
+    ApplyRecallView();
+
+    POINT cursor;
+    GetCursorPos(&cursor);
+    PlaceWindow(cursor);
+
+    if (!StartRendering()) {
+        ZoomOverlay_Hide();
+        return;
+    }
+
+    WCHAR msg[96];
+    swprintf_s(msg, 96, L"[ZoomOverlay] Recalled snapshot %d of %d\n", age + 1, count);
+    OutputDebugStringW(msg);
+    FramePacer_RequestFrame(g_pacer);
+}
+
+/**
+ * 돋보기 조절 단축키 등록 (이미 쓰이는 조합은 건너뜀)
+ */
+static void RegisterLensHotkeys(void)
+{
+    bool registered = RegisterHotKey(g_hwndZoom, LENS_HOTKEY_ZOOM_IN, MOD_CONTROL | MOD_ALT, VK_OEM_PLUS);
+    registered &= RegisterHotKey(g_hwndZoom, LENS_HOTKEY_ZOOM_OUT, MOD_CONTROL | MOD_ALT, VK_OEM_MINUS) != 0;
+    registered &= RegisterHotKey(g_hwndZoom, LENS_HOTKEY_GROW, MOD_CONTROL | MOD_ALT, VK_OEM_6) != 0;
+    registered &= RegisterHotKey(g_hwndZoom, LENS_HOTKEY_SHRINK, MOD_CONTROL | MOD_ALT, VK_OEM_4) != 0;
+    if (!registered) {
+        OutputDebugStringW(L"[ZoomOverlay] Some lens hotkeys unavailable\n");
+    }
+    g_lensHotkeys = true;
+}
+
+/**
+ * 돋보기 조절 단축키 해제
+ */
+static void UnregisterLensHotkeys(void)
+{
+    if (!g_lensHotkeys) {
+        return;
+    }
+    UnregisterHotKey(g_hwndZoom, LENS_HOTKEY_ZOOM_IN);
+    UnregisterHotKey(g_hwndZoom, LENS_HOTKEY_ZOOM_OUT);
+    UnregisterHotKey(g_hwndZoom, LENS_HOTKEY_GROW);
+    UnregisterHotKey(g_hwndZoom, LENS_HOTKEY_SHRINK);
+    g_lensHotkeys = false;
+}
+
+/**
+ * 돋보기 조절 단축키 처리 (바꾼 배율/크기는 다음 돋보기에도 유지)
+ */
+static void HandleLensHotkey(int id)
+{
+    switch (id) {
+        case LENS_HOTKEY_ZOOM_IN:
+        case LENS_HOTKEY_ZOOM_OUT:
+            ZoomBySteps(id == LENS_HOTKEY_ZOOM_IN ? 1.0f : -1.0f);
+            g_lensZoomLevel = (int)(g_zoom * 100.0f + 0.5f);
+            break;
+
+        case LENS_HOTKEY_GROW:
+        case LENS_HOTKEY_SHRINK: {
+            float scale = id == LENS_HOTKEY_GROW ? LENS_SIZE_STEP : 1.0f / LENS_SIZE_STEP;
+            ZoomOverlay_SetLens((int)(g_lensWidth * scale + 0.5f), (int)(g_lensHeight * scale + 0.5f),
+                                g_lensZoomLevel);
+            break;
+        }
+    }
+
+    WCHAR msg[96];
+    swprintf_s(msg, 96, L"[ZoomOverlay] Lens %dx%d at %d%%\n", g_lensWidth, g_lensHeight, g_lensZoomLevel);
+    OutputDebugStringW(msg);
 }
 
 /**
@@ -217,16 +1005,63 @@ static LRESULT CALLBACK ZoomWndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM l
         case WM_PAINT: {
             PAINTSTRUCT ps;
             HDC hdc = BeginPaint(hwnd, &ps);
-            RenderZoom(hdc);
+
+            // Magnification 컨트롤이 창 전체를 덮고 스스로 그림 (표시 기록은 UpdateMagnifier)
+            if (g_magnifier) {
+                EndPaint(hwnd, &ps);
+                return 0;
+            }
+
+            bool presented = PresentZoom(hdc);
             EndPaint(hwnd, &ps);
+
+            // 단축키 → 첫 프레임 지연 (활성화 후 처음 한 번만 기록)
+            if (presented) {
+                Residency_FrameShown(&g_residency);
+            }
+
+            FrameTiming_AddFrame(&g_timing, FramePacer_Now());
+            g_framePainted = true;
             return 0;
         }
 
-        case WM_TIMER:
-            if (wParam == TIMER_UPDATE) {
-                // 강제 다시 그리기
+        case WM_ZOOM_FRAME:
+            // 직전 주기에 그린 것이 없으면 쉰 시간은 프레임 간격에서 제외
+            if (!g_framePainted) {
+                FrameTiming_Break(&g_timing);
+            }
+            g_framePainted = false;
+
+            if (!FollowTarget()) {
+                return 0;
+            }
+            UpdateZoom();
+
+            // 배율 표시가 바뀌면 확대 결과를 기다리지 않고 다시 그림
+            if (ZoomPercent() != g_shownZoomLevel) {
                 InvalidateRect(hwnd, NULL, FALSE);
             }
+            FramePacer_FrameDone(g_pacer);
+            return 0;
+
+        case WM_ZOOM_PRESENT:
+            // 렌더 스레드가 새 프레임을 완성함 (화면이 바뀌었으므로 쉬던 중이면 바로 매 주기로)
+            InvalidateRect(hwnd, NULL, FALSE);
+            g_unchangedFrames = 0;
+            if (g_idlePolling) {
+                FramePacer_RequestFrame(g_pacer);
+            }
+            return 0;
+
+        case WM_TIMER:
+            if (wParam == TIMER_IDLE_POLL) {
+                FramePacer_RequestFrame(g_pacer);
+            } else if (wParam == TIMER_UPDATE && FollowTarget()) {
+                UpdateZoom();
+                if (ZoomPercent() != g_shownZoomLevel) {
+                    InvalidateRect(hwnd, NULL, FALSE);
+                }
+            }
             return 0;
 
         case WM_KEYDOWN:
@@ -238,62 +1073,85 @@ static LRESULT CALLBACK ZoomWndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM l
                     break;
 
                 case VK_ADD:
-                case VK_OEM_PLUS:
-                case 187:  // '=' key
+                case VK_OEM_PLUS:  // '=' key
                     // + 키로 확대
-                    g_zoomLevel += 25;
-                    if (g_zoomLevel > 2000) g_zoomLevel = 2000;
-                    InvalidateRect(hwnd, NULL, FALSE);
+                    ZoomBySteps(1.0f);
                     break;
 
                 case VK_SUBTRACT:
-                case VK_OEM_MINUS:
-                case 189:  // '-' key
+                case VK_OEM_MINUS:  // '-' key
                     // - 키로 축소
-                    g_zoomLevel -= 25;
-                    if (g_zoomLevel < 100) g_zoomLevel = 100;
-                    InvalidateRect(hwnd, NULL, FALSE);
+                    ZoomBySteps(-1.0f);
                     break;
 
                 case VK_LEFT:
                     // 왼쪽 화살표
-                    g_panOffsetX -= 50;
-                    InvalidateRect(hwnd, NULL, FALSE);
+                    g_panOffsetX -= 50.0f;
+                    AnimateToTarget();
                     break;
 
                 case VK_RIGHT:
                     // 오른쪽 화살표
-                    g_panOffsetX += 50;
-                    InvalidateRect(hwnd, NULL, FALSE);
+                    g_panOffsetX += 50.0f;
+                    AnimateToTarget();
                     break;
 
                 case VK_UP:
                     // 위쪽 화살표
-                    g_panOffsetY -= 50;
-                    InvalidateRect(hwnd, NULL, FALSE);
+                    g_panOffsetY -= 50.0f;
+                    AnimateToTarget();
                     break;
 
                 case VK_DOWN:
                     // 아래쪽 화살표
-                    g_panOffsetY += 50;
-                    InvalidateRect(hwnd, NULL, FALSE);
+                    g_panOffsetY += 50.0f;
+                    AnimateToTarget();
+                    break;
+
+                case VK_PRIOR:
+                    // Page Up: 이전 정지 화면 기록
+                    StepHistory(1);
+                    break;
+
+                case VK_NEXT:
+                    // Page Down: 다음 (더 최근) 정지 화면 기록
+                    StepHistory(-1);
+                    break;
+
+                case 'I':
+                    // 색 반전
+                    ToggleColorFilter(COLOR_FILTER_INVERT);
+                    break;
+
+                case 'G':
+                    // 회색조
+                    ToggleColorFilter(COLOR_FILTER_GRAYSCALE);
+                    break;
+
+                case 'H':
+                    // 대비 강조
+                    ToggleColorFilter(COLOR_FILTER_HIGH_CONTRAST);
+                    break;
+
+                case 'D':
+                    // 적록 색약 보정
+                    ToggleColorFilter(COLOR_FILTER_DEUTERANOPIA);
                     break;
             }
             return 0;
 
+        case WM_HOTKEY:
+            // 돋보기 조절 (돋보기가 떠 있는 동안만 등록됨)
+            if (g_bActive && g_lensMode) {
+                HandleLensHotkey((int)wParam);
+            }
+            return 0;
+
         case WM_MOUSEWHEEL: {
-            // 마우스 휠로 줌 레벨 조절
+            // 마우스 휠로 줌 조절 (위로 확대, 아래로 축소)
+            // 고해상도 휠/터치패드는 WHEEL_DELTA보다 작게 여러 번 오므로 이동량에 비례해 연속으로
             int delta = GET_WHEEL_DELTA_WPARAM(wParam);
-            if (delta > 0) {
-                // 휠 위로 - 확대
-                g_zoomLevel += 25;
-                if (g_zoomLevel > 2000) g_zoomLevel = 2000;
-            } else {
-                // 휠 아래로 - 축소
-                g_zoomLevel -= 25;
-                if (g_zoomLevel < 100) g_zoomLevel = 100;
-            }
-            InvalidateRect(hwnd, NULL, FALSE);
+            ZoomBySteps((float)delta / WHEEL_DELTA);
             return 0;
         }
 
@@ -302,8 +1160,8 @@ static LRESULT CALLBACK ZoomWndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM l
             g_bDragging = true;
             g_ptDragStart.x = LOWORD(lParam);
             g_ptDragStart.y = HIWORD(lParam);
-            g_ptPanStart.x = g_panOffsetX;
-            g_ptPanStart.y = g_panOffsetY;
+            g_panStartX = g_panOffsetX;
+            g_panStartY = g_panOffsetY;
             SetCapture(hwnd);
             return 0;
         }
@@ -314,13 +1172,16 @@ static LRESULT CALLBACK ZoomWndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM l
                 int deltaX = LOWORD(lParam) - g_ptDragStart.x;
                 int deltaY = HIWORD(lParam) - g_ptDragStart.y;
 
-                // 확대 배율에 따라 패닝 속도 조절
-                float zoom = (float)g_zoomLevel / 100.0f;
-                g_panOffsetX = g_ptPanStart.x + (int)(deltaX / zoom);
-                g_panOffsetY = g_ptPanStart.y + (int)(deltaY / zoom);
+                // 확대 배율에 따라 패닝 속도 조절 (정수로 자르지 않음)
+                g_panOffsetX = g_panStartX + deltaX / g_zoom;
+                g_panOffsetY = g_panStartY + deltaY / g_zoom;
 
-                InvalidateRect(hwnd, NULL, FALSE);
+                // 드래그는 손을 바로 따라가도록 패닝만 즉시 반영 (배율 전환은 계속)
+                ZoomAnimation_SetPan(&g_animation, g_panOffsetX, g_panOffsetY);
             }
+
+            // 커서가 움직이면 확대 중심도 바뀜
+            FramePacer_RequestFrame(g_pacer);
             return 0;
         }
 
@@ -332,6 +1193,10 @@ static LRESULT CALLBACK ZoomWndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM l
             }
             return 0;
 
+        case WM_DPICHANGED:
+            // 창 위치와 HUD 크기는 g_monitor 기준으로 직접 맞추므로 제안 크기는 무시
+            return 0;
+
         case WM_DESTROY:
             OutputDebugStringW(L"[ZoomOverlay] Window destroyed\n");
             return 0;
@@ -389,6 +1254,15 @@ bool ZoomOverlay_Initialize(HINSTANCE hInstance)
         return false;
     }
 
+    g_residency.name = L"zoom";
+    g_residency.release = ReleaseResidentResources;
+
+    // 만들지 못하면 기록 없이 동작
+    g_history = SnapshotHistory_Create(HISTORY_ENTRIES, HISTORY_BYTES);
+    if (!g_history) {
+        OutputDebugStringW(L"[ZoomOverlay] Snapshot history unavailable\n");
+    }
+
     OutputDebugStringW(L"[ZoomOverlay] Initialized\n");
     return true;
 }
@@ -402,6 +1276,12 @@ void ZoomOverlay_Shutdown(void)
         ZoomOverlay_Hide();
     }
 
+    // 남겨 둔 창/버퍼 해제 (클래스 등록 해제 전에 창부터)
+    Residency_ReleaseNow(&g_residency);
+
+    SnapshotHistory_Destroy(g_history);
+    g_history = NULL;
+
     if (g_hInstance) {
         UnregisterClassW(ZOOM_CLASS_NAME, g_hInstance);
         g_hInstance = NULL;
@@ -411,55 +1291,130 @@ void ZoomOverlay_Shutdown(void)
 }
 
 /**
- * 확대 모드 시작
+ * 확대 창 시작 (전체 화면 확대 / 돋보기 / 창 확대 공통)
+ * target: 창 확대의 대상 창 (NULL이면 화면 확대)
  */
-bool ZoomOverlay_Show(int zoomLevel, bool smoothZoom)
+static bool ShowOverlay(int zoomLevel, bool smoothZoom, bool freezeFrame, bool lens, HWND target)
 {
     if (g_bActive) {
         return true;  // 이미 활성화됨
     }
 
-    OutputDebugStringW(L"[ZoomOverlay] Showing zoom overlay\n");
+    OutputDebugStringW(lens ? L"[ZoomOverlay] Showing lens\n" :
+                       target ? L"[ZoomOverlay] Showing window zoom\n" : L"[ZoomOverlay] Showing zoom overlay\n");
+
+    // 창 확대는 시작할 때의 창 위치/크기로 준비 (이후 프레임마다 따라감)
+    if (target && !FrameSource_GetWindowBounds(target, &g_targetBounds)) {
+        OutputDebugStringW(L"[ZoomOverlay] Target window not visible\n");
+        return false;
+    }
+    g_windowMode = target != NULL;
+    g_targetWindow = target;
+
+    // 남겨 둔 창이 다른 모드 스타일이면 버림 (렌더러도 그 창에 알림을 보내므로 함께)
+    if (g_hwndZoom && g_windowLens != lens) {
+        Residency_ReleaseNow(&g_residency);
+    }
+    g_lensMode = lens;
+
+    // 남겨 둔 창이 있으면 재사용 (유휴 해제 취소, 첫 프레임 지연 측정 시작)
+    Residency_Activate(&g_residency, g_hwndZoom != NULL);
 
-    g_zoomLevel = zoomLevel;
+    g_zoom = (float)zoomLevel / 100.0f;
+    if (g_zoom > ZOOM_MAX) g_zoom = ZOOM_MAX;
+    if (g_zoom < ZOOM_MIN) g_zoom = ZOOM_MIN;
     g_smoothZoom = smoothZoom;
+    g_freezeFrame = freezeFrame;
 
     // 패닝 오프셋 초기화
-    g_panOffsetX = 0;
-    g_panOffsetY = 0;
+    g_panOffsetX = 0.0f;
+    g_panOffsetY = 0.0f;
     g_bDragging = false;
 
-    // 렌더링 리소스 생성
+    // 렌더링 리소스 생성 (프레임 통계도 새로 시작)
     if (!CreateRenderResources()) {
+        DestroyRenderResources(false);
+        ReleaseResidentResources();
         return false;
     }
 
-    // 전체 화면 윈도우 생성
-    g_hwndZoom = CreateWindowExW(
-        WS_EX_TOPMOST | WS_EX_TOOLWINDOW,  // 항상 위, 작업표시줄에 안 뜸
-        ZOOM_CLASS_NAME,
-        L"LetsZoom Overlay",
-        WS_POPUP,  // 테두리 없는 팝업
-        0, 0,
-        g_screenWidth, g_screenHeight,
-        NULL, NULL,
-        g_hInstance,
-        NULL
-    );
+    // 창 확대는 창이 모니터를 채우는 배율부터, 기록이면 그때의 배율/확대 중심으로
+    if (g_zoom < g_zoomMin) g_zoom = g_zoomMin;
+    ZoomState initial = {g_zoom, 0.0f, 0.0f};
+    ZoomAnimation_Jump(&g_animation, &initial);
+    if (g_recallAge >= 0) {
+        ApplyRecallView();
+    }
+
+    // 커서가 있는 모니터 전체를 덮는 윈도우, 돋보기면 커서 중심의 작은 창 (남겨 둔 창은 위치만 맞춤)
+    POINT cursor;
+    GetCursorPos(&cursor);
+    if (g_hwndZoom) {
+        PlaceWindow(cursor);
+    } else {
+        // 항상 위, 작업표시줄에 안 뜸
+        // 돋보기는 클릭/포커스를 아래 창에 넘기고, 레이어드 창이라 GDI 캡처에 찍히지 않음
+        DWORD exStyle = WS_EX_TOPMOST | WS_EX_TOOLWINDOW;
+        if (lens) {
+            exStyle |= WS_EX_LAYERED | WS_EX_TRANSPARENT | WS_EX_NOACTIVATE;
+        }
+
+        RECT rect = WindowBounds(cursor);
+        g_hwndZoom = CreateWindowExW(
+            exStyle,
+            ZOOM_CLASS_NAME,
+            L"LetsZoom Overlay",
+            WS_POPUP,  // 테두리 없는 팝업
+            rect.left, rect.top,
+            rect.right - rect.left, rect.bottom - rect.top,
+            NULL, NULL,
+            g_hInstance,
+            NULL
+        );
+
+        if (g_hwndZoom) {
+            g_windowRect = rect;
+            g_windowLens = lens;
+            ExcludeFromCapture(g_hwndZoom);
+            if (lens) {
+                // 불투명 레이어드 창 (WM_PAINT로 그림)
+                SetLayeredWindowAttributes(g_hwndZoom, 0, 255, LWA_ALPHA);
+            }
+        }
+    }
 
     if (!g_hwndZoom) {
         OutputDebugStringW(L"[ZoomOverlay] Failed to create window\n");
-        DestroyRenderResources();
+        DestroyRenderResources(false);
+        ReleaseResidentResources();
+        return false;
+    }
+
+    if (!StartRendering()) {
+        DestroyRenderResources(false);
+        ReleaseResidentResources();
         return false;
     }
 
-    // 윈도우 표시
-    ShowWindow(g_hwndZoom, SW_SHOW);
-    UpdateWindow(g_hwndZoom);
-    SetForegroundWindow(g_hwndZoom);
+    // 첫 프레임 (창이 보이기 전에 캡처)
+    g_showTimeMs = FramePacer_Now();
+    g_showCpuMs = GetProcessCpuMs();
+    g_framePainted = false;
+    UpdateZoom();
+    if (!g_magnifier && !ZoomRenderer_WaitIdle(g_renderer, FIRST_FRAME_TIMEOUT)) {
+        OutputDebugStringW(L"[ZoomOverlay] First frame not ready, showing anyway\n");
+    }
 
-    // 업데이트 타이머 시작
-    SetTimer(g_hwndZoom, TIMER_UPDATE, UPDATE_INTERVAL, NULL);
+    // 윈도우 표시 (돋보기는 포커스를 가져가지 않으므로 조절은 전역 단축키로)
+    if (lens) {
+        ShowWindow(g_hwndZoom, SW_SHOWNOACTIVATE);
+        UpdateWindow(g_hwndZoom);
+        RegisterLensHotkeys();
+    } else {
+        ShowWindow(g_hwndZoom, SW_SHOW);
+        UpdateWindow(g_hwndZoom);
+        SetForegroundWindow(g_hwndZoom);
+    }
 
     g_bActive = true;
 
@@ -467,6 +1422,87 @@ bool ZoomOverlay_Show(int zoomLevel, bool smoothZoom)
     return true;
 }
 
+/**
+ * 확대 모드 시작
+ */
+bool ZoomOverlay_Show(int zoomLevel, bool smoothZoom, bool freezeFrame)
+{
+    return ShowOverlay(zoomLevel, smoothZoom, freezeFrame, false, NULL);
+}
+
+/**
+ * 돋보기 모드 시작
+ */
+bool ZoomOverlay_ShowLens(bool smoothZoom)
+{
+    return ShowOverlay(g_lensZoomLevel, smoothZoom, false, true, NULL);
+}
+
+/**
+ * 창 확대 모드 시작 (커서 아래의 최상위 창)
+ * 바탕 화면/작업 표시줄과 이 프로그램의 창(그리기, 스포트라이트)은 대상으로 삼지 않는다.
+ */
+bool ZoomOverlay_ShowWindow(int zoomLevel, bool smoothZoom)
+{
+    if (g_bActive) {
+        return true;  // 이미 활성화됨
+    }
+
+    POINT cursor;
+    GetCursorPos(&cursor);
+    HWND hit = WindowFromPoint(cursor);
+    HWND target = hit ? GetAncestor(hit, GA_ROOT) : NULL;
+
+    DWORD processId = 0;
+    if (target) {
+        GetWindowThreadProcessId(target, &processId);
+    }
+    if (!target || target == GetDesktopWindow() || target == GetShellWindow() ||
+        target == FindWindowW(L"Shell_TrayWnd", NULL) || processId == GetCurrentProcessId()) {
+        OutputDebugStringW(L"[ZoomOverlay] No application window under cursor\n");
+        return false;
+    }
+
+    return ShowOverlay(zoomLevel, smoothZoom, false, false, target);
+}
+
+/**
+ * 가장 최근 정지 화면 기록을 그때의 배율/확대 중심으로 다시 띄움
+ * 이후 PageUp/PageDown으로 더 오래된/최근 기록으로 바꾼다.
+ */
+bool ZoomOverlay_ShowHistory(bool smoothZoom)
+{
+    if (g_bActive) {
+        return true;  // 이미 활성화됨
+    }
+
+    if (!g_history || SnapshotHistory_GetCount(g_history) == 0) {
+        OutputDebugStringW(L"[ZoomOverlay] Snapshot history empty\n");
+        return false;
+    }
+
+    double start = FramePacer_Now();
+    if (!LoadRecall(0)) {
+        OutputDebugStringW(L"[ZoomOverlay] Failed to recall snapshot\n");
+        return false;
+    }
+
+    WCHAR msg[96];
+    swprintf_s(msg, 96, L"[ZoomOverlay] Snapshot recalled in %.2f ms\n", FramePacer_Now() - start);
+    OutputDebugStringW(msg);
+
+    if (!ShowOverlay(lroundf(g_recallView.zoom * 100.0f), smoothZoom, true, false, NULL)) {
+        // 공급원을 만들기 전에 실패했으면 아직 빌려 둔 상태
+        if (g_recallPixels) {
+            SnapshotHistory_Release(g_history);
+            g_recallPixels = NULL;
+        }
+        g_recallAge = -1;
+        return false;
+    }
+    return true;
+}
+
 /**
  * 확대 모드 종료
  */
@@ -478,21 +1514,138 @@ void ZoomOverlay_Hide(void)
 
     OutputDebugStringW(L"[ZoomOverlay] Hiding zoom overlay\n");
 
-    // 타이머 중지
-    if (g_hwndZoom) {
+    // 프레임 신호 중지
+    SetIdlePolling(false);
+    if (g_pacer) {
+        FramePacer_Destroy(g_pacer);
+        g_pacer = NULL;
+    } else if (g_hwndZoom) {
         KillTimer(g_hwndZoom, TIMER_UPDATE);
     }
+    FrameTiming_GetStats(&g_timing, &g_timingStats);
+    CursorPredictor_GetStats(&g_predictor, &g_predictionStats);
+
+    // 확대 중 CPU 사용률 (정지 화면을 띄워 둔 채 말하는 동안 0에 가까워야 함)
+    double elapsedMs = FramePacer_Now() - g_showTimeMs;
+    if (elapsedMs > 0.0) {
+        double cpuMs = GetProcessCpuMs() - g_showCpuMs;
+        WCHAR msg[160];
+        swprintf_s(msg, 160, L"[ZoomOverlay] CPU %.0f ms over %.0f ms (%.1f%%)\n",
+                   cpuMs, elapsedMs, cpuMs * 100.0 / elapsedMs);
+        OutputDebugStringW(msg);
+    }
 
-    // 윈도우 파괴
+    // 윈도우는 숨기기만 (다음 활성화에 재사용, 유휴 시간이 지나면 상주 관리가 해제)
+    if (g_bDragging) {
+        g_bDragging = false;
+        ReleaseCapture();
+    }
+    UnregisterLensHotkeys();
     if (g_hwndZoom) {
-        DestroyWindow(g_hwndZoom);
-        g_hwndZoom = NULL;
+        ShowWindow(g_hwndZoom, SW_HIDE);
     }
 
-    // 렌더링 리소스 해제
-    DestroyRenderResources();
+    // 이번 세션 리소스 해제 (렌더러 버퍼와 실시간 공급원은 남겨 둠, 새 정지 화면은 기록에)
+    DestroyRenderResources(true);
 
     g_bActive = false;
+    g_recallAge = -1;
+
+    // 캡처량 요약
+    if (g_stats.frames > 0) {
+        WCHAR msg[256];
+        swprintf_s(msg, 256, L"[ZoomOverlay] %llu frames, avg capture %llu KB/frame (full screen %llu KB)\n",
+                   g_stats.frames, g_stats.bytesCopied / g_stats.frames / 1024, g_stats.fullFrameBytes / 1024);
+        OutputDebugStringW(msg);
+        swprintf_s(msg, 256, L"[ZoomOverlay] rescaled: full %llu, partial %llu, skipped %llu\n",
+                   g_stats.framesFull, g_stats.framesPartial, g_stats.framesSkipped);
+        OutputDebugStringW(msg);
+    }
+
+    // 타일 해시 (변경 정보 없는 프레임에서 바뀐 타일 비율과 해시 비용)
+    if (g_stats.hash.frames > 0 && g_stats.hash.tilesHashed > 0) {
+        WCHAR msg[256];
+        swprintf_s(msg, 256, L"[ZoomOverlay] content hash: %llu frames (%llu unchanged), changed tiles %.1f%% (last %d/%d), hash %.2f ms/frame\n",
+                   g_stats.hash.frames, g_stats.hash.framesUnchanged,
+                   100.0 * g_stats.hash.tilesChanged / g_stats.hash.tilesHashed,
+                   g_stats.hash.lastChanged, g_stats.hash.lastTiles,
+                   g_stats.hash.hashMs / g_stats.hash.frames);
+        OutputDebugStringW(msg);
+    }
+
+    // 마지막 밴드 병렬 확대 (밴드 시간이 고르지 않으면 가장 느린 밴드가 프레임 시간을 정함)
+    if (g_stats.bands.bands > 0) {
+        WCHAR msg[512];
+        int length = swprintf_s(msg, 512, L"[ZoomOverlay] last scale: %d bands, %.2f ms (bands",
+                                g_stats.bands.bands, g_stats.bands.wallMs);
+        for (int i = 0; i < g_stats.bands.bands && length > 0; i++) {
+            length += swprintf_s(msg + length, 512 - length, L" %.2f", g_stats.bands.bandMs[i]);
+        }
+        if (length > 0) {
+            swprintf_s(msg + length, 512 - length, L" ms)\n");
+            OutputDebugStringW(msg);
+        }
+    }
+
+    // Magnification API 갱신 시간 (GDI/Desktop Duplication 세션의 렌더 스레드 시간과 비교)
+    if (g_magnifierStats.updates > 0) {
+        WCHAR msg[160];
+        swprintf_s(msg, 160, L"[ZoomOverlay] magnifier: %llu updates, mean %.2f ms, max %.2f ms\n",
+                   g_magnifierStats.updates, g_magnifierStats.meanMs, g_magnifierStats.maxMs);
+        OutputDebugStringW(msg);
+    }
+
+    // 렌더 스레드 처리 시간 (창 스레드는 이 시간 동안 입력을 계속 처리)
+    if (g_renderStats.rendered > 0) {
+        WCHAR msg[256];
+        swprintf_s(msg, 256, L"[ZoomOverlay] render thread: %llu views (%llu superseded), %llu published, %llu presented, mean %.2f ms, max %.2f ms\n",
+                   g_renderStats.rendered, g_renderStats.superseded, g_renderStats.published,
+                   g_renderStats.presented, g_renderStats.meanMs, g_renderStats.maxMs);
+        OutputDebugStringW(msg);
+    }
+
+    // 프레임 간격과 지터
+    if (g_timingStats.frames > 0) {
+        WCHAR msg[256];
+        swprintf_s(msg, 256, L"[ZoomOverlay] frame interval: target %.2f ms, mean %.2f ms, jitter %.2f ms, max %.2f ms, missed %llu\n",
+                   g_timingStats.targetMs, g_timingStats.meanMs, g_timingStats.jitterMs,
+                   g_timingStats.maxMs, g_timingStats.missed);
+        OutputDebugStringW(msg);
+    }
+
+    // 커서 예측 오차 (표시 시각의 실제 커서 기준, 예측 없이 쓸 때와 비교)
+    if (g_predictionStats.checks > 0) {
+        WCHAR msg[256];
+        swprintf_s(msg, 256, L"[ZoomOverlay] cursor prediction: %llu checks, error mean %.1f px (max %.1f), without prediction mean %.1f px (max %.1f)\n",
+                   g_predictionStats.checks, g_predictionStats.meanErrorPx, g_predictionStats.maxErrorPx,
+                   g_predictionStats.meanLagPx, g_predictionStats.maxLagPx);
+        OutputDebugStringW(msg);
+    }
+
+    // 타일 캐시 적중률과 메모리
+    unsigned long long lookups = g_tileStats.hits + g_tileStats.misses;
+    if (lookups > 0) {
+        WCHAR msg[256];
+        swprintf_s(msg, 256, L"[ZoomOverlay] tile cache: hit %llu%% (%llu/%llu), %d tiles, %llu KB of %llu KB\n",
+                   g_tileStats.hits * 100 / lookups, g_tileStats.hits, lookups, g_tileStats.tiles,
+                   (unsigned long long)g_tileStats.bytes / 1024, (unsigned long long)g_tileStats.maxBytes / 1024);
+        OutputDebugStringW(msg);
+    }
+
+    // 정지 화면 기록 (압축률, 배경 압축 시간, 꺼내기 시간)
+    SnapshotHistoryStats historyStats = {0};
+    SnapshotHistory_GetStats(g_history, &historyStats);
+    if (historyStats.entries > 0 && historyStats.bytes > 0) {
+        WCHAR msg[256];
+        swprintf_s(msg, 256, L"[ZoomOverlay] snapshot history: %d entries, %.1f MB of %.1f MB (%.1fx), compress mean %.1f ms, load mean %.2f ms (max %.2f), evicted %llu\n",
+                   historyStats.entries, historyStats.bytes / 1048576.0, historyStats.maxBytes / 1048576.0,
+                   (double)historyStats.rawBytes / historyStats.bytes, historyStats.meanCompressMs,
+                   historyStats.meanLoadMs, historyStats.maxLoadMs, historyStats.evictions);
+        OutputDebugStringW(msg);
+    }
+
+    // 유지 시간 뒤 창/버퍼 해제 예약 (유지 시간이 0이면 바로 해제)
+    Residency_Deactivate(&g_residency);
 
     OutputDebugStringW(L"[ZoomOverlay] Zoom overlay hidden\n");
 }
@@ -504,3 +1657,141 @@ bool ZoomOverlay_IsActive(void)
 {
     return g_bActive;
 }
+
+/**
+ * 프레임 통계 가져오기
+ */
+void ZoomOverlay_GetStats(ZoomStats* stats)
+{
+    if (!stats) return;
+
+    if (g_bActive && g_renderer) {
+        ZoomRenderer_GetPipelineStats(g_renderer, stats, NULL);
+    } else {
+        *stats = g_stats;
+    }
+}
+
+/**
+ * 타일 캐시 통계 가져오기
+ */
+bool ZoomOverlay_GetTileStats(TileCacheStats* stats)
+{
+    if (!stats) return false;
+
+    if (g_bActive && g_renderer) {
+        return ZoomRenderer_GetPipelineStats(g_renderer, NULL, stats);
+    }
+
+    *stats = g_tileStats;
+    return g_tileStats.maxBytes > 0;
+}
+
+/**
+ * 프레임 간격/지터 통계 가져오기 (확대 중이 아니면 마지막 세션)
+ */
+void ZoomOverlay_GetFrameTiming(FrameTimingStats* stats)
+{
+    if (!stats) return;
+
+    if (g_bActive) {
+        FrameTiming_GetStats(&g_timing, stats);
+    } else {
+        *stats = g_timingStats;
+    }
+}
+
+/**
+ * 상주 통계 가져오기 (단축키 → 첫 프레임 지연, 작업 집합)
+ */
+void ZoomOverlay_GetResidencyStats(ResidencyStats* stats)
+{
+    Residency_GetStats(&g_residency, stats);
+}
+
+/**
+ * 확대/이동 전환 시간 설정
+ */
+void ZoomOverlay_SetAnimationDuration(int milliseconds)
+{
+    if (milliseconds < 0) milliseconds = 0;
+    if (milliseconds > 1000) milliseconds = 1000;
+    g_animationMs = milliseconds;
+}
+
+/**
+ * 커서 예측 설정
+ */
+void ZoomOverlay_SetCursorPrediction(int strength, int smoothingMs)
+{
+    if (strength < 0) strength = 0;
+    if (strength > 100) strength = 100;
+    if (smoothingMs < 0) smoothingMs = 0;
+    if (smoothingMs > 200) smoothingMs = 200;
+
+    g_predictGain = strength / 100.0;
+    g_predictSmoothingMs = smoothingMs;
+}
+
+/**
+ * 확대 스레드 수 설정
+ */
+void ZoomOverlay_SetScaleThreads(int threads)
+{
+    if (threads < 0) threads = 0;
+    if (threads > WORKER_POOL_MAX_THREADS) threads = WORKER_POOL_MAX_THREADS;
+    g_scaleThreads = threads;
+}
+
+/**
+ * 선명한 확대 설정
+ */
+void ZoomOverlay_SetSharpZoom(bool sharp)
+{
+    g_sharpZoom = sharp;
+}
+
+/**
+ * 선형 광량 보간 설정
+ */
+void ZoomOverlay_SetLinearLight(bool linear)
+{
+    g_linearLight = linear;
+}
+
+/**
+ * 돋보기 크기/배율 설정
+ */
+void ZoomOverlay_SetLens(int width, int height, int zoomLevel)
+{
+    if (width < 100) width = 100;
+    if (width > 1600) width = 1600;
+    if (height < 100) height = 100;
+    if (height > 1200) height = 1200;
+    if (zoomLevel < 100) zoomLevel = 100;
+    if (zoomLevel > 2000) zoomLevel = 2000;
+
+    bool resized = width != g_lensWidth || height != g_lensHeight;
+    g_lensWidth = width;
+    g_lensHeight = height;
+    g_lensZoomLevel = zoomLevel;
+
+    if (!g_bActive || !g_lensMode) {
+        return;
+    }
+
+    // 돋보기를 띄운 채 바꾸면 바로 적용
+    g_zoom = (float)zoomLevel / 100.0f;
+    AnimateToTarget();
+    if (resized) {
+        RestartRendering();
+    }
+}
+
+/**
+ * 화면 캡처 방식 설정
+ */
+void ZoomOverlay_SetCaptureBackend(ZoomCaptureBackend backend)
+{
+    g_captureBackend = backend;
+}
@@ -7,6 +7,16 @@
 
 #include <windows.h>
 #include <stdbool.h>
+#include "frame_timing.h"
+#include "residency.h"
+#include "zoom_pipeline.h"
+
+// 화면 캡처 방식
+typedef enum {
+    ZOOM_CAPTURE_GDI = 0,           // BitBlt (항상 사용 가능)
+    ZOOM_CAPTURE_DUPLICATION = 1,   // Desktop Duplication (변경 영역만 처리, 실패 시 GDI)
+    ZOOM_CAPTURE_MAGNIFIER = 2      // Magnification API (캡처 없이 GPU 확대, 실시간 전체 화면만, 실패 시 GDI)
+} ZoomCaptureBackend;
 
 /**
  * 확대 오버레이 초기화
@@ -22,8 +32,32 @@ void ZoomOverlay_Shutdown(void);
  * 확대 모드 시작
  * zoomLevel: 확대 배율 (100-800%)
  * smoothZoom: 부드러운 확대 활성화
+ * freezeFrame: 정지 확대 (시작할 때 한 번 캡처한 화면을 확대/이동)
+ */
+bool ZoomOverlay_Show(int zoomLevel, bool smoothZoom, bool freezeFrame);
+
+/**
+ * 돋보기 모드 시작 (커서를 따라다니는 작은 창에 그 주변만 실시간 확대)
+ * 클릭과 키 입력은 아래 창으로 그대로 가므로 켜 둔 채 작업할 수 있다. 끌 때는 ZoomOverlay_Hide.
+ * 크기와 배율은 ZoomOverlay_SetLens
  */
-bool ZoomOverlay_Show(int zoomLevel, bool smoothZoom);
+bool ZoomOverlay_ShowLens(bool smoothZoom);
+
+/**
+ * 창 확대 모드 시작 (커서 아래 창 하나만 캡처해 모니터 전체에 확대)
+ * 그 창의 내용만 복사하므로 위에 뜬 알림이나 다른 창은 확대 화면에 나오지 않는다.
+ * 창이 움직이거나 크기가 바뀌면 따라가고, 닫히거나 최소화되면 끝난다.
+ * zoomLevel: 확대 배율 (%, 창이 모니터를 채우는 배율보다 작으면 그 배율)
+ * 커서 아래에 응용 프로그램 창이 없으면 false
+ */
+bool ZoomOverlay_ShowWindow(int zoomLevel, bool smoothZoom);
+
+/**
+ * 정지 화면 기록 다시 띄우기 (가장 최근에 닫은 정지 확대를 그때의 배율/확대 중심으로)
+ * 정지 확대를 닫을 때마다 화면을 압축해 기록하며, 확대 중에 PageUp/PageDown으로
+ * 더 오래된/최근 기록으로 바꾼다. 기록이 없으면 false
+ */
+bool ZoomOverlay_ShowHistory(bool smoothZoom);
 
 /**
  * 확대 모드 종료
@@ -35,4 +69,65 @@ void ZoomOverlay_Hide(void);
  */
 bool ZoomOverlay_IsActive(void);
 
+/**
+ * 프레임 통계 가져오기 (확대 중이 아니면 마지막 세션)
+ */
+void ZoomOverlay_GetStats(ZoomStats* stats);
+
+/**
+ * 확대 타일 캐시 통계 가져오기 (적중률, 메모리; 캐시를 쓰지 않으면 false)
+ */
+bool ZoomOverlay_GetTileStats(TileCacheStats* stats);
+
+/**
+ * 프레임 간격/지터 통계 가져오기 (확대 중이 아니면 마지막 세션)
+ */
+void ZoomOverlay_GetFrameTiming(FrameTimingStats* stats);
+
+/**
+ * 상주 통계 가져오기 (단축키 → 첫 프레임 지연, 닫은 뒤/유휴 해제 후 작업 집합)
+ */
+void ZoomOverlay_GetResidencyStats(ResidencyStats* stats);
+
+/**
+ * 확대/이동 전환 시간 설정 (밀리초, 0이면 전환 없이 바로 이동)
+ */
+void ZoomOverlay_SetAnimationDuration(int milliseconds);
+
+/**
+ * 커서 예측 설정 (다음 ZoomOverlay_Show부터 적용)
+ * strength: 0-100% (0이면 끔), smoothingMs: 속도 평활 시간 (0-200ms, 클수록 떨림이 적고 방향 전환에 느림)
+ * 확대 중심을 프레임이 실제로 표시될 시각의 커서 위치로 옮겨 빠른 커서를 덜 뒤따르게 한다.
+ */
+void ZoomOverlay_SetCursorPrediction(int strength, int smoothingMs);
+
+/**
+ * 확대 스레드 수 설정 (다음 ZoomOverlay_Show부터 적용)
+ * 0이면 코어 수(최대 8), 1이면 렌더 스레드 하나. 출력을 가로 밴드로 나눠 동시에 확대한다.
+ */
+void ZoomOverlay_SetScaleThreads(int threads);
+
+/**
+ * 부드러운 확대를 Lanczos-3로 (코드/터미널 글자가 선명, 쌍선형보다 3-4배 느림)
+ * 확대 중에 호출하면 다음 프레임부터 적용
+ */
+void ZoomOverlay_SetSharpZoom(bool sharp);
+
+/**
+ * 부드러운 확대를 선형 광량에서 보간 (어두운 바탕의 밝은 가는 글자가 덜 어두워짐, 최근접에는 영향 없음)
+ * GDI/Desktop Duplication 캡처에만 적용 (Magnification API는 무시). 확대 중에 호출하면 다음 프레임부터 적용
+ */
+void ZoomOverlay_SetLinearLight(bool linear);
+
+/**
+ * 돋보기 크기(96 DPI 기준 픽셀, 모니터 DPI에 맞춰 늘림)와 배율(%) 설정
+ * 돋보기를 띄운 채 호출하면 바로 적용
+ */
+void ZoomOverlay_SetLens(int width, int height, int zoomLevel);
+
+/**
+ * 화면 캡처 방식 설정 (다음 ZoomOverlay_Show부터 적용)
+ */
+void ZoomOverlay_SetCaptureBackend(ZoomCaptureBackend backend);
+
 #endif // LETSZOOM_ZOOM_OVERLAY_H
@@ -0,0 +1,607 @@
+/**
+ * zoom_pipeline.c - 확대 파이프라인 구현
+ */
+
+#include "zoom_pipeline.h"
+#include "tile_cache.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// 캡처 영역 여유분 (패닝/필터 가장자리용, 픽셀)
+#define CAPTURE_GUARD 32
+
+// 바뀐 영역을 넓힐 소스 픽셀 수 (가장 넓은 필터 Lanczos-3의 탭 반경)
+#define DIRTY_MARGIN 3
+
+// 바뀐 출력 면적이 이 비율(%)을 넘으면 전체를 다시 확대
+#define PARTIAL_LIMIT_PERCENT 50
+
+// 한 프레임에서 부분 확대할 최대 사각형 수
+#define MAX_PARTIAL_RECTS 64
+
+// 타일이 읽는 소스 영역 여유분 (Lanczos-3 탭 반경 3, 바이큐빅은 2)
+// 줄이면 Lanczos 타일 가장자리가 소스 밖 픽셀로 계산되어 이음매가 생김
+#define TILE_SOURCE_MARGIN 3
+
+// 확대할 소스 영역 (데스크톱 좌표, 서브픽셀)
+typedef struct {
+    double x;
+    double y;
+    double width;
+    double height;
+} CaptureArea;
+
+struct ZoomPipeline {
+    FrameSource* source;
+    Scaler* scaler;
+    ZoomStats stats;
+
+    // 직전 출력 상태 (같으면 바뀐 부분만 다시 확대)
+    bool hasOutput;
+    ScaleParams lastParams;
+    CaptureArea lastCapture;    // 확대한 소스 영역
+    uint8_t* lastPixels;
+    int lastWidth;
+    int lastHeight;
+
+    // 타일 캐시 (NULL이면 출력 전체를 직접 확대)
+    TileCache* tiles;
+    int lastOriginX;            // 직전 출력 (0,0)의 확대 좌표
+    int lastOriginY;
+
+    // 타일 내용 해시 (NULL이면 공급원의 변경 정보만 사용)
+    TileHasher* hasher;
+
+    FrameRect damage;           // 마지막 Render가 바꾼 출력 영역 (경계 사각형)
+};
+
+/**
+ * 파이프라인 생성
+ */
+ZoomPipeline* ZoomPipeline_Create(FrameSource* source)
+{
+    if (!source) return NULL;
+
+    ZoomPipeline* pipeline = (ZoomPipeline*)calloc(1, sizeof(ZoomPipeline));
+    if (!pipeline) return NULL;
+
+    pipeline->scaler = Scaler_Create();
+    if (!pipeline->scaler) {
+        free(pipeline);
+        return NULL;
+    }
+
+    pipeline->source = source;
+    pipeline->stats.fullFrameBytes = (unsigned long long)source->width * source->height * 4;
+    return pipeline;
+}
+
+/**
+ * 파이프라인 파괴
+ */
+void ZoomPipeline_Destroy(ZoomPipeline* pipeline)
+{
+    if (!pipeline) return;
+
+    TileCache_Destroy(pipeline->tiles);
+    TileHasher_Destroy(pipeline->hasher);
+    Scaler_Destroy(pipeline->scaler);
+    free(pipeline);
+}
+
+/**
+ * 다음 프레임은 전체 다시 확대
+ */
+void ZoomPipeline_Invalidate(ZoomPipeline* pipeline)
+{
+    if (pipeline) {
+        pipeline->hasOutput = false;
+    }
+}
+
+/**
+ * 작업 스레드 풀 지정
+ */
+void ZoomPipeline_SetWorkers(ZoomPipeline* pipeline, WorkerPool* pool)
+{
+    if (pipeline) {
+        Scaler_SetWorkers(pipeline->scaler, pool);
+    }
+}
+
+/**
+ * 타일 캐시 사용 설정
+ */
+bool ZoomPipeline_EnableTileCache(ZoomPipeline* pipeline, size_t maxBytes)
+{
+    if (!pipeline) return false;
+
+    TileCache_Destroy(pipeline->tiles);
+    pipeline->tiles = NULL;
+    pipeline->hasOutput = false;
+
+    if (maxBytes == 0) {
+        return true;
+    }
+
+    pipeline->tiles = TileCache_Create(maxBytes);
+    return pipeline->tiles != NULL;
+}
+
+/**
+ * 타일 내용 해시 사용 설정
+ */
+bool ZoomPipeline_EnableContentHash(ZoomPipeline* pipeline, bool enable)
+{
+    if (!pipeline) return false;
+
+    if (!enable) {
+        TileHasher_Destroy(pipeline->hasher);
+        pipeline->hasher = NULL;
+        return true;
+    }
+
+    if (!pipeline->hasher) {
+        pipeline->hasher = TileHasher_Create(pipeline->source->width, pipeline->source->height);
+    }
+    return pipeline->hasher != NULL;
+}
+
+/**
+ * 타일 캐시 통계 가져오기
+ */
+bool ZoomPipeline_GetTileStats(const ZoomPipeline* pipeline, TileCacheStats* stats)
+{
+    if (!pipeline || !pipeline->tiles || !stats) {
+        return false;
+    }
+
+    TileCache_GetStats(pipeline->tiles, stats);
+    return true;
+}
+
+/**
+ * 마지막 프레임이 바꾼 출력 영역 가져오기
+ */
+bool ZoomPipeline_GetDamage(const ZoomPipeline* pipeline, FrameRect* damage)
+{
+    if (!pipeline || !damage) return false;
+
+    *damage = pipeline->damage;
+    return damage->right > damage->left && damage->bottom > damage->top;
+}
+
+/**
+ * 바뀐 출력 영역에 사각형 더하기
+ */
+static void AddDamage(ZoomPipeline* pipeline, const FrameRect* rect)
+{
+    FrameRect* d = &pipeline->damage;
+    if (d->right <= d->left || d->bottom <= d->top) {
+        *d = *rect;
+        return;
+    }
+
+    if (rect->left < d->left) d->left = rect->left;
+    if (rect->top < d->top) d->top = rect->top;
+    if (rect->right > d->right) d->right = rect->right;
+    if (rect->bottom > d->bottom) d->bottom = rect->bottom;
+}
+
+/**
+ * 통계 가져오기
+ */
+void ZoomPipeline_GetStats(const ZoomPipeline* pipeline, ZoomStats* stats)
+{
+    if (pipeline && stats) {
+        *stats = pipeline->stats;
+        Scaler_GetBandStats(pipeline->scaler, &stats->bands);
+        if (pipeline->hasher) {
+            TileHasher_GetStats(pipeline->hasher, &stats->hash);
+        }
+    }
+}
+
+/**
+ * 통계 초기화
+ */
+void ZoomPipeline_ResetStats(ZoomPipeline* pipeline)
+{
+    if (!pipeline) return;
+
+    unsigned long long fullFrameBytes = pipeline->stats.fullFrameBytes;
+    memset(&pipeline->stats, 0, sizeof(ZoomStats));
+    pipeline->stats.fullFrameBytes = fullFrameBytes;
+
+    if (pipeline->tiles) {
+        TileCache_ResetStats(pipeline->tiles);
+    }
+    if (pipeline->hasher) {
+        TileHasher_ResetStats(pipeline->hasher);
+    }
+}
+
+/**
+ * 소스 사각형(데스크톱 좌표)을 출력 사각형으로 변환
+ */
+static bool MapToOutput(const FrameRect* src, const CaptureArea* capture, int outWidth, int outHeight,
+                        FrameRect* out)
+{
+    double scaleX = outWidth / capture->width;
+    double scaleY = outHeight / capture->height;
+
+    FrameRect r;
+    r.left = (int)floor((src->left - DIRTY_MARGIN - capture->x) * scaleX);
+    r.top = (int)floor((src->top - DIRTY_MARGIN - capture->y) * scaleY);
+    r.right = (int)ceil((src->right + DIRTY_MARGIN - capture->x) * scaleX);
+    r.bottom = (int)ceil((src->bottom + DIRTY_MARGIN - capture->y) * scaleY);
+
+    FrameRect limit = {0, 0, outWidth, outHeight};
+    return FrameRect_Intersect(out, &r, &limit);
+}
+
+/**
+ * 출력의 일부 영역만 다시 확대
+ */
+static bool RenderRect(ZoomPipeline* pipeline, const PixelBuffer* source, const PixelBuffer* output,
+                       const ScaleParams* params, const FrameRect* rect)
+{
+    PixelBuffer view = PixelBuffer_SubView(output, rect->left, rect->top,
+                                           rect->right - rect->left, rect->bottom - rect->top);
+    ScaleParams sub = *params;
+    sub.dstOffsetX = rect->left;
+    sub.dstOffsetY = rect->top;
+
+    if (!Scaler_Render(pipeline->scaler, source, &view, &sub)) {
+        return false;
+    }
+
+    pipeline->stats.pixelsScaled += (unsigned long long)view.width * view.height;
+    return true;
+}
+
+/**
+ * 프레임 획득
+ * 변경 정보 없는 프레임은 타일 해시로 바뀐 영역을 찾아 채운다.
+ * 변경 정보가 있는 프레임은 그 영역의 해시만 버린다 (해시와 출력이 어긋나지 않도록).
+ */
+static bool AcquireFrame(ZoomPipeline* pipeline, const FrameRect* region, Frame* frame)
+{
+    if (!FrameSource_Acquire(pipeline->source, region, frame)) {
+        return false;
+    }
+
+    pipeline->stats.frames++;
+    pipeline->stats.lastFrameBytes = frame->bytesCopied;
+    pipeline->stats.bytesCopied += frame->bytesCopied;
+
+    TileHasher* hasher = pipeline->hasher;
+    if (!hasher) {
+        return true;
+    }
+
+    if (frame->fullRefresh) {
+        const FrameRect* changed;
+        int count = TileHasher_Update(hasher, &frame->pixels, &frame->bounds, &changed);
+        if (count >= 0) {
+            frame->fullRefresh = false;
+            frame->dirtyRects = changed;
+            frame->dirtyCount = count;
+            frame->moveRects = NULL;
+            frame->moveCount = 0;
+        }
+    } else {
+        for (int i = 0; i < frame->dirtyCount; i++) {
+            TileHasher_Invalidate(hasher, &frame->dirtyRects[i]);
+        }
+        for (int i = 0; i < frame->moveCount; i++) {
+            TileHasher_Invalidate(hasher, &frame->moveRects[i].dst);
+        }
+    }
+    return true;
+}
+
+/**
+ * 타일이 읽는 소스 영역 (데스크톱 좌표, 필터 탭 여유 포함)
+ */
+static FrameRect TileSource(int tileX, int tileY, double zoom, int desktopWidth, int desktopHeight)
+{
+    FrameRect r;
+    r.left = (int)floor(tileX * TILE_SIZE / zoom) - TILE_SOURCE_MARGIN;
+    r.top = (int)floor(tileY * TILE_SIZE / zoom) - TILE_SOURCE_MARGIN;
+    r.right = (int)ceil((tileX + 1) * TILE_SIZE / zoom) + TILE_SOURCE_MARGIN;
+    r.bottom = (int)ceil((tileY + 1) * TILE_SIZE / zoom) + TILE_SOURCE_MARGIN;
+
+    if (r.left < 0) r.left = 0;
+    if (r.top < 0) r.top = 0;
+    if (r.right > desktopWidth) r.right = desktopWidth;
+    if (r.bottom > desktopHeight) r.bottom = desktopHeight;
+    return r;
+}
+
+/**
+ * 타일 캐시를 거쳐 한 프레임 처리
+ * 출력은 "확대된 데스크톱"(데스크톱 × 배율)의 정수 좌표 창이고,
+ * 그 좌표 격자로 나눈 타일을 캐시에서 꺼내거나 새로 확대해 붙인다.
+ */
+static bool RenderTiled(ZoomPipeline* pipeline, const ZoomView* view, const PixelBuffer* output)
+{
+    FrameSource* source = pipeline->source;
+    int desktopWidth = source->width;
+    int desktopHeight = source->height;
+    double zoom = view->zoom;
+
+    // 출력 창의 확대 좌표 원점 (중심 = 커서 + 패닝, 확대된 데스크톱 안으로 제한)
+    // 서브픽셀 중심은 출력 픽셀 단위로 반올림 (타일 격자가 출력 픽셀에 맞아야 재사용 가능)
+    long long zoomedWidth = (long long)floor(desktopWidth * zoom);
+    long long zoomedHeight = (long long)floor(desktopHeight * zoom);
+    long long originX = (long long)floor(view->centerX * zoom - output->width / 2.0 + 0.5);
+    long long originY = (long long)floor(view->centerY * zoom - output->height / 2.0 + 0.5);
+    if (originX > zoomedWidth - output->width) originX = zoomedWidth - output->width;
+    if (originY > zoomedHeight - output->height) originY = zoomedHeight - output->height;
+    if (originX < 0) originX = 0;
+    if (originY < 0) originY = 0;
+
+    int tileX0 = (int)(originX / TILE_SIZE);
+    int tileY0 = (int)(originY / TILE_SIZE);
+    int tileX1 = (int)((originX + output->width - 1) / TILE_SIZE);
+    int tileY1 = (int)((originY + output->height - 1) / TILE_SIZE);
+
+    // 보이는 타일들이 읽는 소스 영역만 획득
+    FrameRect first = TileSource(tileX0, tileY0, zoom, desktopWidth, desktopHeight);
+    FrameRect last = TileSource(tileX1, tileY1, zoom, desktopWidth, desktopHeight);
+    FrameRect region = {first.left, first.top, last.right, last.bottom};
+
+    Frame frame;
+    if (!AcquireFrame(pipeline, &region, &frame)) {
+        return false;
+    }
+
+    // 바뀐 화면을 읽은 타일 버리기
+    // 출력 변경 여부는 캐시가 아니라 보이는 소스 영역으로 판단
+    // (보이는 타일이 캐시보다 많으면 보이는 타일도 밀려나 있어서 무효화된 타일 수로는 알 수 없음)
+    bool contentChanged = frame.fullRefresh;
+    if (frame.fullRefresh) {
+        TileCache_Clear(pipeline->tiles);
+    } else {
+        for (int i = 0; i < frame.dirtyCount; i++) {
+            TileCache_InvalidateRect(pipeline->tiles, &frame.dirtyRects[i]);
+            if (FrameRect_Intersects(&frame.dirtyRects[i], &region)) {
+                contentChanged = true;
+            }
+        }
+        for (int i = 0; i < frame.moveCount; i++) {
+            TileCache_InvalidateRect(pipeline->tiles, &frame.moveRects[i].dst);
+            if (FrameRect_Intersects(&frame.moveRects[i].dst, &region)) {
+                contentChanged = true;
+            }
+        }
+    }
+
+    // 창 위치도 내용도 그대로면 이전 출력 재사용
+    if (!contentChanged && pipeline->hasOutput &&
+        pipeline->lastPixels == output->pixels &&
+        pipeline->lastWidth == output->width &&
+        pipeline->lastHeight == output->height &&
+        pipeline->lastOriginX == originX && pipeline->lastOriginY == originY &&
+        pipeline->lastParams.srcWidth == (float)(TILE_SIZE / zoom) &&
+        pipeline->lastParams.filter == view->filter &&
+        pipeline->lastParams.color == view->color &&
+        pipeline->lastParams.linearLight == view->linearLight) {
+        pipeline->stats.framesSkipped++;
+        return false;
+    }
+
+    ScaleParams params = {0};
+    params.srcWidth = (float)(TILE_SIZE / zoom);
+    params.srcHeight = params.srcWidth;
+    params.outputWidth = TILE_SIZE;
+    params.outputHeight = TILE_SIZE;
+    params.filter = view->filter;
+    params.color = view->color;
+    params.linearLight = view->linearLight;
+
+    int reused = 0;
+
+    for (int tileY = tileY0; tileY <= tileY1; tileY++) {
+        for (int tileX = tileX0; tileX <= tileX1; tileX++) {
+            TileKey key = {tileX, tileY, view->zoom, view->filter, view->color, view->linearLight};
+            const PixelBuffer* tile = TileCache_Lookup(pipeline->tiles, &key);
+
+            if (tile) {
+                reused++;
+            } else {
+                FrameRect tileSource = TileSource(tileX, tileY, zoom, desktopWidth, desktopHeight);
+                tile = TileCache_Insert(pipeline->tiles, &key, &tileSource);
+                if (!tile) {
+                    pipeline->hasOutput = false;
+                    return false;
+                }
+
+                // 타일 소스 영역 기준 좌표로 확대 (획득 영역과 무관하게 같은 결과)
+                PixelBuffer tilePixels = PixelBuffer_SubView(&frame.pixels,
+                                                             tileSource.left - frame.bounds.left,
+                                                             tileSource.top - frame.bounds.top,
+                                                             tileSource.right - tileSource.left,
+                                                             tileSource.bottom - tileSource.top);
+                params.srcX = (float)(tileX * TILE_SIZE / zoom - tileSource.left);
+                params.srcY = (float)(tileY * TILE_SIZE / zoom - tileSource.top);
+                if (!Scaler_Render(pipeline->scaler, &tilePixels, tile, &params)) {
+                    TileCache_Remove(pipeline->tiles, &key);
+                    pipeline->hasOutput = false;
+                    return false;
+                }
+
+                pipeline->stats.pixelsScaled += (unsigned long long)TILE_SIZE * TILE_SIZE;
+            }
+
+            // 타일과 출력 창이 겹치는 부분 복사 (다음 타일이 이 버퍼를 재사용할 수 있으므로 즉시)
+            long long left = (long long)tileX * TILE_SIZE;
+            long long top = (long long)tileY * TILE_SIZE;
+            int x0 = (int)(left > originX ? left - originX : 0);
+            int y0 = (int)(top > originY ? top - originY : 0);
+            int x1 = (int)(left + TILE_SIZE - originX < output->width ? left + TILE_SIZE - originX : output->width);
+            int y1 = (int)(top + TILE_SIZE - originY < output->height ? top + TILE_SIZE - originY : output->height);
+            int tileOffsetX = (int)(originX + x0 - left);
+            int tileOffsetY = (int)(originY + y0 - top);
+
+            for (int y = y0; y < y1; y++) {
+                memcpy(PixelBuffer_Row(output, y) + x0,
+                       PixelBuffer_Row(tile, tileOffsetY + y - y0) + tileOffsetX,
+                       (size_t)(x1 - x0) * 4);
+            }
+        }
+    }
+
+    if (reused == 0) {
+        pipeline->stats.framesFull++;
+    } else {
+        pipeline->stats.framesPartial++;
+    }
+
+    pipeline->hasOutput = true;
+    pipeline->lastParams = params;
+    pipeline->lastPixels = output->pixels;
+    pipeline->lastWidth = output->width;
+    pipeline->lastHeight = output->height;
+    pipeline->lastOriginX = (int)originX;
+    pipeline->lastOriginY = (int)originY;
+    memset(&pipeline->lastCapture, 0, sizeof(CaptureArea));    // 직접 확대 경로와 섞이지 않도록
+
+    FrameRect all = {0, 0, output->width, output->height};
+    AddDamage(pipeline, &all);
+    return true;
+}
+
+/**
+ * 한 프레임 처리
+ */
+bool ZoomPipeline_Render(ZoomPipeline* pipeline, const ZoomView* view, const PixelBuffer* output)
+{
+    if (!pipeline || !view || !output || !output->pixels || view->zoom <= 0.0f) {
+        return false;
+    }
+
+    memset(&pipeline->damage, 0, sizeof(FrameRect));
+
+    FrameSource* source = pipeline->source;
+    int desktopWidth = source->width;
+    int desktopHeight = source->height;
+
+    // 확대된 데스크톱이 출력을 덮을 때만 타일 사용 (전환 중간 배율은 다시 쓰이지 않으므로 직접 확대)
+    if (pipeline->tiles && !view->transient &&
+        desktopWidth * (double)view->zoom >= output->width &&
+        desktopHeight * (double)view->zoom >= output->height) {
+        return RenderTiled(pipeline, view, output);
+    }
+
+    // 확대할 소스 영역 (확대 후 출력 전체를 채우도록, 정수로 자르지 않아 느린 이동/확대에도 떨림 없음)
+    CaptureArea capture;
+    capture.width = output->width / (double)view->zoom;
+    capture.height = output->height / (double)view->zoom;
+    if (capture.width < 1.0) capture.width = 1.0;
+    if (capture.height < 1.0) capture.height = 1.0;
+    if (capture.width > desktopWidth) capture.width = desktopWidth;
+    if (capture.height > desktopHeight) capture.height = desktopHeight;
+
+    // 영역의 중심을 확대 중심으로 (데스크톱 경계 체크)
+    capture.x = view->centerX - capture.width / 2.0;
+    capture.y = view->centerY - capture.height / 2.0;
+    if (capture.x > desktopWidth - capture.width) capture.x = desktopWidth - capture.width;
+    if (capture.y > desktopHeight - capture.height) capture.y = desktopHeight - capture.height;
+    if (capture.x < 0.0) capture.x = 0.0;
+    if (capture.y < 0.0) capture.y = 0.0;
+
+    // 서브픽셀 영역을 덮는 픽셀 + 여유분만 획득
+    FrameRect region = {
+        (int)floor(capture.x) - CAPTURE_GUARD,
+        (int)floor(capture.y) - CAPTURE_GUARD,
+        (int)ceil(capture.x + capture.width) + CAPTURE_GUARD,
+        (int)ceil(capture.y + capture.height) + CAPTURE_GUARD
+    };
+
+    Frame frame;
+    if (!AcquireFrame(pipeline, &region, &frame)) {
+        return false;
+    }
+
+    ScaleParams params = {0};
+    params.srcX = (float)(capture.x - frame.bounds.left);
+    params.srcY = (float)(capture.y - frame.bounds.top);
+    params.srcWidth = (float)capture.width;
+    params.srcHeight = (float)capture.height;
+    params.outputWidth = output->width;
+    params.outputHeight = output->height;
+    params.filter = view->filter;
+    params.color = view->color;
+    params.linearLight = view->linearLight;
+
+    // 뷰가 그대로면 바뀐 영역만 다시 확대
+    bool sameView = pipeline->hasOutput && !frame.fullRefresh &&
+                    pipeline->lastPixels == output->pixels &&
+                    pipeline->lastWidth == output->width &&
+                    pipeline->lastHeight == output->height &&
+                    memcmp(&pipeline->lastCapture, &capture, sizeof(CaptureArea)) == 0 &&
+                    pipeline->lastParams.filter == params.filter &&
+                    pipeline->lastParams.color == params.color &&
+                    pipeline->lastParams.linearLight == params.linearLight;
+
+    if (sameView) {
+        FrameRect rects[MAX_PARTIAL_RECTS];
+        int rectCount = 0;
+        long long area = 0;
+        bool overflow = false;
+
+        for (int i = 0; i < frame.dirtyCount + frame.moveCount && !overflow; i++) {
+            const FrameRect* changed = i < frame.dirtyCount ? &frame.dirtyRects[i]
+                                                            : &frame.moveRects[i - frame.dirtyCount].dst;
+            FrameRect mapped;
+            if (!MapToOutput(changed, &capture, output->width, output->height, &mapped)) {
+                continue;
+            }
+            if (rectCount == MAX_PARTIAL_RECTS) {
+                overflow = true;
+                break;
+            }
+            rects[rectCount++] = mapped;
+            area += (long long)(mapped.right - mapped.left) * (mapped.bottom - mapped.top);
+        }
+
+        long long limit = (long long)output->width * output->height * PARTIAL_LIMIT_PERCENT / 100;
+        if (!overflow && area <= limit) {
+            if (rectCount == 0) {
+                pipeline->stats.framesSkipped++;
+                return false;
+            }
+
+            for (int i = 0; i < rectCount; i++) {
+                if (!RenderRect(pipeline, &frame.pixels, output, &params, &rects[i])) {
+                    pipeline->hasOutput = false;
+                    return false;
+                }
+                AddDamage(pipeline, &rects[i]);
+            }
+            pipeline->stats.framesPartial++;
+            return true;
+        }
+    }
+
+    // 출력 전체 다시 확대
+    FrameRect all = {0, 0, output->width, output->height};
+    if (!RenderRect(pipeline, &frame.pixels, output, &params, &all)) {
+        pipeline->hasOutput = false;
+        return false;
+    }
+
+    pipeline->stats.framesFull++;
+    pipeline->hasOutput = true;
+    pipeline->lastParams = params;
+    pipeline->lastCapture = capture;
+    pipeline->lastPixels = output->pixels;
+    pipeline->lastWidth = output->width;
+    pipeline->lastHeight = output->height;
+    pipeline->lastOriginX = -1;                             // 타일 경로와 섞이지 않도록
+    AddDamage(pipeline, &all);
+    return true;
+}
@@ -0,0 +1,104 @@
+/**
+ * zoom_pipeline.h - 확대 파이프라인 (프레임 획득 → 확대)
+ *
+ * 창/GDI와 무관한 확대 처리 단계. 확대 오버레이가 사용하며,
+ * 합성/파일 공급원과 함께 쓰면 화면 없이 (Linux 포함) 구동하고 측정할 수 있다.
+ */
+
+#ifndef LETSZOOM_ZOOM_PIPELINE_H
+#define LETSZOOM_ZOOM_PIPELINE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "frame_source.h"
+#include "pixel_buffer.h"
+#include "scaler.h"
+#include "tile_cache.h"
+#include "tile_hash.h"
+
+// 확대 뷰 상태
+typedef struct {
+    float zoom;         // 확대 배율 (1.0 = 100%)
+    float centerX;      // 확대 중심 (데스크톱 좌표, 커서 + 패닝, 서브픽셀)
+    float centerY;
+    ScaleFilter filter;
+    ColorFilter color;  // 확대하면서 적용할 색 필터
+    bool linearLight;   // 선형 광량에서 보간
+    bool transient;     // 전환 애니메이션 중간 프레임 (타일 캐시에 남기지 않음)
+} ZoomView;
+
+// 확대 통계 (ZoomPipeline_ResetStats로 초기화)
+typedef struct {
+    unsigned long long frames;          // 처리한 프레임 수
+    unsigned long long bytesCopied;     // 누적 캡처 바이트
+    unsigned long long lastFrameBytes;  // 마지막 프레임 캡처 바이트
+    unsigned long long fullFrameBytes;  // 전체 화면 캡처 시 프레임당 바이트 (비교용)
+    unsigned long long framesFull;      // 출력 전체를 다시 확대한 프레임
+    unsigned long long framesPartial;   // 바뀐 부분만 다시 확대한 프레임
+    unsigned long long framesSkipped;   // 변경이 없어 이전 출력을 재사용한 프레임
+    unsigned long long pixelsScaled;    // 누적 확대 출력 픽셀
+    ScalerBandStats bands;              // 마지막 밴드 병렬 확대의 밴드별 시간
+    TileHashStats hash;                 // 타일 해시 (프레임별 바뀐 타일 비율)
+} ZoomStats;
+
+typedef struct ZoomPipeline ZoomPipeline;
+
+/**
+ * 파이프라인 생성 (공급원은 호출자가 소유)
+ */
+ZoomPipeline* ZoomPipeline_Create(FrameSource* source);
+
+/**
+ * 파이프라인 파괴
+ */
+void ZoomPipeline_Destroy(ZoomPipeline* pipeline);
+
+/**
+ * 한 프레임 처리
+ * 보이는 영역만 획득하고, 뷰가 그대로면 바뀐 영역만 다시 확대한다.
+ * output 내용이 바뀌었으면 true
+ */
+bool ZoomPipeline_Render(ZoomPipeline* pipeline, const ZoomView* view, const PixelBuffer* output);
+
+/**
+ * 마지막 ZoomPipeline_Render가 바꾼 출력 영역 (경계 사각형, 바뀐 곳이 없으면 false)
+ * 출력을 여러 버퍼로 돌려 쓸 때 뒤처진 버퍼에 바뀐 부분만 옮기는 데 쓴다.
+ */
+bool ZoomPipeline_GetDamage(const ZoomPipeline* pipeline, FrameRect* damage);
+
+/**
+ * 확대 타일 캐시 사용 (maxBytes: 타일 메모리 한도, 0이면 사용 안 함)
+ * 패닝 시 새로 드러난 타일만 확대한다. 변경 정보가 있는 공급원(정지 화면,
+ * Desktop Duplication)에서 효과가 있다. GDI는 타일 해시를 켜야 변경 영역이 생긴다.
+ */
+bool ZoomPipeline_EnableTileCache(ZoomPipeline* pipeline, size_t maxBytes);
+
+/**
+ * 타일 캐시 통계 (캐시를 쓰지 않으면 false)
+ */
+bool ZoomPipeline_GetTileStats(const ZoomPipeline* pipeline, TileCacheStats* stats);
+
+/**
+ * 타일 내용 해시 사용
+ * 변경 정보 없이 오는 프레임(GDI 캡처, 장치 재연결 직후 등)을 타일별로 해시해
+ * 바뀐 타일만 변경 영역으로 넘긴다. 변경 정보를 주는 프레임은 해시하지 않는다.
+ */
+bool ZoomPipeline_EnableContentHash(ZoomPipeline* pipeline, bool enable);
+
+/**
+ * 확대를 작업 스레드 풀로 나눠 처리 (NULL이면 렌더링 스레드 하나, 풀은 호출자 소유)
+ */
+void ZoomPipeline_SetWorkers(ZoomPipeline* pipeline, WorkerPool* pool);
+
+/**
+ * 다음 프레임은 출력 전체를 다시 확대 (출력 버퍼를 다른 용도로 덮어쓴 경우)
+ */
+void ZoomPipeline_Invalidate(ZoomPipeline* pipeline);
+
+/**
+ * 통계 가져오기 / 초기화
+ */
+void ZoomPipeline_GetStats(const ZoomPipeline* pipeline, ZoomStats* stats);
+void ZoomPipeline_ResetStats(ZoomPipeline* pipeline);
+
+#endif // LETSZOOM_ZOOM_PIPELINE_H
@@ -0,0 +1,323 @@
+/**
+ * zoom_renderer.c - 확대 렌더 스레드 구현
+ *
+ * 파이프라인은 항상 같은 캔버스에 확대하므로 바뀐 부분만 다시 확대하는 최적화가 유지된다.
+ * 완성된 프레임은 캔버스에서 쓰기 버퍼로 바뀐 영역만 복사한 뒤 "최신" 버퍼와 맞바꾼다.
+ * 각 백 버퍼는 마지막으로 쓴 뒤 캔버스에서 바뀐 영역을 모아 두었다가 다음 차례에 함께 옮긴다.
+ */
+
+#include "zoom_renderer.h"
+#include "dib_buffer.h"
+#include "frame_pacer.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define BUFFER_COUNT 3
+
+struct ZoomRenderer {
+    ZoomPipeline* pipeline;                 // NULL이면 요청 무시 (교체는 처리 중인 뷰가 없을 때만)
+    int width;
+    int height;
+    HWND hwnd;
+    UINT message;
+
+    DibBuffer canvas;                       // 파이프라인 출력 (렌더 스레드 전용)
+    DibBuffer buffers[BUFFER_COUNT];        // 백 버퍼 (쓰기 / 최신 / 표시 중)
+    FrameRect stale[BUFFER_COUNT];          // 버퍼별로 캔버스보다 뒤처진 영역
+
+    // 아래는 lock으로 보호
+    CRITICAL_SECTION lock;
+    int writeIndex;                         // 렌더 스레드가 쓰는 버퍼
+    int readyIndex;                         // 완성된 가장 최근 버퍼
+    int presentIndex;                       // 창 스레드가 그리는 버퍼
+    bool fresh;                             // readyIndex가 아직 표시되지 않음
+    bool hasView;
+    ZoomView view;                          // 처리할 뷰 (가장 최근 요청)
+    ZoomRenderStats stats;
+    ZoomStats pipelineStats;
+    TileCacheStats tileStats;
+    bool hasTiles;
+
+    HANDLE stopEvent;
+    HANDLE wakeEvent;                       // 새 뷰 요청
+    HANDLE idleEvent;                       // 처리할 뷰 없음 (수동 리셋)
+    HANDLE thread;
+    volatile LONG posted;                   // 보낸 알림을 창이 아직 처리하지 않음
+};
+
+/**
+ * 사각형 합치기 (경계 사각형)
+ */
+static void MergeRect(FrameRect* target, const FrameRect* rect)
+{
+    if (target->right <= target->left || target->bottom <= target->top) {
+        *target = *rect;
+        return;
+    }
+
+    if (rect->left < target->left) target->left = rect->left;
+    if (rect->top < target->top) target->top = rect->top;
+    if (rect->right > target->right) target->right = rect->right;
+    if (rect->bottom > target->bottom) target->bottom = rect->bottom;
+}
+
+/**
+ * 캔버스에서 바뀐 영역을 쓰기 버퍼로 옮기고 최신 버퍼와 맞바꾸기
+ */
+static void Publish(ZoomRenderer* renderer)
+{
+    FrameRect damage;
+    if (!ZoomPipeline_GetDamage(renderer->pipeline, &damage)) {
+        return;
+    }
+
+    for (int i = 0; i < BUFFER_COUNT; i++) {
+        MergeRect(&renderer->stale[i], &damage);
+    }
+
+    // 쓰기 버퍼는 창 스레드가 건드리지 않으므로 잠그지 않고 복사
+    int index = renderer->writeIndex;
+    FrameRect* r = &renderer->stale[index];
+    const PixelBuffer* target = &renderer->buffers[index].pixels;
+    for (int y = r->top; y < r->bottom; y++) {
+        memcpy(PixelBuffer_Row(target, y) + r->left,
+               PixelBuffer_Row(&renderer->canvas.pixels, y) + r->left,
+               (size_t)(r->right - r->left) * 4);
+    }
+    memset(r, 0, sizeof(FrameRect));
+
+    EnterCriticalSection(&renderer->lock);
+    renderer->writeIndex = renderer->readyIndex;
+    renderer->readyIndex = index;
+    renderer->fresh = true;
+    renderer->stats.published++;
+    LeaveCriticalSection(&renderer->lock);
+
+    if (InterlockedExchange(&renderer->posted, 1) == 0) {
+        PostMessageW(renderer->hwnd, renderer->message, 0, 0);
+    }
+}
+
+/**
+ * 렌더 스레드
+ * 깨어나면 가장 최근 뷰만 처리하고, 처리 중에 들어온 요청은 다음 차례에 하나로 합쳐진다.
+ */
+static DWORD WINAPI RenderThread(LPVOID param)
+{
+    ZoomRenderer* renderer = (ZoomRenderer*)param;
+    HANDLE handles[2] = {renderer->stopEvent, renderer->wakeEvent};
+
+    while (WaitForMultipleObjects(2, handles, FALSE, INFINITE) == WAIT_OBJECT_0 + 1) {
+        for (;;) {
+            EnterCriticalSection(&renderer->lock);
+            if (!renderer->hasView) {
+                SetEvent(renderer->idleEvent);
+                LeaveCriticalSection(&renderer->lock);
+                break;
+            }
+            ZoomView view = renderer->view;
+            renderer->hasView = false;
+            LeaveCriticalSection(&renderer->lock);
+
+            if (!renderer->pipeline) {
+                continue;
+            }
+
+            double start = FramePacer_Now();
+            if (ZoomPipeline_Render(renderer->pipeline, &view, &renderer->canvas.pixels)) {
+                Publish(renderer);
+            }
+            double elapsed = FramePacer_Now() - start;
+
+            EnterCriticalSection(&renderer->lock);
+            ZoomRenderStats* stats = &renderer->stats;
+            stats->rendered++;
+            stats->lastMs = elapsed;
+            stats->meanMs += (elapsed - stats->meanMs) / (double)stats->rendered;
+            if (elapsed > stats->maxMs) stats->maxMs = elapsed;
+            ZoomPipeline_GetStats(renderer->pipeline, &renderer->pipelineStats);
+            renderer->hasTiles = ZoomPipeline_GetTileStats(renderer->pipeline, &renderer->tileStats);
+            LeaveCriticalSection(&renderer->lock);
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * 렌더러 생성
+ */
+ZoomRenderer* ZoomRenderer_Create(ZoomPipeline* pipeline, int width, int height, HWND hwnd, UINT message)
+{
+    if (width <= 0 || height <= 0) return NULL;
+
+    ZoomRenderer* renderer = (ZoomRenderer*)calloc(1, sizeof(ZoomRenderer));
+    if (!renderer) return NULL;
+
+    renderer->pipeline = pipeline;
+    renderer->width = width;
+    renderer->height = height;
+    renderer->hwnd = hwnd;
+    renderer->message = message;
+    renderer->writeIndex = 0;
+    renderer->readyIndex = 1;
+    renderer->presentIndex = 2;
+    InitializeCriticalSection(&renderer->lock);
+
+    // 캔버스와 백 버퍼 모두 DIB 섹션 (GDI와 확대 커널이 같은 메모리를 씀)
+    bool ok = DibBuffer_Create(&renderer->canvas, width, height);
+    for (int i = 0; i < BUFFER_COUNT && ok; i++) {
+        ok = DibBuffer_Create(&renderer->buffers[i], width, height);
+    }
+
+    renderer->stopEvent = CreateEventW(NULL, TRUE, FALSE, NULL);
+    renderer->wakeEvent = CreateEventW(NULL, FALSE, FALSE, NULL);
+    renderer->idleEvent = CreateEventW(NULL, TRUE, TRUE, NULL);
+
+    if (ok && renderer->stopEvent && renderer->wakeEvent && renderer->idleEvent) {
+        renderer->thread = CreateThread(NULL, 0, RenderThread, renderer, 0, NULL);
+    }
+
+    if (!renderer->thread) {
+        OutputDebugStringW(L"[ZoomRenderer] Failed to start renderer\n");
+        ZoomRenderer_Destroy(renderer);
+        return NULL;
+    }
+
+    return renderer;
+}
+
+/**
+ * 렌더러 파괴
+ */
+void ZoomRenderer_Destroy(ZoomRenderer* renderer)
+{
+    if (!renderer) return;
+
+    if (renderer->thread) {
+        SetEvent(renderer->stopEvent);
+        WaitForSingleObject(renderer->thread, INFINITE);
+        CloseHandle(renderer->thread);
+    }
+
+    if (renderer->stopEvent) CloseHandle(renderer->stopEvent);
+    if (renderer->wakeEvent) CloseHandle(renderer->wakeEvent);
+    if (renderer->idleEvent) CloseHandle(renderer->idleEvent);
+
+    for (int i = 0; i < BUFFER_COUNT; i++) {
+        DibBuffer_Destroy(&renderer->buffers[i]);
+    }
+    DibBuffer_Destroy(&renderer->canvas);
+
+    DeleteCriticalSection(&renderer->lock);
+    free(renderer);
+}
+
+/**
+ * 파이프라인 교체
+ */
+void ZoomRenderer_SetPipeline(ZoomRenderer* renderer, ZoomPipeline* pipeline)
+{
+    if (!renderer) return;
+
+    EnterCriticalSection(&renderer->lock);
+    renderer->pipeline = pipeline;
+    renderer->hasView = false;
+    renderer->fresh = false;
+    memset(&renderer->stats, 0, sizeof(ZoomRenderStats));
+    memset(&renderer->pipelineStats, 0, sizeof(ZoomStats));
+    memset(&renderer->tileStats, 0, sizeof(TileCacheStats));
+    renderer->hasTiles = false;
+    LeaveCriticalSection(&renderer->lock);
+
+    // 숨긴 창이 처리하지 못한 알림이 남아 있어도 다음 프레임은 다시 알림
+    InterlockedExchange(&renderer->posted, 0);
+}
+
+/**
+ * 뷰 요청
+ */
+void ZoomRenderer_Submit(ZoomRenderer* renderer, const ZoomView* view)
+{
+    if (!renderer || !view) return;
+
+    EnterCriticalSection(&renderer->lock);
+    if (renderer->hasView) {
+        renderer->stats.superseded++;
+    }
+    renderer->view = *view;
+    renderer->hasView = true;
+    renderer->stats.requests++;
+    ResetEvent(renderer->idleEvent);
+    LeaveCriticalSection(&renderer->lock);
+
+    SetEvent(renderer->wakeEvent);
+}
+
+/**
+ * 요청한 뷰를 모두 처리할 때까지 대기
+ */
+bool ZoomRenderer_WaitIdle(ZoomRenderer* renderer, DWORD timeoutMs)
+{
+    if (!renderer) return false;
+
+    return WaitForSingleObject(renderer->idleEvent, timeoutMs) == WAIT_OBJECT_0;
+}
+
+/**
+ * 가장 최근 프레임 그리기
+ */
+bool ZoomRenderer_Present(ZoomRenderer* renderer, HDC hdc)
+{
+    if (!renderer) return false;
+
+    // 알림을 받았으니 다음 프레임은 다시 알림
+    InterlockedExchange(&renderer->posted, 0);
+
+    EnterCriticalSection(&renderer->lock);
+    if (renderer->fresh) {
+        int index = renderer->presentIndex;
+        renderer->presentIndex = renderer->readyIndex;
+        renderer->readyIndex = index;
+        renderer->fresh = false;
+    }
+    bool hasFrame = renderer->stats.published > 0;
+    int index = renderer->presentIndex;
+    if (hasFrame) {
+        renderer->stats.presented++;
+    }
+    LeaveCriticalSection(&renderer->lock);
+
+    // 표시 버퍼는 렌더 스레드가 쓰지 않으므로 잠그지 않고 그림
+    if (hasFrame) {
+        BitBlt(hdc, 0, 0, renderer->width, renderer->height, renderer->buffers[index].hdc, 0, 0, SRCCOPY);
+    }
+    return hasFrame;
+}
+
+/**
+ * 렌더 스레드 통계 가져오기
+ */
+void ZoomRenderer_GetStats(ZoomRenderer* renderer, ZoomRenderStats* stats)
+{
+    if (!renderer || !stats) return;
+
+    EnterCriticalSection(&renderer->lock);
+    *stats = renderer->stats;
+    LeaveCriticalSection(&renderer->lock);
+}
+
+/**
+ * 파이프라인 통계 가져오기
+ */
+bool ZoomRenderer_GetPipelineStats(ZoomRenderer* renderer, ZoomStats* stats, TileCacheStats* tileStats)
+{
+    if (!renderer) return false;
+
+    EnterCriticalSection(&renderer->lock);
+    if (stats) *stats = renderer->pipelineStats;
+    if (tileStats) *tileStats = renderer->tileStats;
+    bool hasTiles = renderer->hasTiles;
+    LeaveCriticalSection(&renderer->lock);
+    return hasTiles;
+}
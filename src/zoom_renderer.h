@@ -0,0 +1,75 @@
+/**
+ * zoom_renderer.h - 확대 렌더 스레드 (삼중 버퍼 표시)
+ *
+ * 캡처와 확대를 별도 스레드에서 처리해 세 개의 DIB 백 버퍼 중 하나에 쓰고,
+ * 창 스레드는 완성된 가장 최근 버퍼만 BitBlt 한다. 한 프레임이 오래 걸려도
+ * 휠/드래그 입력 처리는 막히지 않고, 늦게 끝난 중간 뷰는 새 뷰로 덮어써 버린다.
+ */
+
+#ifndef LETSZOOM_ZOOM_RENDERER_H
+#define LETSZOOM_ZOOM_RENDERER_H
+
+#include <windows.h>
+#include <stdbool.h>
+#include "zoom_pipeline.h"
+
+// 렌더 스레드 통계
+typedef struct {
+    unsigned long long requests;        // 요청된 뷰 수
+    unsigned long long superseded;      // 처리 전에 새 뷰로 바뀐 요청
+    unsigned long long rendered;        // 처리한 뷰 수
+    unsigned long long published;       // 내용이 바뀌어 표시 대기로 넘긴 프레임
+    unsigned long long presented;       // 창에 그린 횟수
+    double lastMs;                      // 마지막 프레임 처리 시간
+    double meanMs;                      // 평균 처리 시간
+    double maxMs;                       // 최대 처리 시간
+} ZoomRenderStats;
+
+typedef struct ZoomRenderer ZoomRenderer;
+
+/**
+ * 렌더러 생성 (width × height 백 버퍼 3개, 렌더 스레드 시작)
+ * 이후 파이프라인(과 그 공급원)은 렌더 스레드만 사용하며, 파괴는 렌더러 파괴나
+ * 파이프라인 교체 뒤 호출자가 한다.
+ * 새 프레임이 완성되면 hwnd에 message를 PostMessage (ZoomRenderer_Present 전까지 한 번만).
+ */
+ZoomRenderer* ZoomRenderer_Create(ZoomPipeline* pipeline, int width, int height, HWND hwnd, UINT message);
+
+/**
+ * 렌더러 파괴 (스레드 종료 대기)
+ */
+void ZoomRenderer_Destroy(ZoomRenderer* renderer);
+
+/**
+ * 파이프라인 교체 (NULL이면 요청을 무시, 버퍼와 스레드는 유지)
+ * 처리 중인 뷰가 없을 때 (ZoomRenderer_WaitIdle 뒤) 호출한다.
+ * 통계와 표시 대기 프레임은 초기화되어 새 파이프라인의 첫 프레임 전에는 Present가 그리지 않는다.
+ */
+void ZoomRenderer_SetPipeline(ZoomRenderer* renderer, ZoomPipeline* pipeline);
+
+/**
+ * 뷰 요청 (기다리지 않음, 아직 처리하지 않은 이전 요청은 대체)
+ */
+void ZoomRenderer_Submit(ZoomRenderer* renderer, const ZoomView* view);
+
+/**
+ * 요청한 뷰를 모두 처리할 때까지 대기 (첫 프레임용, 시간 초과면 false)
+ */
+bool ZoomRenderer_WaitIdle(ZoomRenderer* renderer, DWORD timeoutMs);
+
+/**
+ * 완성된 가장 최근 프레임을 hdc의 (0,0)에 그리기 (창 스레드, 아직 프레임이 없으면 false)
+ */
+bool ZoomRenderer_Present(ZoomRenderer* renderer, HDC hdc);
+
+/**
+ * 렌더 스레드 통계 가져오기
+ */
+void ZoomRenderer_GetStats(ZoomRenderer* renderer, ZoomRenderStats* stats);
+
+/**
+ * 파이프라인 통계 가져오기 (마지막으로 처리한 프레임 기준, 타일 캐시를 쓰지 않으면 false)
+ */
+bool ZoomRenderer_GetPipelineStats(ZoomRenderer* renderer, ZoomStats* stats, TileCacheStats* tileStats);
+
+#endif // LETSZOOM_ZOOM_RENDERER_H
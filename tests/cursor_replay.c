@@ -0,0 +1,300 @@
+/**
+ * cursor_replay.c - 커서 예측 재생 측정
+ *
+ * 시각이 붙은 커서 기록을 확대 오버레이와 같은 방식(프레임마다 샘플 추가 → 표시 시각 예측)으로
+ * CursorPredictor에 재생하고, 예측 위치를 기록 속 그 시각의 실제 위치와 비교한다.
+ * 평활 시간 × 예측 강도 표를 출력해 설정 기본값(16 ms, 75%)의 근거로 삼는다.
+ *
+ * 기록 파일이 없으면 합성 기록을 쓴다: 500 Hz 마우스 보고(정수 좌표)로
+ * 목표를 지나쳤다가 되돌아오는 최소 저크 곡선 이동, 손떨림이 있는 멈춤, 느린 드래그, 원을 그리는 가리킴.
+ * 프레임 시각도 ±1 ms 흔들린다.
+ * 기록 파일 형식은 한 줄에 "밀리초 x y" (시각은 단조 증가).
+ *
+ * ctest로 돌릴 때는 합성 기록에서 기본값이 예측 없음보다 평균 오차가 작은지 확인한다.
+ *
+ * 사용법: cursor_replay [기록 파일]
+ */
+
+#include "cursor_predictor.h"
+#include "test_image.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// 확대 오버레이의 프레임 주기와 렌더 시간 (예측 목표 = 샘플 시각 + 렌더 + 한 주기)
+#define FRAME_PERIOD_MS (1000.0 / 60.0)
+#define RENDER_MS 5.0
+
+// 합성 기록
+#define SYNTH_REPORT_MS 2.0         // 500 Hz
+#define SYNTH_DURATION_MS 60000.0
+
+// 설정 기본값 (settings.c)
+#define DEFAULT_SMOOTHING_MS 16.0
+#define DEFAULT_GAIN 0.75
+
+typedef struct {
+    double ms, x, y;
+} TraceSample;
+
+typedef struct {
+    TraceSample* samples;
+    int count;
+    int capacity;
+} Trace;
+
+typedef struct {
+    int predictions;
+    double meanErrorPx;
+    double p95ErrorPx;
+    double maxErrorPx;
+    double meanLagPx;       // 예측 없이 마지막 샘플을 쓸 때
+} ReplayResult;
+
+static bool AddTraceSample(Trace* trace, double ms, double x, double y)
+{
+    if (trace->count == trace->capacity) {
+        int capacity = trace->capacity ? trace->capacity * 2 : 4096;
+        TraceSample* samples = (TraceSample*)realloc(trace->samples, sizeof(TraceSample) * (size_t)capacity);
+        if (!samples) return false;
+        trace->samples = samples;
+        trace->capacity = capacity;
+    }
+    TraceSample* s = &trace->samples[trace->count++];
+    s->ms = ms;
+    s->x = x;
+    s->y = y;
+    return true;
+}
+
+/**
+ * 0~1 균등 난수
+ */
+static double RandomUnit(uint32_t* state)
+{
+    return (double)(TestImage_Random(state) % 1000000u) / 1000000.0;
+}
+
+/**
+ * 합성 기록 만들기 (보고 시각마다 정수 좌표)
+ */
+static bool CreateSyntheticTrace(Trace* trace)
+{
+    uint32_t state = 31337;
+    double ms = 0.0;
+    double x = 960.0, y = 540.0;
+
+    while (ms < SYNTH_DURATION_MS) {
+        double kind = RandomUnit(&state);
+        double startX = x, startY = y;
+
+        if (kind < 0.55) {
+            // 목표로 이동 (최소 저크 곡선: 천천히 출발해 빨라졌다가 멈춤)
+            // 사람 손처럼 목표를 조금 지나쳤다가 짧은 두 번째 이동으로 되돌아옴, 이동 중 손떨림
+            double targetX = 100.0 + RandomUnit(&state) * 1720.0;
+            double targetY = 100.0 + RandomUnit(&state) * 880.0;
+            double overshoot = 0.03 + RandomUnit(&state) * 0.09;
+            double points[3][2] = {
+                {startX, startY},
+                {targetX + (targetX - startX) * overshoot, targetY + (targetY - startY) * overshoot},
+                {targetX, targetY},
+            };
+            for (int leg = 0; leg < 2; leg++) {
+                double fromX = points[leg][0], fromY = points[leg][1];
+                double toX = points[leg + 1][0], toY = points[leg + 1][1];
+                double distance = hypot(toX - fromX, toY - fromY);
+                double duration = (leg == 0 ? 150.0 : 80.0) + distance * (0.25 + RandomUnit(&state) * 0.3);
+                double tremorPhase = RandomUnit(&state) * 6.2831853;
+                for (double t = 0.0; t < duration; t += SYNTH_REPORT_MS) {
+                    double s = t / duration;
+                    double p = s * s * s * (10.0 - 15.0 * s + 6.0 * s * s);
+                    double tremor = 0.8 * sin(tremorPhase + 6.2831853 * t / 100.0);  // 10 Hz
+                    x = fromX + (toX - fromX) * p + tremor;
+                    y = fromY + (toY - fromY) * p - tremor;
+                    if (!AddTraceSample(trace, ms + t, floor(x + 0.5), floor(y + 0.5))) return false;
+                }
+                ms += duration;
+            }
+            x = targetX;
+            y = targetY;
+        } else if (kind < 0.75) {
+            // 멈춤 (손떨림 ±1 픽셀, 보고는 움직일 때만 오지만 같은 위치로 채움)
+            double duration = 100.0 + RandomUnit(&state) * 600.0;
+            for (double t = 0.0; t < duration; t += SYNTH_REPORT_MS) {
+                double jitterX = (TestImage_Random(&state) % 64 == 0) ? (double)(TestImage_Random(&state) % 3) - 1.0 : 0.0;
+                if (!AddTraceSample(trace, ms + t, floor(x + 0.5) + jitterX, floor(y + 0.5))) return false;
+            }
+            ms += duration;
+        } else if (kind < 0.9) {
+            // 느린 드래그 (일정 속도로 밑줄 긋기)
+            double speed = 0.1 + RandomUnit(&state) * 0.3;
+            double angle = RandomUnit(&state) * 6.2831853;
+            double duration = 300.0 + RandomUnit(&state) * 700.0;
+            for (double t = 0.0; t < duration; t += SYNTH_REPORT_MS) {
+                x = fmin(fmax(startX + cos(angle) * speed * t, 0.0), 1919.0);
+                y = fmin(fmax(startY + sin(angle) * speed * t, 0.0), 1079.0);
+                if (!AddTraceSample(trace, ms + t, floor(x + 0.5), floor(y + 0.5))) return false;
+            }
+            ms += duration;
+        } else {
+            // 원을 그리며 가리킴 (방향이 계속 바뀜)
+            double radius = 40.0 + RandomUnit(&state) * 120.0;
+            double period = 500.0 + RandomUnit(&state) * 700.0;
+            double duration = period * (1.0 + RandomUnit(&state));
+            for (double t = 0.0; t < duration; t += SYNTH_REPORT_MS) {
+                double a = 6.2831853 * t / period;
+                x = startX + radius * sin(a);
+                y = startY + radius * (1.0 - cos(a));
+                if (!AddTraceSample(trace, ms + t, floor(x + 0.5), floor(y + 0.5))) return false;
+            }
+            ms += duration;
+        }
+    }
+    return true;
+}
+
+/**
+ * 기록 파일 읽기 ("밀리초 x y")
+ */
+static bool LoadTrace(Trace* trace, const char* path)
+{
+    FILE* file = fopen(path, "r");
+    if (!file) {
+        return false;
+    }
+
+    double ms, x, y;
+    bool valid = true;
+    while (valid && fscanf(file, "%lf %lf %lf", &ms, &x, &y) == 3) {
+        valid = (trace->count == 0 || ms >= trace->samples[trace->count - 1].ms) &&
+                AddTraceSample(trace, ms, x, y);
+    }
+    fclose(file);
+    return valid && trace->count > 1;
+}
+
+/**
+ * ms 시각에 화면에 있던 커서 (그 시각까지 마지막 보고, 이후 인덱스를 돌려줌)
+ */
+static int CursorAt(const Trace* trace, int from, double ms, double* x, double* y)
+{
+    while (from + 1 < trace->count && trace->samples[from + 1].ms <= ms) {
+        from++;
+    }
+    *x = trace->samples[from].x;
+    *y = trace->samples[from].y;
+    return from;
+}
+
+static int CompareDouble(const void* a, const void* b)
+{
+    double x = *(const double*)a, y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * 기록 한 번 재생
+ * 프레임마다 GetCursorPos처럼 그 시각의 커서를 샘플로 넣고, 표시 시각(렌더 + 한 주기 뒤)을 예측한 뒤
+ * 기록에서 그 시각의 실제 커서와 비교한다.
+ */
+static bool Replay(const Trace* trace, double smoothingMs, double gain, ReplayResult* result)
+{
+    double start = trace->samples[0].ms;
+    double end = trace->samples[trace->count - 1].ms;
+    int frames = (int)((end - start) / FRAME_PERIOD_MS);
+    double* errors = (double*)malloc(sizeof(double) * (size_t)(frames > 0 ? frames : 1));
+    if (!errors) return false;
+
+    CursorPredictor predictor;
+    CursorPredictor_Reset(&predictor, smoothingMs, gain);
+
+    int count = 0;
+    int sampleIndex = 0, actualIndex = 0;
+    double errorSum = 0.0, lagSum = 0.0, maxError = 0.0;
+    uint32_t jitterState = 99;
+    for (int i = 0; i < frames; i++) {
+        double now = start + i * FRAME_PERIOD_MS + (RandomUnit(&jitterState) * 2.0 - 1.0);
+        double target = now + RENDER_MS + FRAME_PERIOD_MS;
+        if (target > end) break;
+
+        double cursorX, cursorY, predictedX, predictedY, actualX, actualY;
+        sampleIndex = CursorAt(trace, sampleIndex, now, &cursorX, &cursorY);
+        CursorPredictor_AddSample(&predictor, now, cursorX, cursorY);
+        if (!CursorPredictor_Predict(&predictor, target, &predictedX, &predictedY)) {
+            continue;
+        }
+
+        actualIndex = CursorAt(trace, actualIndex > sampleIndex ? actualIndex : sampleIndex, target,
+                               &actualX, &actualY);
+        double error = hypot(predictedX - actualX, predictedY - actualY);
+        errors[count++] = error;
+        errorSum += error;
+        lagSum += hypot(cursorX - actualX, cursorY - actualY);
+        if (error > maxError) maxError = error;
+    }
+
+    qsort(errors, (size_t)count, sizeof(double), CompareDouble);
+    result->predictions = count;
+    result->meanErrorPx = count ? errorSum / count : 0.0;
+    result->p95ErrorPx = count ? errors[(int)(count * 0.95)] : 0.0;
+    result->maxErrorPx = maxError;
+    result->meanLagPx = count ? lagSum / count : 0.0;
+    free(errors);
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    static const double smoothings[] = {0.0, 8.0, 16.0, 32.0, 64.0};
+    static const double gains[] = {0.0, 0.25, 0.5, 0.75, 1.0};
+
+    Trace trace = {0};
+    bool loaded = argc > 1 ? LoadTrace(&trace, argv[1]) : CreateSyntheticTrace(&trace);
+    if (!loaded) {
+        printf("FAIL: could not %s trace\n", argc > 1 ? "read" : "create");
+        free(trace.samples);
+        return 1;
+    }
+
+    printf("trace: %s, %d samples over %.1f s, frame %.2f ms + render %.1f ms\n",
+           argc > 1 ? argv[1] : "synthetic", trace.count,
+           (trace.samples[trace.count - 1].ms - trace.samples[0].ms) / 1000.0, FRAME_PERIOD_MS, RENDER_MS);
+    printf("mean / p95 prediction error (px), no prediction: ");
+
+    ReplayResult none;
+    Replay(&trace, DEFAULT_SMOOTHING_MS, 0.0, &none);
+    printf("%.2f / %.2f\n", none.meanErrorPx, none.p95ErrorPx);
+
+    printf("%-12s", "smooth\\gain");
+    for (size_t g = 0; g < sizeof(gains) / sizeof(gains[0]); g++) {
+        printf(" %13.2f", gains[g]);
+    }
+    printf("\n");
+
+    ReplayResult defaults = none;
+    for (size_t s = 0; s < sizeof(smoothings) / sizeof(smoothings[0]); s++) {
+        printf("%9.0f ms", smoothings[s]);
+        for (size_t g = 0; g < sizeof(gains) / sizeof(gains[0]); g++) {
+            ReplayResult result;
+            Replay(&trace, smoothings[s], gains[g], &result);
+            printf("  %5.2f / %5.1f", result.meanErrorPx, result.p95ErrorPx);
+            if (smoothings[s] == DEFAULT_SMOOTHING_MS && gains[g] == DEFAULT_GAIN) {
+                defaults = result;
+            }
+        }
+        printf("\n");
+    }
+    free(trace.samples);
+
+    printf("defaults (%.0f ms, %.0f%%): mean %.2f px, p95 %.2f px, max %.1f px over %d frames\n",
+           DEFAULT_SMOOTHING_MS, DEFAULT_GAIN * 100.0, defaults.meanErrorPx, defaults.p95ErrorPx,
+           defaults.maxErrorPx, defaults.predictions);
+
+    // 기록 파일이면 측정만, 합성 기록이면 기본값이 예측 없음보다 나아야 함
+    if (argc > 1) {
+        return 0;
+    }
+    bool better = defaults.meanErrorPx < none.meanErrorPx;
+    printf("%s: defaults %s than no prediction\n", better ? "PASSED" : "FAILED", better ? "better" : "not better");
+    return better ? 0 : 1;
+}
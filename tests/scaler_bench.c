@@ -0,0 +1,506 @@
+/**
+ * scaler_bench.c - 확대 엔진 처리량 측정
+ *
+ * 4K 출력을 한 스레드로 확대하는 시간을 필터/명령어 집합별로 재고 Mpix/s(출력 픽셀 기준)로 출력한다.
+ * zoom 구간은 배율(2x/4x/8x)에 따른 바이리니어와 Lanczos-3의 차이를,
+ * replicate 구간은 정수 배율 최근접 확대에서 픽셀 반복과 위치 테이블 경로의 차이를 타일 하나 단위로 잰다.
+ * threads 구간은 4K 출력을 1/2/4/8 스레드 풀로 밴드 병렬 확대한 전체 시간과 밴드별 시간을 잰다.
+ * color 구간은 색 필터마다 4K 출력 200% 바이리니어 확대 시간을 색 필터 없는 경우와 비교한다.
+ * linear 구간은 선형 광량 보간을 켠 확대 시간을 끈 경우와 비교한다.
+ * hash 구간은 변경 정보 없는 4K 프레임의 타일 해시 비용을 200% 바이리니어 확대 한 번과 비교한다.
+ * snapshot 구간은 4K 정지 화면의 압축/풀기 시간과 압축률을 잰다 (풀기는 한 프레임 안이어야 함).
+ * spotlight 구간은 4K 스포트라이트 마스크를 전부 그릴 때와 커서를 따라 바뀐 영역만 그릴 때의 시간을 잰다.
+ * 테스트가 아니므로 ctest에는 넣지 않는다. 최적화 빌드에서 실행할 것.
+ *
+ * 사용법: scaler_bench [all|filters|zoom|replicate|threads|color|linear|hash|snapshot|spotlight] [반복 횟수]
+ */
+
+#include "scaler.h"
+#include "snapshot_codec.h"
+#include "spotlight.h"
+#include "test_image.h"
+#include "tile_hash.h"
+#include "worker_pool.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define OUTPUT_WIDTH 3840
+#define OUTPUT_HEIGHT 2160
+
+// 타일 캐시 단위 (tile_cache.h의 TILE_SIZE)
+#define TILE_PIXELS 256
+
+static const char* g_isaNames[] = {"scalar", "sse2", "avx2"};
+static const char* g_filterNames[] = {"nearest", "bilinear", "bicubic", "lanczos3"};
+
+static int g_repeats = 10;
+
+/**
+ * 한 번 확대하는 평균 시간 (밀리초, 가중치 테이블을 만드는 첫 렌더는 제외)
+ */
+static double TimeRender(Scaler* scaler, const PixelBuffer* source, const PixelBuffer* output,
+                         const ScaleParams* params)
+{
+    if (!Scaler_Render(scaler, source, output, params)) {
+        return -1.0;
+    }
+
+    double start = WorkerPool_NowMs();
+    for (int i = 0; i < g_repeats; i++) {
+        Scaler_Render(scaler, source, output, params);
+    }
+    return (WorkerPool_NowMs() - start) / g_repeats;
+}
+
+/**
+ * 필터 × 명령어 집합 (4K 원본의 가운데 1/4을 4K 출력으로, 200%)
+ */
+static void BenchFilters(Scaler* scaler, const PixelBuffer* source, const PixelBuffer* output)
+{
+    printf("== filters: %dx%d output at 200%%, one thread ==\n", OUTPUT_WIDTH, OUTPUT_HEIGHT);
+    printf("%-10s %-7s %10s %10s\n", "filter", "isa", "ms/frame", "Mpix/s");
+
+    for (int filter = 0; filter < 4; filter++) {
+        for (int isa = 0; isa < 3; isa++) {
+            Scaler_SetIsa(scaler, (ScalerIsa)isa);
+            if (Scaler_GetIsa(scaler) != (ScalerIsa)isa) {
+                continue;  // 이 CPU가 지원하지 않음
+            }
+
+            ScaleParams params;
+            memset(&params, 0, sizeof(params));
+            params.srcX = OUTPUT_WIDTH / 4.0f;
+            params.srcY = OUTPUT_HEIGHT / 4.0f;
+            params.srcWidth = OUTPUT_WIDTH / 2.0f;
+            params.srcHeight = OUTPUT_HEIGHT / 2.0f;
+            params.outputWidth = OUTPUT_WIDTH;
+            params.outputHeight = OUTPUT_HEIGHT;
+            params.filter = (ScaleFilter)filter;
+
+            double ms = TimeRender(scaler, source, output, &params);
+            printf("%-10s %-7s %10.2f %10.0f\n", g_filterNames[filter], g_isaNames[isa],
+                   ms, (double)OUTPUT_WIDTH * OUTPUT_HEIGHT / (ms * 1000.0));
+        }
+    }
+}
+
+/**
+ * 배율별 바이리니어 대 Lanczos-3 (4K 원본 가운데를 4K 출력으로)
+ * 배율이 클수록 출력 픽셀당 읽는 원본이 줄어 두 필터 모두 빨라진다.
+ */
+static void BenchZoom(Scaler* scaler, const PixelBuffer* source, const PixelBuffer* output)
+{
+    static const int zooms[] = {2, 4, 8};
+    static const ScaleFilter filters[] = {SCALE_FILTER_BILINEAR, SCALE_FILTER_LANCZOS3};
+
+    printf("== zoom: %dx%d output, ms/frame at 2x / 4x / 8x, one thread ==\n", OUTPUT_WIDTH, OUTPUT_HEIGHT);
+    printf("%-10s %-7s %8s %8s %8s\n", "filter", "isa", "2x", "4x", "8x");
+
+    for (int isa = 0; isa < 3; isa++) {
+        Scaler_SetIsa(scaler, (ScalerIsa)isa);
+        if (Scaler_GetIsa(scaler) != (ScalerIsa)isa) {
+            continue;  // 이 CPU가 지원하지 않음
+        }
+
+        for (int f = 0; f < 2; f++) {
+            printf("%-10s %-7s", g_filterNames[filters[f]], g_isaNames[isa]);
+            for (int z = 0; z < 3; z++) {
+                ScaleParams params;
+                memset(&params, 0, sizeof(params));
+                params.srcWidth = (float)OUTPUT_WIDTH / zooms[z];
+                params.srcHeight = (float)OUTPUT_HEIGHT / zooms[z];
+                params.srcX = (OUTPUT_WIDTH - params.srcWidth) / 2.0f;
+                params.srcY = (OUTPUT_HEIGHT - params.srcHeight) / 2.0f;
+                params.outputWidth = OUTPUT_WIDTH;
+                params.outputHeight = OUTPUT_HEIGHT;
+                params.filter = filters[f];
+
+                printf(" %8.2f", TimeRender(scaler, source, output, &params));
+            }
+            printf("\n");
+        }
+    }
+}
+
+/**
+ * 정수 배율 최근접: 픽셀 반복 대 위치 테이블 (256x256 타일 하나, 마이크로초)
+ * 위치 테이블 경로는 배율을 0.2% 어긋나게 해서 반복 검출을 피한다 (읽는 양은 같음).
+ */
+static void BenchReplicate(Scaler* scaler, const PixelBuffer* source)
+{
+    static const int factors[] = {2, 3, 4, 8};
+
+    PixelBuffer tile;
+    if (!PixelBuffer_Alloc(&tile, TILE_PIXELS, TILE_PIXELS)) {
+        printf("out of memory\n");
+        return;
+    }
+
+    printf("== replicate: %dx%d tile, us/tile, replicate vs gather ==\n", TILE_PIXELS, TILE_PIXELS);
+    printf("%-7s %6s %10s %10s\n", "isa", "factor", "replicate", "gather");
+
+    for (int isa = 1; isa < 3; isa++) {
+        Scaler_SetIsa(scaler, (ScalerIsa)isa);
+        if (Scaler_GetIsa(scaler) != (ScalerIsa)isa) {
+            continue;  // 이 CPU가 지원하지 않음 (스칼라는 항상 위치 테이블)
+        }
+
+        for (int f = 0; f < 4; f++) {
+            double us[2];
+            for (int path = 0; path < 2; path++) {
+                ScaleParams params;
+                memset(&params, 0, sizeof(params));
+                params.srcWidth = (float)TILE_PIXELS / factors[f] * (path == 0 ? 1.0f : 1.002f);
+                params.srcHeight = params.srcWidth;
+                params.srcX = OUTPUT_WIDTH / 2.0f;
+                params.srcY = OUTPUT_HEIGHT / 2.0f;
+                params.outputWidth = TILE_PIXELS;
+                params.outputHeight = TILE_PIXELS;
+                params.filter = SCALE_FILTER_NEAREST;
+
+                // 타일 하나는 짧으므로 100배 반복
+                int repeats = g_repeats;
+                g_repeats *= 100;
+                us[path] = TimeRender(scaler, source, &tile, &params) * 1000.0;
+                g_repeats = repeats;
+            }
+            printf("%-7s %5dx %10.1f %10.1f\n", g_isaNames[isa], factors[f], us[0], us[1]);
+        }
+    }
+
+    PixelBuffer_Free(&tile);
+}
+
+/**
+ * 밴드 병렬 확대 (가장 빠른 명령어 집합, 4K 출력, 200%)
+ * 속도 향상은 한 스레드 대비, 밴드 시간은 가장 빠른/느린 밴드 (차이가 크면 분배가 고르지 않음)
+ */
+static void BenchThreads(Scaler* scaler, const PixelBuffer* source, const PixelBuffer* output)
+{
+    static const int threadCounts[] = {1, 2, 4, 8};
+    static const ScaleFilter filters[] = {SCALE_FILTER_BILINEAR, SCALE_FILTER_LANCZOS3};
+
+    Scaler_SetIsa(scaler, Scaler_DetectIsa());
+    printf("== threads: %dx%d output at 200%%, %s, %d logical cores ==\n",
+           OUTPUT_WIDTH, OUTPUT_HEIGHT, g_isaNames[Scaler_GetIsa(scaler)], WorkerPool_GetCpuCount());
+    printf("%-10s %7s %10s %8s %6s %10s %10s\n", "filter", "threads", "wall ms", "speedup", "bands",
+           "fastest", "slowest");
+
+    for (int f = 0; f < 2; f++) {
+        double singleMs = 0.0;
+        for (int t = 0; t < 4; t++) {
+            WorkerPool* pool = WorkerPool_Create(threadCounts[t]);
+            if (!pool) {
+                printf("could not create %d threads\n", threadCounts[t]);
+                continue;
+            }
+            Scaler_SetWorkers(scaler, pool);
+
+            ScaleParams params;
+            memset(&params, 0, sizeof(params));
+            params.srcX = OUTPUT_WIDTH / 4.0f;
+            params.srcY = OUTPUT_HEIGHT / 4.0f;
+            params.srcWidth = OUTPUT_WIDTH / 2.0f;
+            params.srcHeight = OUTPUT_HEIGHT / 2.0f;
+            params.outputWidth = OUTPUT_WIDTH;
+            params.outputHeight = OUTPUT_HEIGHT;
+            params.filter = filters[f];
+
+            double ms = TimeRender(scaler, source, output, &params);
+            if (t == 0) singleMs = ms;
+
+            // 마지막 렌더의 밴드별 시간 (한 스레드면 밴드 통계가 갱신되지 않으므로 비움)
+            ScalerBandStats stats;
+            Scaler_GetBandStats(scaler, &stats);
+            if (threadCounts[t] == 1) {
+                stats.bands = 0;
+            }
+            double fastest = 0.0, slowest = 0.0;
+            for (int i = 0; i < stats.bands; i++) {
+                if (i == 0 || stats.bandMs[i] < fastest) fastest = stats.bandMs[i];
+                if (stats.bandMs[i] > slowest) slowest = stats.bandMs[i];
+            }
+            printf("%-10s %7d %10.2f %7.2fx %6d %10.2f %10.2f\n", g_filterNames[filters[f]], threadCounts[t],
+                   ms, singleMs / ms, stats.bands > 1 ? stats.bands : 1, fastest, slowest);
+
+            Scaler_SetWorkers(scaler, NULL);
+            WorkerPool_Destroy(pool);
+        }
+    }
+}
+
+/**
+ * 색 필터별 확대 (4K 출력, 200% 바이리니어, 명령어 집합별)
+ * 추가 비용은 같은 명령어 집합의 색 필터 없는 확대 대비
+ */
+static void BenchColor(Scaler* scaler, const PixelBuffer* source, const PixelBuffer* output)
+{
+    static const char* colorNames[] = {"none", "invert", "grayscale", "contrast", "deutan"};
+
+    printf("== color: %dx%d output at 200%%, bilinear, one thread ==\n", OUTPUT_WIDTH, OUTPUT_HEIGHT);
+    printf("%-10s %-7s %10s %10s\n", "color", "isa", "ms/frame", "overhead");
+    Scaler_SetWorkers(scaler, NULL);
+
+    for (int isa = 0; isa < 3; isa++) {
+        Scaler_SetIsa(scaler, (ScalerIsa)isa);
+        if (Scaler_GetIsa(scaler) != (ScalerIsa)isa) {
+            continue;  // 이 CPU가 지원하지 않음
+        }
+
+        double noneMs = 0.0;
+        for (int color = 0; color < 5; color++) {
+            ScaleParams params;
+            memset(&params, 0, sizeof(params));
+            params.srcX = OUTPUT_WIDTH / 4.0f;
+            params.srcY = OUTPUT_HEIGHT / 4.0f;
+            params.srcWidth = OUTPUT_WIDTH / 2.0f;
+            params.srcHeight = OUTPUT_HEIGHT / 2.0f;
+            params.outputWidth = OUTPUT_WIDTH;
+            params.outputHeight = OUTPUT_HEIGHT;
+            params.filter = SCALE_FILTER_BILINEAR;
+            params.color = (ColorFilter)color;
+
+            double ms = TimeRender(scaler, source, output, &params);
+            if (color == COLOR_FILTER_NONE) noneMs = ms;
+            printf("%-10s %-7s %10.2f %9.0f%%\n", colorNames[color], g_isaNames[isa], ms,
+                   100.0 * (ms - noneMs) / noneMs);
+        }
+    }
+}
+
+/**
+ * 선형 광량 보간 (4K 출력, 200%, 명령어 집합별 바이리니어/Lanczos-3)
+ * 추가 비용은 같은 필터/명령어 집합의 sRGB 보간 대비
+ */
+static void BenchLinear(Scaler* scaler, const PixelBuffer* source, const PixelBuffer* output)
+{
+    static const ScaleFilter filters[] = {SCALE_FILTER_BILINEAR, SCALE_FILTER_LANCZOS3};
+
+    printf("== linear: %dx%d output at 200%%, one thread ==\n", OUTPUT_WIDTH, OUTPUT_HEIGHT);
+    printf("%-10s %-7s %10s %10s %10s\n", "filter", "isa", "srgb ms", "linear ms", "overhead");
+    Scaler_SetWorkers(scaler, NULL);
+
+    for (int f = 0; f < 2; f++) {
+        for (int isa = 0; isa < 3; isa++) {
+            Scaler_SetIsa(scaler, (ScalerIsa)isa);
+            if (Scaler_GetIsa(scaler) != (ScalerIsa)isa) {
+                continue;  // 이 CPU가 지원하지 않음
+            }
+
+            ScaleParams params;
+            memset(&params, 0, sizeof(params));
+            params.srcX = OUTPUT_WIDTH / 4.0f;
+            params.srcY = OUTPUT_HEIGHT / 4.0f;
+            params.srcWidth = OUTPUT_WIDTH / 2.0f;
+            params.srcHeight = OUTPUT_HEIGHT / 2.0f;
+            params.outputWidth = OUTPUT_WIDTH;
+            params.outputHeight = OUTPUT_HEIGHT;
+            params.filter = filters[f];
+
+            double srgbMs = TimeRender(scaler, source, output, &params);
+            params.linearLight = true;
+            double linearMs = TimeRender(scaler, source, output, &params);
+            printf("%-10s %-7s %10.2f %10.2f %9.0f%%\n", g_filterNames[filters[f]], g_isaNames[isa],
+                   srgbMs, linearMs, 100.0 * (linearMs - srgbMs) / srgbMs);
+        }
+    }
+}
+
+/**
+ * 4K 프레임 전체의 타일 해시 (명령어 집합별, 내용이 같아도 모든 타일을 해시하므로 프레임마다 드는 비용)
+ * 비율은 같은 명령어 집합으로 4K 출력을 200% 바이리니어 확대하는 시간 대비
+ */
+static void BenchHash(Scaler* scaler, const PixelBuffer* source, const PixelBuffer* output)
+{
+    printf("== hash: %dx%d frame in %dx%d tiles, one thread ==\n",
+           OUTPUT_WIDTH, OUTPUT_HEIGHT, TILE_HASH_SIZE, TILE_HASH_SIZE);
+    printf("%-7s %10s %10s %10s\n", "isa", "ms/frame", "GB/s", "vs render");
+
+    TileHasher* hasher = TileHasher_Create(OUTPUT_WIDTH, OUTPUT_HEIGHT);
+    if (!hasher) {
+        printf("out of memory\n");
+        return;
+    }
+    Scaler_SetWorkers(scaler, NULL);
+
+    FrameRect bounds = {0, 0, source->width, source->height};
+    for (int isa = 0; isa < 3; isa++) {
+        Scaler_SetIsa(scaler, (ScalerIsa)isa);
+        if (Scaler_GetIsa(scaler) != (ScalerIsa)isa) {
+            continue;  // 이 CPU가 지원하지 않음
+        }
+        TileHasher_SetIsa(hasher, (ScalerIsa)isa);
+
+        const FrameRect* changed;
+        TileHasher_Update(hasher, source, &bounds, &changed);
+        double start = WorkerPool_NowMs();
+        for (int i = 0; i < g_repeats; i++) {
+            TileHasher_Update(hasher, source, &bounds, &changed);
+        }
+        double ms = (WorkerPool_NowMs() - start) / g_repeats;
+
+        ScaleParams params;
+        memset(&params, 0, sizeof(params));
+        params.srcX = OUTPUT_WIDTH / 4.0f;
+        params.srcY = OUTPUT_HEIGHT / 4.0f;
+        params.srcWidth = OUTPUT_WIDTH / 2.0f;
+        params.srcHeight = OUTPUT_HEIGHT / 2.0f;
+        params.outputWidth = OUTPUT_WIDTH;
+        params.outputHeight = OUTPUT_HEIGHT;
+        params.filter = SCALE_FILTER_BILINEAR;
+        double renderMs = TimeRender(scaler, source, output, &params);
+
+        printf("%-7s %10.2f %10.2f %9.0f%%\n", g_isaNames[isa], ms,
+               (double)source->width * source->height * 4 / (ms * 1e6), 100.0 * ms / renderMs);
+    }
+
+    TileHasher_Destroy(hasher);
+}
+
+/**
+ * 4K 정지 화면 압축/풀기 (합성 화면과 압축이 안 되는 잡음)
+ * 프레임 비율은 60Hz 한 프레임(16.7ms) 대비 풀기 시간
+ */
+static void BenchSnapshot(const PixelBuffer* noise, const PixelBuffer* output)
+{
+    static const char* contentNames[] = {"screen", "noise"};
+    const double frameMs = 1000.0 / 60.0;
+
+    PixelBuffer screen;
+    size_t bound = SnapshotCodec_Bound(OUTPUT_WIDTH, OUTPUT_HEIGHT);
+    uint8_t* packed = (uint8_t*)malloc(bound);
+    if (!packed || !TestImage_Create(&screen, OUTPUT_WIDTH, OUTPUT_HEIGHT, 1)) {
+        printf("out of memory\n");
+        free(packed);
+        return;
+    }
+
+    printf("== snapshot: %dx%d frame, one thread ==\n", OUTPUT_WIDTH, OUTPUT_HEIGHT);
+    printf("%-7s %10s %10s %8s %8s\n", "content", "encode ms", "decode ms", "frame", "ratio");
+
+    const PixelBuffer* images[] = {&screen, noise};
+    for (int c = 0; c < 2; c++) {
+        double start = WorkerPool_NowMs();
+        size_t size = 0;
+        for (int i = 0; i < g_repeats; i++) {
+            size = SnapshotCodec_Encode(images[c], packed, bound);
+        }
+        double encodeMs = (WorkerPool_NowMs() - start) / g_repeats;
+
+        // 처음 쓰는 페이지 비용은 빼고 (기록은 꺼내기 버퍼를 미리 채워 둠)
+        SnapshotCodec_Decode(packed, size, output);
+        start = WorkerPool_NowMs();
+        for (int i = 0; i < g_repeats; i++) {
+            SnapshotCodec_Decode(packed, size, output);
+        }
+        double decodeMs = (WorkerPool_NowMs() - start) / g_repeats;
+
+        printf("%-7s %10.2f %10.2f %7.1f%% %7.1f:1\n", contentNames[c], encodeMs, decodeMs,
+               100.0 * decodeMs / frameMs, (double)OUTPUT_WIDTH * OUTPUT_HEIGHT * 4 / (double)size);
+    }
+
+    free(packed);
+    PixelBuffer_Free(&screen);
+}
+
+/**
+ * 스포트라이트 마스크 (4K 레이어, 명령어 집합별 원/둥근 사각형)
+ * full은 레이어 전체, move는 커서가 12픽셀 움직였을 때 다시 그리는 직전/새 영역의 합
+ * 프레임 비율은 60Hz 한 프레임(16.7ms) 대비
+ */
+static void BenchSpotlight(const PixelBuffer* layer)
+{
+    static const char* shapeNames[] = {"circle", "rect"};
+    static const SpotlightShape shapes[] = {
+        {OUTPUT_WIDTH / 2.0f, OUTPUT_HEIGHT / 2.0f, 0.0f, 0.0f, 200.0f, 60.0f, 160},
+        {OUTPUT_WIDTH / 2.0f, OUTPUT_HEIGHT / 2.0f, 300.0f, 150.0f, 24.0f, 40.0f, 160}
+    };
+    const double frameMs = 1000.0 / 60.0;
+
+    printf("== spotlight: %dx%d layer, one thread ==\n", OUTPUT_WIDTH, OUTPUT_HEIGHT);
+    printf("%-7s %-7s %10s %8s %10s %8s\n", "shape", "isa", "full ms", "frame", "move ms", "frame");
+
+    for (int s = 0; s < 2; s++) {
+        for (int isa = 0; isa <= (int)Scaler_DetectIsa(); isa++) {
+            FrameRect all = {0, 0, layer->width, layer->height};
+            Spotlight_Render((ScalerIsa)isa, layer, &shapes[s], &all);
+            double start = WorkerPool_NowMs();
+            for (int i = 0; i < g_repeats; i++) {
+                Spotlight_Render((ScalerIsa)isa, layer, &shapes[s], &all);
+            }
+            double fullMs = (WorkerPool_NowMs() - start) / g_repeats;
+
+            // 왼쪽 위/오른쪽 아래로 번갈아 움직이며 두 영역의 합만 다시 그림
+            SpotlightShape moved = shapes[s];
+            start = WorkerPool_NowMs();
+            for (int i = 0; i < g_repeats; i++) {
+                FrameRect before, after, dirty;
+                Spotlight_GetBounds(&moved, layer->width, layer->height, &before);
+                moved.centerX += i % 2 ? -12.0f : 12.0f;
+                moved.centerY += i % 2 ? -12.0f : 12.0f;
+                Spotlight_GetBounds(&moved, layer->width, layer->height, &after);
+                dirty.left = before.left < after.left ? before.left : after.left;
+                dirty.top = before.top < after.top ? before.top : after.top;
+                dirty.right = before.right > after.right ? before.right : after.right;
+                dirty.bottom = before.bottom > after.bottom ? before.bottom : after.bottom;
+                Spotlight_Render((ScalerIsa)isa, layer, &moved, &dirty);
+            }
+            double moveMs = (WorkerPool_NowMs() - start) / g_repeats;
+
+            printf("%-7s %-7s %10.3f %7.1f%% %10.3f %7.1f%%\n", shapeNames[s], g_isaNames[isa],
+                   fullMs, 100.0 * fullMs / frameMs, moveMs, 100.0 * moveMs / frameMs);
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const char* section = argc > 1 ? argv[1] : "all";
+    if (argc > 2) {
+        g_repeats = atoi(argv[2]) > 0 ? atoi(argv[2]) : g_repeats;
+    }
+    bool all = strcmp(section, "all") == 0;
+
+    PixelBuffer source, output;
+    Scaler* scaler = Scaler_Create();
+    if (!scaler || !TestImage_CreateNoise(&source, OUTPUT_WIDTH, OUTPUT_HEIGHT, 7) ||
+        !PixelBuffer_Alloc(&output, OUTPUT_WIDTH, OUTPUT_HEIGHT)) {
+        printf("out of memory\n");
+        return 1;
+    }
+
+    printf("best instruction set: %s\n", g_isaNames[Scaler_DetectIsa()]);
+    if (all || strcmp(section, "filters") == 0) {
+        BenchFilters(scaler, &source, &output);
+    }
+    if (all || strcmp(section, "zoom") == 0) {
+        BenchZoom(scaler, &source, &output);
+    }
+    if (all || strcmp(section, "replicate") == 0) {
+        BenchReplicate(scaler, &source);
+    }
+    if (all || strcmp(section, "threads") == 0) {
+        BenchThreads(scaler, &source, &output);
+    }
+    if (all || strcmp(section, "color") == 0) {
+        BenchColor(scaler, &source, &output);
+    }
+    if (all || strcmp(section, "linear") == 0) {
+        BenchLinear(scaler, &source, &output);
+    }
+    if (all || strcmp(section, "hash") == 0) {
+        BenchHash(scaler, &source, &output);
+    }
+    if (all || strcmp(section, "snapshot") == 0) {
+        BenchSnapshot(&source, &output);
+    }
+    if (all || strcmp(section, "spotlight") == 0) {
+        BenchSpotlight(&output);
+    }
+
+    Scaler_Destroy(scaler);
+    PixelBuffer_Free(&output);
+    PixelBuffer_Free(&source);
+    return 0;
+}
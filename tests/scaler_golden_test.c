@@ -0,0 +1,488 @@
+/**
+ * scaler_golden_test.c - 확대 엔진 기준 이미지 테스트
+ *
+ * 합성 화면을 필터/배율별로 확대해 저장해 둔 기준 이미지(tests/golden 폴더의 .pam)와 비트 단위로 비교한다.
+ * 이 CPU가 지원하는 명령어 집합(스칼라/SSE2/AVX2)마다 전체 출력과 부분 영역(밴드/타일) 출력을 모두 검사하고,
+ * 색 필터는 채널 값 조합(0/255 포화 포함)을 실수 행렬 결과와 비교하고,
+ * 선형 광량 보간의 알파가 감마 없이 보간되는지 확인하고,
+ * 무작위 매개변수로 명령어 집합끼리의 결과도 비교한다.
+ *
+ * 사용법: scaler_golden_test <기준 이미지 폴더> [--update]
+ * --update는 스칼라 커널의 결과로 기준 이미지를 다시 쓴다 (확대 결과를 의도적으로 바꿨을 때만).
+ */
+
+#include "scaler.h"
+#include "test_image.h"
+#include <stdio.h>
+#include <string.h>
+
+// 기준 이미지의 원본 (바꾸면 기준 이미지를 모두 다시 만들어야 함)
+#define SOURCE_WIDTH 40
+#define SOURCE_HEIGHT 24
+#define SOURCE_SEED 1
+
+// 무작위 교차 검증 횟수
+#define RANDOM_CASES 300
+
+// 색 필터 극값 검사의 채널 값 (0/255 포화와 중간 회색 주변)
+static const uint8_t g_levels[] = {0, 1, 2, 64, 127, 128, 129, 192, 253, 254, 255};
+#define LEVEL_COUNT (int)(sizeof(g_levels) / sizeof(g_levels[0]))
+
+// 색 필터 결과와 실수 행렬 결과의 허용 차이 (고정소수점 계수 반올림)
+#define COLOR_TOLERANCE 1
+
+typedef struct {
+    const char* name;           // 기준 이미지 파일 이름 (.pam 제외)
+    ScaleFilter filter;
+    float srcX, srcY, srcWidth, srcHeight;
+    int outputWidth, outputHeight;
+    ColorFilter color;
+    bool linearLight;
+} GoldenCase;
+
+static const GoldenCase g_cases[] = {
+    // 정수 배율 (원본 전체)
+    {"nearest_2x",   SCALE_FILTER_NEAREST,  0.0f, 0.0f, 40.0f, 24.0f, 80, 48, COLOR_FILTER_NONE, false},
+    {"bilinear_2x",  SCALE_FILTER_BILINEAR, 0.0f, 0.0f, 40.0f, 24.0f, 80, 48, COLOR_FILTER_NONE, false},
+    {"bicubic_2x",   SCALE_FILTER_BICUBIC,  0.0f, 0.0f, 40.0f, 24.0f, 80, 48, COLOR_FILTER_NONE, false},
+    {"lanczos3_2x",  SCALE_FILTER_LANCZOS3, 0.0f, 0.0f, 40.0f, 24.0f, 80, 48, COLOR_FILTER_NONE, false},
+
+    // 소수 배율 + 서브픽셀 위치 (가장자리 탭이 원본 밖으로 나가는 경우 포함)
+    {"nearest_frac",  SCALE_FILTER_NEAREST,  3.25f, 2.5f, 21.5f, 13.75f, 86, 55, COLOR_FILTER_NONE, false},
+    {"bilinear_frac", SCALE_FILTER_BILINEAR, 3.25f, 2.5f, 21.5f, 13.75f, 86, 55, COLOR_FILTER_NONE, false},
+    {"bicubic_frac",  SCALE_FILTER_BICUBIC,  3.25f, 2.5f, 21.5f, 13.75f, 86, 55, COLOR_FILTER_NONE, false},
+    {"lanczos3_frac", SCALE_FILTER_LANCZOS3, 3.25f, 2.5f, 21.5f, 13.75f, 86, 55, COLOR_FILTER_NONE, false},
+
+    // 색 필터 (소스 픽셀에 적용 후 보간, 대비 강조/색약 보정은 채널이 0/255로 포화되는 경우 포함)
+    {"nearest_frac_invert",         SCALE_FILTER_NEAREST,  3.25f, 2.5f, 21.5f, 13.75f, 86, 55, COLOR_FILTER_INVERT, false},
+    {"bilinear_2x_grayscale",       SCALE_FILTER_BILINEAR, 0.0f, 0.0f, 40.0f, 24.0f, 80, 48, COLOR_FILTER_GRAYSCALE, false},
+    {"bicubic_frac_contrast",       SCALE_FILTER_BICUBIC,  3.25f, 2.5f, 21.5f, 13.75f, 86, 55, COLOR_FILTER_HIGH_CONTRAST, false},
+    {"lanczos3_frac_deuteranopia",  SCALE_FILTER_LANCZOS3, 3.25f, 2.5f, 21.5f, 13.75f, 86, 55, COLOR_FILTER_DEUTERANOPIA, false},
+
+    // 선형 광량 보간 (감마를 푼 뒤 보간, 알파는 감마 없이 비례)
+    {"bilinear_frac_linear",        SCALE_FILTER_BILINEAR, 3.25f, 2.5f, 21.5f, 13.75f, 86, 55, COLOR_FILTER_NONE, true},
+    {"bicubic_2x_linear",           SCALE_FILTER_BICUBIC,  0.0f, 0.0f, 40.0f, 24.0f, 80, 48, COLOR_FILTER_NONE, true},
+    {"lanczos3_frac_linear",        SCALE_FILTER_LANCZOS3, 3.25f, 2.5f, 21.5f, 13.75f, 86, 55, COLOR_FILTER_NONE, true},
+    {"bilinear_frac_invert_linear", SCALE_FILTER_BILINEAR, 3.25f, 2.5f, 21.5f, 13.75f, 86, 55, COLOR_FILTER_INVERT, true},
+};
+
+static const char* g_isaNames[] = {"scalar", "sse2", "avx2"};
+static const char* g_filterNames[] = {"nearest", "bilinear", "bicubic", "lanczos3"};
+
+/**
+ * 기준 이미지 경로
+ */
+static void GoldenPath(char* path, size_t size, const char* directory, const char* name)
+{
+    snprintf(path, size, "%s/%s.pam", directory, name);
+}
+
+/**
+ * 매개변수 채우기
+ */
+static ScaleParams CaseParams(const GoldenCase* test)
+{
+    ScaleParams params;
+    memset(&params, 0, sizeof(params));
+    params.srcX = test->srcX;
+    params.srcY = test->srcY;
+    params.srcWidth = test->srcWidth;
+    params.srcHeight = test->srcHeight;
+    params.outputWidth = test->outputWidth;
+    params.outputHeight = test->outputHeight;
+    params.filter = test->filter;
+    params.color = test->color;
+    params.linearLight = test->linearLight;
+    return params;
+}
+
+/**
+ * 한 명령어 집합으로 기준 이미지 검사 (전체 출력과 가운데 부분 영역)
+ */
+static int CheckCase(Scaler* scaler, const PixelBuffer* source, const PixelBuffer* golden,
+                     const GoldenCase* test, ScalerIsa isa)
+{
+    ScaleParams params = CaseParams(test);
+    int failures = 0;
+    int diffX, diffY;
+
+    PixelBuffer output;
+    if (!PixelBuffer_Alloc(&output, test->outputWidth, test->outputHeight) ||
+        !Scaler_Render(scaler, source, &output, &params)) {
+        printf("FAIL %s [%s]: render failed\n", test->name, g_isaNames[isa]);
+        PixelBuffer_Free(&output);
+        return 1;
+    }
+    if (!TestImage_Equal(&output, golden, &diffX, &diffY)) {
+        printf("FAIL %s [%s]: differs from golden at (%d, %d)\n", test->name, g_isaNames[isa], diffX, diffY);
+        failures++;
+    }
+    PixelBuffer_Free(&output);
+
+    // 부분 영역: 출력 좌표 (7, 5)부터 (밴드/타일 렌더링과 같은 경로)
+    int left = 7, top = 5;
+    PixelBuffer part;
+    PixelBuffer expected = PixelBuffer_SubView(golden, left, top,
+                                               test->outputWidth - 2 * left, test->outputHeight - 2 * top);
+    params.dstOffsetX = left;
+    params.dstOffsetY = top;
+    if (!PixelBuffer_Alloc(&part, expected.width, expected.height) ||
+        !Scaler_Render(scaler, source, &part, &params)) {
+        printf("FAIL %s [%s]: partial render failed\n", test->name, g_isaNames[isa]);
+        failures++;
+    } else if (!TestImage_Equal(&part, &expected, &diffX, &diffY)) {
+        printf("FAIL %s [%s]: partial render differs at (%d, %d)\n", test->name, g_isaNames[isa],
+               left + diffX, top + diffY);
+        failures++;
+    }
+    PixelBuffer_Free(&part);
+
+    if (failures == 0) {
+        printf("ok   %s [%s]\n", test->name, g_isaNames[isa]);
+    }
+    return failures;
+}
+
+/**
+ * 기준 이미지 다시 쓰기 (스칼라 커널)
+ */
+static int UpdateGoldens(Scaler* scaler, const PixelBuffer* source, const char* directory)
+{
+    Scaler_SetIsa(scaler, SCALER_ISA_SCALAR);
+
+    int failures = 0;
+    for (size_t i = 0; i < sizeof(g_cases) / sizeof(g_cases[0]); i++) {
+        const GoldenCase* test = &g_cases[i];
+        ScaleParams params = CaseParams(test);
+        char path[512];
+        GoldenPath(path, sizeof(path), directory, test->name);
+
+        PixelBuffer output;
+        if (!PixelBuffer_Alloc(&output, test->outputWidth, test->outputHeight) ||
+            !Scaler_Render(scaler, source, &output, &params) || !TestImage_Save(path, &output)) {
+            printf("FAIL %s: could not write %s\n", test->name, path);
+            failures++;
+        } else {
+            printf("wrote %s\n", path);
+        }
+        PixelBuffer_Free(&output);
+    }
+    return failures;
+}
+
+/**
+ * 채널을 0/255 근처로 몰기 (색 필터가 범위를 넘겨 잘리는 경우를 자주 만들기 위해)
+ */
+static void SaturateChannels(const PixelBuffer* image)
+{
+    for (int y = 0; y < image->height; y++) {
+        uint8_t* px = (uint8_t*)PixelBuffer_Row(image, y);
+        for (int i = 0; i < image->width * 4; i++) {
+            if (px[i] < 64) px[i] = 0;
+            else if (px[i] >= 192) px[i] = 255;
+        }
+    }
+}
+
+/**
+ * 색 필터 극값: 채널 값 조합을 모두 담은 소스를 1:1로 확대해
+ * 실수 행렬로 계산한 결과(0~255로 자름)와 허용 차이 안인지, 명령어 집합끼리 같은지 확인
+ */
+static int CheckColorExtremes(Scaler* scalers[3], bool supported[3])
+{
+    static const char* colorNames[] = {"none", "invert", "grayscale", "high contrast", "deuteranopia"};
+    int width = LEVEL_COUNT * LEVEL_COUNT;
+    int height = LEVEL_COUNT;
+
+    PixelBuffer source;
+    if (!PixelBuffer_Alloc(&source, width, height)) {
+        return 1;
+    }
+    uint32_t state = 31337;
+    for (int y = 0; y < height; y++) {
+        uint8_t* px = (uint8_t*)PixelBuffer_Row(&source, y);
+        for (int x = 0; x < width; x++) {
+            px[x * 4 + 0] = g_levels[x % LEVEL_COUNT];
+            px[x * 4 + 1] = g_levels[x / LEVEL_COUNT];
+            px[x * 4 + 2] = g_levels[y];
+            px[x * 4 + 3] = (uint8_t)TestImage_Random(&state);
+        }
+    }
+
+    int failures = 0;
+    for (int color = COLOR_FILTER_INVERT; color <= COLOR_FILTER_DEUTERANOPIA; color++) {
+        ScaleParams params;
+        memset(&params, 0, sizeof(params));
+        params.srcWidth = (float)width;
+        params.srcHeight = (float)height;
+        params.outputWidth = width;
+        params.outputHeight = height;
+        params.filter = SCALE_FILTER_NEAREST;
+        params.color = (ColorFilter)color;
+
+        float m[3][4];
+        Scaler_GetColorMatrix((ColorFilter)color, m);
+        int previous = failures;
+
+        PixelBuffer outputs[3] = {{0}};
+        for (int isa = 0; isa < 3; isa++) {
+            if (!supported[isa]) continue;
+            if (!PixelBuffer_Alloc(&outputs[isa], width, height) ||
+                !Scaler_Render(scalers[isa], &source, &outputs[isa], &params)) {
+                printf("FAIL %s extremes [%s]: render failed\n", colorNames[color], g_isaNames[isa]);
+                failures++;
+                continue;
+            }
+
+            bool same = true;
+            int diffX, diffY;
+            if (isa > 0 && outputs[0].pixels && !TestImage_Equal(&outputs[0], &outputs[isa], &diffX, &diffY)) {
+                printf("FAIL %s extremes [%s]: differs from scalar at (%d, %d)\n",
+                       colorNames[color], g_isaNames[isa], diffX, diffY);
+                same = false;
+            }
+            for (int y = 0; y < height && same; y++) {
+                const uint8_t* in = (const uint8_t*)PixelBuffer_Row(&source, y);
+                const uint8_t* out = (const uint8_t*)PixelBuffer_Row(&outputs[isa], y);
+                for (int x = 0; x < width && same; x++) {
+                    const uint8_t* p = in + x * 4;
+                    const uint8_t* q = out + x * 4;
+                    for (int c = 0; c < 3 && same; c++) {
+                        // 행렬은 RGB 순서, 픽셀은 BGRA
+                        const float* row = m[2 - c];
+                        float value = (row[0] * p[2] + row[1] * p[1] + row[2] * p[0] + row[3] * 255.0f);
+                        int expected = (int)(value < 0.0f ? 0.0f : value > 255.0f ? 255.0f : value + 0.5f);
+                        int diff = q[c] - expected;
+                        if (diff > COLOR_TOLERANCE || diff < -COLOR_TOLERANCE) {
+                            printf("FAIL %s extremes [%s]: BGR (%d, %d, %d) channel %d is %d, expected %d\n",
+                                   colorNames[color], g_isaNames[isa], p[0], p[1], p[2], c, q[c], expected);
+                            same = false;
+                        }
+                    }
+                    if (same && q[3] != p[3]) {
+                        printf("FAIL %s extremes [%s]: alpha changed at (%d, %d)\n",
+                               colorNames[color], g_isaNames[isa], x, y);
+                        same = false;
+                    }
+                }
+            }
+            failures += same ? 0 : 1;
+        }
+
+        if (failures == previous) {
+            printf("ok   %s on %d saturated/mid-grey colours\n", colorNames[color], width * height);
+        }
+        for (int isa = 0; isa < 3; isa++) {
+            PixelBuffer_Free(&outputs[isa]);
+        }
+    }
+
+    PixelBuffer_Free(&source);
+    return failures;
+}
+
+/**
+ * 선형 광량 보간의 알파: 감마 없이 보간해야 하므로 sRGB 보간의 알파와 (반올림 차이 안에서) 같아야 함
+ * 알파가 0/255로 번갈아 바뀌는 소스를 써서 감마를 거치면 중간 값이 크게 달라지도록 한다.
+ */
+static int CheckLinearAlpha(Scaler* scalers[3], bool supported[3])
+{
+    static const ScaleFilter filters[] = {SCALE_FILTER_BILINEAR, SCALE_FILTER_BICUBIC, SCALE_FILTER_LANCZOS3};
+    PixelBuffer source;
+    if (!TestImage_CreateNoise(&source, 37, 21, 77)) {
+        return 1;
+    }
+    for (int y = 0; y < source.height; y++) {
+        uint8_t* px = (uint8_t*)PixelBuffer_Row(&source, y);
+        for (int x = 0; x < source.width; x++) {
+            px[x * 4 + 3] = (x + y) % 2 ? 255 : 0;
+        }
+    }
+
+    int failures = 0;
+    for (int f = 0; f < 3; f++) {
+        ScaleParams params;
+        memset(&params, 0, sizeof(params));
+        params.srcX = 0.3f;
+        params.srcY = 0.6f;
+        params.srcWidth = source.width / 2.7f;
+        params.srcHeight = source.height / 2.7f;
+        params.outputWidth = 101;
+        params.outputHeight = 57;
+        params.filter = filters[f];
+
+        for (int isa = 0; isa < 3; isa++) {
+            if (!supported[isa]) continue;
+
+            PixelBuffer srgb, linear;
+            params.linearLight = false;
+            bool rendered = PixelBuffer_Alloc(&srgb, params.outputWidth, params.outputHeight) &&
+                            Scaler_Render(scalers[isa], &source, &srgb, &params);
+            params.linearLight = true;
+            rendered = rendered && PixelBuffer_Alloc(&linear, params.outputWidth, params.outputHeight) &&
+                       Scaler_Render(scalers[isa], &source, &linear, &params);
+            if (!rendered) {
+                printf("FAIL linear alpha %s [%s]: render failed\n", g_filterNames[filters[f]], g_isaNames[isa]);
+                failures++;
+            }
+
+            bool same = rendered;
+            for (int y = 0; y < params.outputHeight && same; y++) {
+                const uint8_t* a = (const uint8_t*)PixelBuffer_Row(&srgb, y);
+                const uint8_t* b = (const uint8_t*)PixelBuffer_Row(&linear, y);
+                for (int x = 0; x < params.outputWidth && same; x++) {
+                    int diff = a[x * 4 + 3] - b[x * 4 + 3];
+                    if (diff > 1 || diff < -1) {
+                        printf("FAIL linear alpha %s [%s]: alpha %d at (%d, %d), %d without linear light\n",
+                               g_filterNames[filters[f]], g_isaNames[isa], b[x * 4 + 3], x, y, a[x * 4 + 3]);
+                        same = false;
+                        failures++;
+                    }
+                }
+            }
+            PixelBuffer_Free(&srgb);
+            PixelBuffer_Free(&linear);
+        }
+    }
+
+    if (failures == 0) {
+        printf("ok   linear light interpolates alpha without gamma\n");
+    }
+    PixelBuffer_Free(&source);
+    return failures;
+}
+
+/**
+ * 무작위 매개변수로 명령어 집합끼리 비교 (기준은 스칼라)
+ * 색 필터와 선형 광량 보간도 무작위로 고르고, 네 번에 한 번은 채널을 0/255 근처로 몬 소스를 쓴다.
+ */
+static int CheckRandom(Scaler* scalers[3], bool supported[3])
+{
+    uint32_t state = 12345;
+    int failures = 0;
+
+    for (int i = 0; i < RANDOM_CASES; i++) {
+        int sourceWidth = 1 + (int)(TestImage_Random(&state) % 80);
+        int sourceHeight = 1 + (int)(TestImage_Random(&state) % 80);
+        PixelBuffer source;
+        if (!TestImage_CreateNoise(&source, sourceWidth, sourceHeight, TestImage_Random(&state))) {
+            return failures + 1;
+        }
+        if (i % 4 == 0) {
+            SaturateChannels(&source);
+        }
+
+        ScaleParams params;
+        memset(&params, 0, sizeof(params));
+        params.srcWidth = 0.5f + (float)(TestImage_Random(&state) % 1000) / 1000.0f * sourceWidth;
+        params.srcHeight = 0.5f + (float)(TestImage_Random(&state) % 1000) / 1000.0f * sourceHeight;
+        params.srcX = (float)(TestImage_Random(&state) % 1000) / 1000.0f * (sourceWidth - params.srcWidth + 0.01f);
+        params.srcY = (float)(TestImage_Random(&state) % 1000) / 1000.0f * (sourceHeight - params.srcHeight + 0.01f);
+        params.outputWidth = 1 + (int)(TestImage_Random(&state) % 200);
+        params.outputHeight = 1 + (int)(TestImage_Random(&state) % 200);
+        params.filter = (ScaleFilter)(TestImage_Random(&state) % 4);
+        params.color = (ColorFilter)(TestImage_Random(&state) % 5);
+        params.linearLight = TestImage_Random(&state) % 3 == 0;
+        params.dstOffsetX = (int)(TestImage_Random(&state) % (uint32_t)params.outputWidth);
+        params.dstOffsetY = (int)(TestImage_Random(&state) % (uint32_t)params.outputHeight);
+        int width = 1 + (int)(TestImage_Random(&state) % (uint32_t)(params.outputWidth - params.dstOffsetX));
+        int height = 1 + (int)(TestImage_Random(&state) % (uint32_t)(params.outputHeight - params.dstOffsetY));
+
+        PixelBuffer outputs[3] = {{0}};
+        for (int isa = 0; isa < 3; isa++) {
+            if (!supported[isa]) continue;
+            if (!PixelBuffer_Alloc(&outputs[isa], width, height) ||
+                !Scaler_Render(scalers[isa], &source, &outputs[isa], &params)) {
+                printf("FAIL random case %d [%s]: render failed\n", i, g_isaNames[isa]);
+                failures++;
+            }
+        }
+
+        int diffX, diffY;
+        for (int isa = 1; isa < 3; isa++) {
+            if (supported[isa] && outputs[isa].pixels && outputs[0].pixels &&
+                !TestImage_Equal(&outputs[0], &outputs[isa], &diffX, &diffY)) {
+                printf("FAIL random case %d [%s]: differs from scalar at (%d, %d), filter %d, color %d%s\n",
+                       i, g_isaNames[isa], diffX, diffY, (int)params.filter, (int)params.color,
+                       params.linearLight ? ", linear light" : "");
+                failures++;
+            }
+        }
+
+        for (int isa = 0; isa < 3; isa++) {
+            PixelBuffer_Free(&outputs[isa]);
+        }
+        PixelBuffer_Free(&source);
+    }
+
+    if (failures == 0) {
+        printf("ok   %d random cases match across instruction sets\n", RANDOM_CASES);
+    }
+    return failures;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        printf("usage: %s <golden directory> [--update]\n", argv[0]);
+        return 2;
+    }
+    const char* directory = argv[1];
+    bool update = argc > 2 && strcmp(argv[2], "--update") == 0;
+
+    PixelBuffer source;
+    if (!TestImage_Create(&source, SOURCE_WIDTH, SOURCE_HEIGHT, SOURCE_SEED)) {
+        printf("FAIL: could not create source image\n");
+        return 1;
+    }
+
+    // 명령어 집합마다 확대 엔진 하나 (지원하지 않으면 낮아지므로 건너뜀)
+    Scaler* scalers[3];
+    bool supported[3];
+    for (int isa = 0; isa < 3; isa++) {
+        scalers[isa] = Scaler_Create();
+        if (!scalers[isa]) {
+            printf("FAIL: could not create scaler\n");
+            return 1;
+        }
+        Scaler_SetIsa(scalers[isa], (ScalerIsa)isa);
+        supported[isa] = Scaler_GetIsa(scalers[isa]) == (ScalerIsa)isa;
+        if (!supported[isa]) {
+            printf("skip %s (not supported by this CPU)\n", g_isaNames[isa]);
+        }
+    }
+
+    int failures = 0;
+    if (update) {
+        failures = UpdateGoldens(scalers[0], &source, directory);
+    } else {
+        for (size_t i = 0; i < sizeof(g_cases) / sizeof(g_cases[0]); i++) {
+            char path[512];
+            GoldenPath(path, sizeof(path), directory, g_cases[i].name);
+
+            PixelBuffer golden;
+            if (!TestImage_Load(path, &golden)) {
+                printf("FAIL %s: could not read %s\n", g_cases[i].name, path);
+                failures++;
+                continue;
+            }
+            for (int isa = 0; isa < 3; isa++) {
+                if (supported[isa]) {
+                    failures += CheckCase(scalers[isa], &source, &golden, &g_cases[i], (ScalerIsa)isa);
+                }
+            }
+            PixelBuffer_Free(&golden);
+        }
+        failures += CheckColorExtremes(scalers, supported);
+        failures += CheckLinearAlpha(scalers, supported);
+        failures += CheckRandom(scalers, supported);
+    }
+
+    for (int isa = 0; isa < 3; isa++) {
+        Scaler_Destroy(scalers[isa]);
+    }
+    PixelBuffer_Free(&source);
+
+    printf("%s: %d failure(s)\n", failures ? "FAILED" : "PASSED", failures);
+    return failures ? 1 : 0;
+}
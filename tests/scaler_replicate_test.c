@@ -0,0 +1,192 @@
+/**
+ * scaler_replicate_test.c - 정수 배율 최근접 확대(픽셀 반복) 테스트
+ *
+ * 반복 커널(스칼라/SSE2/AVX2)을 무작위 배율/위상/길이로 돌려 out[x] = src[(x + phase) / factor]와
+ * 비교하고 (count 뒤는 건드리지 않아야 함), 정수 배율 최근접 확대 전체를
+ * 무작위 배율/패닝/출력 위치/크기로 돌려 픽셀마다 계산한 최근접 결과와 비교한다.
+ * 반복 커널은 내부 함수이므로 scaler_kernels.h를 직접 쓴다.
+ *
+ * 사용법: scaler_replicate_test
+ */
+
+#include "scaler.h"
+#include "scaler_kernels.h"
+#include "test_image.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+// 무작위 검사 횟수 (명령어 집합마다)
+#define KERNEL_CASES 3000
+#define RENDER_CASES 3000
+
+// 커널 출력 뒤 보호 영역
+#define GUARD_PIXELS 16
+#define GUARD_VALUE 0xDEADBEEFu
+
+#define MAX_COUNT 600
+#define MAX_FACTOR 16
+
+static const char* g_isaNames[] = {"scalar", "sse2", "avx2"};
+
+/**
+ * 명령어 집합별 반복 커널
+ */
+static ReplicateRowFn GetKernel(ScalerIsa isa)
+{
+#if SCALER_HAVE_X86
+    if (isa == SCALER_ISA_SSE2) return Scaler_ReplicateSse2;
+    if (isa == SCALER_ISA_AVX2) return Scaler_ReplicateAvx2;
+#endif
+    return isa == SCALER_ISA_SCALAR ? Scaler_ReplicateScalar : NULL;
+}
+
+/**
+ * 반복 커널을 직접 검사
+ */
+static int CheckKernel(ScalerIsa isa)
+{
+    ReplicateRowFn replicate = GetKernel(isa);
+    if (!replicate) {
+        return 0;
+    }
+
+    static uint32_t src[MAX_COUNT + 1];
+    static uint32_t out[MAX_COUNT + GUARD_PIXELS];
+    uint32_t state = 777 + (uint32_t)isa;
+    for (int i = 0; i <= MAX_COUNT; i++) {
+        src[i] = TestImage_Random(&state);
+    }
+
+    int failures = 0;
+    for (int i = 0; i < KERNEL_CASES && failures < 10; i++) {
+        // 배율 1(복사)부터, 짧은 길이(SIMD 꼬리만 있는 경우) 포함
+        int factor = 1 + (int)(TestImage_Random(&state) % MAX_FACTOR);
+        int phase = (int)(TestImage_Random(&state) % (uint32_t)factor);
+        int count = 1 + (int)(TestImage_Random(&state) % (i % 4 == 0 ? 24 : MAX_COUNT));
+
+        for (int x = 0; x < count + GUARD_PIXELS; x++) {
+            out[x] = GUARD_VALUE;
+        }
+        replicate(src, out, count, factor, phase);
+
+        for (int x = 0; x < count + GUARD_PIXELS; x++) {
+            uint32_t expected = x < count ? src[(x + phase) / factor] : GUARD_VALUE;
+            if (out[x] != expected) {
+                printf("FAIL kernel [%s]: factor %d phase %d count %d differs at %d%s\n",
+                       g_isaNames[isa], factor, phase, count, x, x < count ? "" : " (past the end)");
+                failures++;
+                break;
+            }
+        }
+    }
+
+    if (failures == 0) {
+        printf("ok   %d kernel cases [%s]\n", KERNEL_CASES, g_isaNames[isa]);
+    }
+    return failures;
+}
+
+/**
+ * 최근접 소스 위치 (픽셀 중심 기준, 버퍼 경계로 고정)
+ */
+static int NearestPosition(double srcPos, double scale, int o, int limit)
+{
+    int pos = (int)floor(srcPos + (o + 0.5) * scale);
+    if (pos < 0) pos = 0;
+    if (pos > limit - 1) pos = limit - 1;
+    return pos;
+}
+
+/**
+ * 정수 배율 최근접 확대를 픽셀 단위 기준과 비교
+ */
+static int CheckRender(Scaler* scaler, ScalerIsa isa)
+{
+    uint32_t state = 4242 + (uint32_t)isa;
+    int failures = 0;
+
+    for (int i = 0; i < RENDER_CASES && failures < 10; i++) {
+        int sourceWidth = 1 + (int)(TestImage_Random(&state) % 120);
+        int sourceHeight = 1 + (int)(TestImage_Random(&state) % 40);
+        PixelBuffer source;
+        if (!TestImage_CreateNoise(&source, sourceWidth, sourceHeight, TestImage_Random(&state))) {
+            return failures + 1;
+        }
+
+        // 정수 배율, 패닝은 1/8 픽셀 단위 (서브픽셀 위상, 가장자리에 걸리는 경우 포함)
+        int factor = 1 + (int)(TestImage_Random(&state) % 12);
+        ScaleParams params;
+        memset(&params, 0, sizeof(params));
+        params.filter = SCALE_FILTER_NEAREST;
+        params.outputWidth = factor * (1 + (int)(TestImage_Random(&state) % 80));
+        params.outputHeight = factor * (1 + (int)(TestImage_Random(&state) % 20));
+        params.srcWidth = (float)params.outputWidth / factor;
+        params.srcHeight = (float)params.outputHeight / factor;
+        params.srcX = (float)((int)(TestImage_Random(&state) % (uint32_t)(sourceWidth * 8 + 16)) - 8) / 8.0f;
+        params.srcY = (float)((int)(TestImage_Random(&state) % (uint32_t)(sourceHeight * 8 + 16)) - 8) / 8.0f;
+        params.dstOffsetX = (int)(TestImage_Random(&state) % (uint32_t)params.outputWidth);
+        params.dstOffsetY = (int)(TestImage_Random(&state) % (uint32_t)params.outputHeight);
+        int width = 1 + (int)(TestImage_Random(&state) % (uint32_t)(params.outputWidth - params.dstOffsetX));
+        int height = 1 + (int)(TestImage_Random(&state) % (uint32_t)(params.outputHeight - params.dstOffsetY));
+
+        PixelBuffer output;
+        if (!PixelBuffer_Alloc(&output, width, height) || !Scaler_Render(scaler, &source, &output, &params)) {
+            printf("FAIL render case %d [%s]: render failed\n", i, g_isaNames[isa]);
+            PixelBuffer_Free(&output);
+            PixelBuffer_Free(&source);
+            failures++;
+            continue;
+        }
+
+        double scaleX = params.srcWidth / (double)params.outputWidth;
+        double scaleY = params.srcHeight / (double)params.outputHeight;
+        bool same = true;
+        for (int y = 0; y < height && same; y++) {
+            int sy = NearestPosition(params.srcY, scaleY, params.dstOffsetY + y, sourceHeight);
+            const uint32_t* srcRow = PixelBuffer_Row(&source, sy);
+            const uint32_t* outRow = PixelBuffer_Row(&output, y);
+            for (int x = 0; x < width; x++) {
+                int sx = NearestPosition(params.srcX, scaleX, params.dstOffsetX + x, sourceWidth);
+                if (outRow[x] != srcRow[sx]) {
+                    printf("FAIL render case %d [%s]: factor %d pan (%.3f, %.3f) differs at (%d, %d)\n",
+                           i, g_isaNames[isa], factor, params.srcX, params.srcY, x, y);
+                    same = false;
+                    failures++;
+                    break;
+                }
+            }
+        }
+
+        PixelBuffer_Free(&output);
+        PixelBuffer_Free(&source);
+    }
+
+    if (failures == 0) {
+        printf("ok   %d integer zoom cases [%s]\n", RENDER_CASES, g_isaNames[isa]);
+    }
+    return failures;
+}
+
+int main(void)
+{
+    int failures = 0;
+    for (int isa = 0; isa < 3; isa++) {
+        Scaler* scaler = Scaler_Create();
+        if (!scaler) {
+            printf("FAIL: could not create scaler\n");
+            return 1;
+        }
+        Scaler_SetIsa(scaler, (ScalerIsa)isa);
+        if (Scaler_GetIsa(scaler) != (ScalerIsa)isa) {
+            printf("skip %s (not supported by this CPU)\n", g_isaNames[isa]);
+        } else {
+            failures += CheckKernel((ScalerIsa)isa);
+            failures += CheckRender(scaler, (ScalerIsa)isa);
+        }
+        Scaler_Destroy(scaler);
+    }
+
+    printf("%s: %d failure(s)\n", failures ? "FAILED" : "PASSED", failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,294 @@
+/**
+ * scaler_threads_test.c - 밴드 병렬 확대 테스트
+ *
+ * 작업 스레드 풀(1~8 스레드)을 붙인 확대 엔진의 결과가 풀 없이 한 스레드로 확대한 결과와
+ * 비트 단위로 같은지 확인한다. 기준 이미지 사례, SCALER_MIN_BAND_ROWS로 나누어떨어지지 않는 높이를
+ * 포함한 여러 출력 크기, 무작위 매개변수를 모든 필터/색 필터/선형 광량으로 검사하고,
+ * 실제로 밴드가 나뉘었는지도 밴드 통계로 확인한다.
+ *
+ * 사용법: scaler_threads_test <기준 이미지 폴더>
+ */
+
+#include "scaler.h"
+#include "test_image.h"
+#include <stdio.h>
+#include <string.h>
+
+#define MAX_THREADS 8
+
+// 기준 이미지의 원본 (scaler_golden_test와 같음)
+#define GOLDEN_WIDTH 40
+#define GOLDEN_HEIGHT 24
+#define GOLDEN_SEED 1
+
+// 크기별 검사의 원본
+#define SOURCE_WIDTH 640
+#define SOURCE_HEIGHT 360
+
+// 무작위 검사 횟수
+#define RANDOM_CASES 60
+
+typedef struct {
+    const char* name;
+    ScaleFilter filter;
+    float srcX, srcY, srcWidth, srcHeight;
+    int outputWidth, outputHeight;
+} GoldenCase;
+
+static const GoldenCase g_goldenCases[] = {
+    {"nearest_2x",    SCALE_FILTER_NEAREST,  0.0f, 0.0f, 40.0f, 24.0f, 80, 48},
+    {"bilinear_2x",   SCALE_FILTER_BILINEAR, 0.0f, 0.0f, 40.0f, 24.0f, 80, 48},
+    {"bicubic_2x",    SCALE_FILTER_BICUBIC,  0.0f, 0.0f, 40.0f, 24.0f, 80, 48},
+    {"lanczos3_2x",   SCALE_FILTER_LANCZOS3, 0.0f, 0.0f, 40.0f, 24.0f, 80, 48},
+    {"nearest_frac",  SCALE_FILTER_NEAREST,  3.25f, 2.5f, 21.5f, 13.75f, 86, 55},
+    {"bilinear_frac", SCALE_FILTER_BILINEAR, 3.25f, 2.5f, 21.5f, 13.75f, 86, 55},
+    {"bicubic_frac",  SCALE_FILTER_BICUBIC,  3.25f, 2.5f, 21.5f, 13.75f, 86, 55},
+    {"lanczos3_frac", SCALE_FILTER_LANCZOS3, 3.25f, 2.5f, 21.5f, 13.75f, 86, 55},
+};
+
+// 출력 크기 (높이는 32행 밴드로 나누어떨어지지 않는 값 포함)
+static const int g_widths[] = {1024, 1283};
+static const int g_heights[] = {64, 95, 257, 1000, 1081};
+
+static const char* g_filterNames[] = {"nearest", "bilinear", "bicubic", "lanczos3"};
+
+/**
+ * 풀 크기별 확대 엔진
+ */
+typedef struct {
+    Scaler* single;                     // 풀 없음 (기준)
+    Scaler* pooled[MAX_THREADS + 1];    // [n]: n 스레드 풀
+    WorkerPool* pools[MAX_THREADS + 1];
+} ScalerSet;
+
+static bool CreateSet(ScalerSet* set)
+{
+    memset(set, 0, sizeof(*set));
+    set->single = Scaler_Create();
+    if (!set->single) return false;
+
+    for (int n = 1; n <= MAX_THREADS; n++) {
+        set->pooled[n] = Scaler_Create();
+        set->pools[n] = WorkerPool_Create(n);
+        if (!set->pooled[n] || !set->pools[n]) return false;
+        Scaler_SetWorkers(set->pooled[n], set->pools[n]);
+    }
+    return true;
+}
+
+static void DestroySet(ScalerSet* set)
+{
+    Scaler_Destroy(set->single);
+    for (int n = 1; n <= MAX_THREADS; n++) {
+        Scaler_Destroy(set->pooled[n]);
+        WorkerPool_Destroy(set->pools[n]);
+    }
+}
+
+/**
+ * 풀을 붙인 확대 엔진이 나눌 밴드 수 (scaler.c의 GetBandCount와 같은 규칙)
+ */
+static int ExpectedBands(int threads, int width, int height)
+{
+    int bands = threads;
+    int byRows = height / SCALER_MIN_BAND_ROWS;
+    long long byPixels = (long long)width * height / SCALER_MIN_BAND_PIXELS;
+    if (bands > byRows) bands = byRows;
+    if (bands > byPixels) bands = (int)byPixels;
+    return bands > 1 ? bands : 1;
+}
+
+/**
+ * 한 매개변수를 풀 없이/1~8 스레드로 확대해 비교 (expected가 있으면 그것과 비교)
+ */
+static int CheckParams(ScalerSet* set, const PixelBuffer* source, const ScaleParams* params,
+                       int width, int height, const PixelBuffer* expected, const char* name)
+{
+    PixelBuffer reference, output;
+    if (!PixelBuffer_Alloc(&reference, width, height) || !PixelBuffer_Alloc(&output, width, height)) {
+        PixelBuffer_Free(&reference);
+        printf("FAIL %s: out of memory\n", name);
+        return 1;
+    }
+
+    int failures = 0;
+    int diffX, diffY;
+    if (!Scaler_Render(set->single, source, &reference, params)) {
+        printf("FAIL %s: single-thread render failed\n", name);
+        failures++;
+    } else if (expected && !TestImage_Equal(&reference, expected, &diffX, &diffY)) {
+        printf("FAIL %s: single-thread render differs from golden at (%d, %d)\n", name, diffX, diffY);
+        failures++;
+    }
+
+    for (int n = 1; n <= MAX_THREADS && !failures; n++) {
+        memset(output.pixels, 0, (size_t)output.stride * output.height);
+        if (!Scaler_Render(set->pooled[n], source, &output, params)) {
+            printf("FAIL %s [%d threads]: render failed\n", name, n);
+            failures++;
+            break;
+        }
+        if (!TestImage_Equal(&output, &reference, &diffX, &diffY)) {
+            printf("FAIL %s [%d threads]: differs from single thread at (%d, %d)\n", name, n, diffX, diffY);
+            failures++;
+            break;
+        }
+
+        // 나뉘어야 하는 크기인데 한 스레드로 처리했으면 비교가 의미 없음
+        ScalerBandStats stats;
+        Scaler_GetBandStats(set->pooled[n], &stats);
+        int bands = ExpectedBands(n, width, height);
+        if (bands > 1 && stats.bands != bands) {
+            printf("FAIL %s [%d threads]: rendered in %d bands, expected %d\n", name, n, stats.bands, bands);
+            failures++;
+        }
+    }
+
+    PixelBuffer_Free(&reference);
+    PixelBuffer_Free(&output);
+    return failures;
+}
+
+/**
+ * 기준 이미지 사례 (출력이 작아 한 밴드지만, 풀을 붙인 경로도 기준과 같아야 함)
+ */
+static int CheckGoldens(ScalerSet* set, const char* directory)
+{
+    PixelBuffer source;
+    if (!TestImage_Create(&source, GOLDEN_WIDTH, GOLDEN_HEIGHT, GOLDEN_SEED)) {
+        return 1;
+    }
+
+    int failures = 0;
+    for (size_t i = 0; i < sizeof(g_goldenCases) / sizeof(g_goldenCases[0]); i++) {
+        const GoldenCase* test = &g_goldenCases[i];
+        char path[512];
+        snprintf(path, sizeof(path), "%s/%s.pam", directory, test->name);
+
+        PixelBuffer golden;
+        if (!TestImage_Load(path, &golden)) {
+            printf("FAIL %s: could not read %s\n", test->name, path);
+            failures++;
+            continue;
+        }
+
+        ScaleParams params;
+        memset(&params, 0, sizeof(params));
+        params.srcX = test->srcX;
+        params.srcY = test->srcY;
+        params.srcWidth = test->srcWidth;
+        params.srcHeight = test->srcHeight;
+        params.outputWidth = test->outputWidth;
+        params.outputHeight = test->outputHeight;
+        params.filter = test->filter;
+        failures += CheckParams(set, &source, &params, test->outputWidth, test->outputHeight, &golden, test->name);
+        PixelBuffer_Free(&golden);
+    }
+
+    if (failures == 0) {
+        printf("ok   %d golden cases with 1-%d threads\n",
+               (int)(sizeof(g_goldenCases) / sizeof(g_goldenCases[0])), MAX_THREADS);
+    }
+    PixelBuffer_Free(&source);
+    return failures;
+}
+
+/**
+ * 출력 크기 × 필터 (색 필터와 선형 광량은 돌아가며)
+ */
+static int CheckSizes(ScalerSet* set, const PixelBuffer* source)
+{
+    int failures = 0;
+    int cases = 0;
+
+    for (size_t w = 0; w < sizeof(g_widths) / sizeof(g_widths[0]); w++) {
+        for (size_t h = 0; h < sizeof(g_heights) / sizeof(g_heights[0]); h++) {
+            for (int filter = 0; filter < 4; filter++) {
+                ScaleParams params;
+                memset(&params, 0, sizeof(params));
+                params.srcX = 17.25f;
+                params.srcY = 9.5f;
+                params.srcWidth = g_widths[w] / 2.5f;
+                params.srcHeight = g_heights[h] / 2.5f;
+                params.outputWidth = g_widths[w];
+                params.outputHeight = g_heights[h];
+                params.filter = (ScaleFilter)filter;
+                params.color = (ColorFilter)((cases / 4) % 5);
+                params.linearLight = cases % 3 == 0;
+                cases++;
+
+                char name[96];
+                snprintf(name, sizeof(name), "%s %dx%d color %d%s", g_filterNames[filter],
+                         g_widths[w], g_heights[h], (int)params.color, params.linearLight ? " linear" : "");
+                failures += CheckParams(set, source, &params, g_widths[w], g_heights[h], NULL, name);
+            }
+        }
+    }
+
+    if (failures == 0) {
+        printf("ok   %d output sizes/filters with 1-%d threads\n", cases, MAX_THREADS);
+    }
+    return failures;
+}
+
+/**
+ * 무작위 매개변수 (부분 영역 출력 포함)
+ */
+static int CheckRandom(ScalerSet* set, const PixelBuffer* source)
+{
+    uint32_t state = 2024;
+    int failures = 0;
+
+    for (int i = 0; i < RANDOM_CASES; i++) {
+        ScaleParams params;
+        memset(&params, 0, sizeof(params));
+        params.outputWidth = 64 + (int)(TestImage_Random(&state) % 1400);
+        params.outputHeight = 33 + (int)(TestImage_Random(&state) % 900);
+        float zoom = 1.0f + (float)(TestImage_Random(&state) % 700) / 100.0f;
+        params.srcWidth = params.outputWidth / zoom;
+        params.srcHeight = params.outputHeight / zoom;
+        params.srcX = (float)(TestImage_Random(&state) % 1000) / 1000.0f * (SOURCE_WIDTH - 1);
+        params.srcY = (float)(TestImage_Random(&state) % 1000) / 1000.0f * (SOURCE_HEIGHT - 1);
+        params.filter = (ScaleFilter)(TestImage_Random(&state) % 4);
+        params.color = (ColorFilter)(TestImage_Random(&state) % 5);
+        params.linearLight = TestImage_Random(&state) % 2 == 0;
+        params.dstOffsetX = (int)(TestImage_Random(&state) % (uint32_t)(params.outputWidth / 4));
+        params.dstOffsetY = (int)(TestImage_Random(&state) % (uint32_t)(params.outputHeight / 4));
+        int width = params.outputWidth - params.dstOffsetX;
+        int height = params.outputHeight - params.dstOffsetY;
+
+        char name[64];
+        snprintf(name, sizeof(name), "random case %d", i);
+        failures += CheckParams(set, source, &params, width, height, NULL, name);
+    }
+
+    if (failures == 0) {
+        printf("ok   %d random cases with 1-%d threads\n", RANDOM_CASES, MAX_THREADS);
+    }
+    return failures;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        printf("usage: %s <golden directory>\n", argv[0]);
+        return 2;
+    }
+
+    ScalerSet set;
+    PixelBuffer source;
+    if (!CreateSet(&set) || !TestImage_Create(&source, SOURCE_WIDTH, SOURCE_HEIGHT, 3)) {
+        printf("FAIL: could not create scalers\n");
+        return 1;
+    }
+
+    int failures = CheckGoldens(&set, argv[1]);
+    failures += CheckSizes(&set, &source);
+    failures += CheckRandom(&set, &source);
+
+    DestroySet(&set);
+    PixelBuffer_Free(&source);
+
+    printf("%s: %d failure(s)\n", failures ? "FAILED" : "PASSED", failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,479 @@
+/**
+ * snapshot_test.c - 스냅샷 압축과 정지 화면 기록 테스트
+ *
+ * 압축: 잡음/단색/그라데이션/합성 화면/윗줄 반복을 여러 크기(255 경계, 홀수 너비 포함)로 압축했다가 풀어
+ * 원본과 비트 단위로 같은지, 행 간격이 다른 버퍼에서 압축하고 다른 버퍼로 풀 수 있는지,
+ * 압축이 안 되는 잡음도 최대 크기(SnapshotCodec_Bound)를 넘지 않는지, 잘린 데이터는 거부하는지 확인한다.
+ * 기록: 개수 한도와 메모리 한도에서 가장 오래된 것부터 버리는지, 꺼낸 화면과 확대 상태가
+ * 넣은 것과 같은지 (압축 전 원본 복사와 압축 후 풀기 모두) 확인한다.
+ *
+ * 사용법: snapshot_test
+ */
+
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "snapshot_codec.h"
+#include "snapshot_history.h"
+#include "test_image.h"
+#include "worker_pool.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+// 배경 압축을 기다리는 최대 시간
+#define COMPRESS_TIMEOUT_MS 10000
+
+// 행 간격 검사에서 행 끝 뒤 여유 (픽셀)
+#define STRIDE_PADDING 7
+#define GUARD_VALUE 0xA5A5A5A5u
+
+typedef enum {
+    CONTENT_NOISE = 0,
+    CONTENT_FLAT,
+    CONTENT_GRADIENT,
+    CONTENT_SCREEN,
+    CONTENT_REPEAT,
+    CONTENT_COUNT
+} Content;
+
+static const char* g_contentNames[] = {"noise", "flat", "gradient", "screen", "repeat"};
+
+static void SleepMs(int ms)
+{
+#ifdef _WIN32
+    Sleep((DWORD)ms);
+#else
+    struct timespec delay = {0, (long)ms * 1000000L};
+    nanosleep(&delay, NULL);
+#endif
+}
+
+/**
+ * 내용 채우기 (image는 할당되어 있어야 함)
+ */
+static void FillContent(const PixelBuffer* image, Content content, uint32_t seed)
+{
+    uint32_t state = seed;
+    PixelBuffer screen = {0};
+    if (content == CONTENT_SCREEN && !TestImage_Create(&screen, image->width, image->height, seed)) {
+        content = CONTENT_NOISE;
+    }
+
+    for (int y = 0; y < image->height; y++) {
+        uint32_t* row = PixelBuffer_Row(image, y);
+        for (int x = 0; x < image->width; x++) {
+            switch (content) {
+                case CONTENT_FLAT:
+                    row[x] = 0xFFF3F3F3u;
+                    break;
+                case CONTENT_GRADIENT:
+                    row[x] = 0xFF000000u | ((uint32_t)(x & 0xFF) << 16) | ((uint32_t)(y & 0xFF) << 8) |
+                             (uint32_t)((x + y) & 0xFF);
+                    break;
+                case CONTENT_SCREEN:
+                    row[x] = PixelBuffer_Row(&screen, y)[x];
+                    break;
+                case CONTENT_REPEAT:
+                    // 7행마다 같은 잡음 행 (위로 여러 행 떨어진 일치)
+                    row[x] = y >= 7 ? PixelBuffer_Row(image, y - 7)[x] : TestImage_Random(&state);
+                    break;
+                default:
+                    row[x] = TestImage_Random(&state);
+                    break;
+            }
+        }
+    }
+    PixelBuffer_Free(&screen);
+}
+
+/**
+ * 압축했다가 풀어서 비교 (source와 target의 행 간격은 달라도 됨)
+ * 압축 크기를 돌려주고, 실패하면 0
+ */
+static size_t RoundTrip(const PixelBuffer* source, const PixelBuffer* target, const char* name)
+{
+    size_t bound = SnapshotCodec_Bound(source->width, source->height);
+    uint8_t* packed = (uint8_t*)malloc(bound);
+    if (!packed) {
+        printf("FAIL %s: out of memory\n", name);
+        return 0;
+    }
+
+    size_t size = SnapshotCodec_Encode(source, packed, bound);
+    int diffX, diffY;
+    if (size == 0 || size > bound) {
+        printf("FAIL %s: encoded %zu bytes, bound %zu\n", name, size, bound);
+        size = 0;
+    } else if (!SnapshotCodec_Decode(packed, size, target)) {
+        printf("FAIL %s: decode rejected its own data\n", name);
+        size = 0;
+    } else if (!TestImage_Equal(source, target, &diffX, &diffY)) {
+        printf("FAIL %s: decoded image differs at (%d, %d)\n", name, diffX, diffY);
+        size = 0;
+    } else if (SnapshotCodec_Decode(packed, size - 1, target) ||
+               (size > 16 && SnapshotCodec_Decode(packed, size / 2, target))) {
+        printf("FAIL %s: truncated data was accepted\n", name);
+        size = 0;
+    }
+
+    free(packed);
+    return size;
+}
+
+/**
+ * 내용 × 크기 왕복
+ */
+static int CheckRoundTrips(void)
+{
+    static const int sizes[][2] = {
+        {1, 1}, {2, 3}, {14, 5}, {15, 2}, {16, 9}, {254, 3}, {255, 4}, {256, 6}, {269, 11}, {270, 2},
+        {511, 5}, {1000, 37}, {1283, 61}
+    };
+    int failures = 0;
+    int cases = 0;
+
+    for (int content = 0; content < CONTENT_COUNT; content++) {
+        for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+            int width = sizes[s][0];
+            int height = sizes[s][1];
+            PixelBuffer source, target;
+            if (!PixelBuffer_Alloc(&source, width, height) || !PixelBuffer_Alloc(&target, width, height)) {
+                printf("FAIL: out of memory\n");
+                PixelBuffer_Free(&source);
+                return failures + 1;
+            }
+            FillContent(&source, (Content)content, 100 + (uint32_t)s);
+
+            char name[64];
+            snprintf(name, sizeof(name), "%s %dx%d", g_contentNames[content], width, height);
+            size_t size = RoundTrip(&source, &target, name);
+            if (size == 0) {
+                failures++;
+            } else if (content == CONTENT_NOISE && width >= 16 &&
+                       size <= (size_t)width * height * 4) {
+                // 압축이 안 되는 내용은 원본보다 커야 최대 크기 경로를 지난 것
+                printf("FAIL %s: noise compressed to %zu bytes, expected more than the raw size\n", name, size);
+                failures++;
+            } else if (content == CONTENT_FLAT && width * height >= 1000 &&
+                       size * 8 > (size_t)width * height * 4) {
+                printf("FAIL %s: %zu bytes is less than 8:1 on flat content\n", name, size);
+                failures++;
+            }
+            cases++;
+
+            PixelBuffer_Free(&source);
+            PixelBuffer_Free(&target);
+        }
+    }
+
+    if (failures == 0) {
+        printf("ok   %d round trips (%d contents, 1x1 to 1283x61)\n", cases, CONTENT_COUNT);
+    }
+    return failures;
+}
+
+/**
+ * 행 간격이 너비보다 큰 버퍼 (부분 영역)에서 압축하고 다른 행 간격의 버퍼로 풀기
+ * 풀 때 행 끝 뒤 여유는 건드리지 않아야 한다.
+ */
+static int CheckStrides(void)
+{
+    int failures = 0;
+
+    for (int content = 0; content < CONTENT_COUNT; content++) {
+        int width = 333, height = 41;
+        PixelBuffer outer, targetOuter;
+        if (!PixelBuffer_Alloc(&outer, width + 13, height + 2) ||
+            !PixelBuffer_Alloc(&targetOuter, width + STRIDE_PADDING, height)) {
+            printf("FAIL: out of memory\n");
+            PixelBuffer_Free(&outer);
+            return failures + 1;
+        }
+        PixelBuffer source = PixelBuffer_SubView(&outer, 5, 1, width, height);
+        PixelBuffer target = PixelBuffer_SubView(&targetOuter, 0, 0, width, height);
+        FillContent(&outer, CONTENT_NOISE, 3);
+        FillContent(&source, (Content)content, 4);
+        PixelBuffer_Fill(&targetOuter, GUARD_VALUE);
+
+        char name[64];
+        snprintf(name, sizeof(name), "%s stride %d -> %d", g_contentNames[content], outer.stride, targetOuter.stride);
+        if (RoundTrip(&source, &target, name) == 0) {
+            failures++;
+        }
+
+        bool clean = true;
+        for (int y = 0; y < height && clean; y++) {
+            const uint32_t* row = PixelBuffer_Row(&targetOuter, y);
+            for (int x = width; x < width + STRIDE_PADDING && clean; x++) {
+                if (row[x] != GUARD_VALUE) {
+                    printf("FAIL %s: wrote past the row end at (%d, %d)\n", name, x, y);
+                    failures++;
+                    clean = false;
+                }
+            }
+        }
+
+        PixelBuffer_Free(&outer);
+        PixelBuffer_Free(&targetOuter);
+    }
+
+    if (failures == 0) {
+        printf("ok   round trips between buffers with different strides\n");
+    }
+    return failures;
+}
+
+/**
+ * 최대 크기보다 작은 출력 공간, 잘못된 크기로 풀기
+ */
+static int CheckLimits(void)
+{
+    int failures = 0;
+    PixelBuffer image, other;
+    if (!TestImage_CreateNoise(&image, 300, 20, 9) || !PixelBuffer_Alloc(&other, 301, 20)) {
+        printf("FAIL: out of memory\n");
+        return 1;
+    }
+
+    size_t bound = SnapshotCodec_Bound(image.width, image.height);
+    uint8_t* packed = (uint8_t*)malloc(bound);
+    if (!packed) {
+        printf("FAIL: out of memory\n");
+        failures++;
+    } else {
+        if (SnapshotCodec_Encode(&image, packed, bound - 1) != 0) {
+            printf("FAIL limits: encode accepted less than the bound\n");
+            failures++;
+        }
+        size_t size = SnapshotCodec_Encode(&image, packed, bound);
+        if (size == 0 || SnapshotCodec_Decode(packed, size, &other)) {
+            printf("FAIL limits: decode into a different size was accepted\n");
+            failures++;
+        }
+        if (SnapshotCodec_Bound(0, 10) != 0 || SnapshotCodec_Bound(10, 0) != 0) {
+            printf("FAIL limits: bound of an empty image is not 0\n");
+            failures++;
+        }
+        free(packed);
+    }
+
+    if (failures == 0) {
+        printf("ok   encode needs the full bound, decode rejects a size mismatch\n");
+    }
+    PixelBuffer_Free(&image);
+    PixelBuffer_Free(&other);
+    return failures;
+}
+
+/**
+ * 배경 압축이 끝날 때까지 기다리기
+ */
+static bool WaitCompressed(SnapshotHistory* history)
+{
+    double start = WorkerPool_NowMs();
+    SnapshotHistoryStats stats;
+    for (;;) {
+        SnapshotHistory_GetStats(history, &stats);
+        if (stats.pending == 0) {
+            return true;
+        }
+        if (WorkerPool_NowMs() - start > COMPRESS_TIMEOUT_MS) {
+            return false;
+        }
+        SleepMs(1);
+    }
+}
+
+/**
+ * 꺼낸 화면과 확대 상태가 넣은 것과 같은지
+ */
+static bool LoadMatches(SnapshotHistory* history, int age, const PixelBuffer* expected, float zoom,
+                        const char* name)
+{
+    SnapshotView view;
+    const PixelBuffer* loaded = SnapshotHistory_Load(history, age, &view);
+    int diffX, diffY;
+    bool same = loaded && view.zoom == zoom && TestImage_Equal(loaded, expected, &diffX, &diffY);
+    if (!loaded) {
+        printf("FAIL %s: could not load age %d\n", name, age);
+    } else if (!same) {
+        printf("FAIL %s: age %d differs (zoom %.1f, expected %.1f)\n", name, age, view.zoom, zoom);
+    }
+    if (loaded) {
+        SnapshotHistory_Release(history);
+    }
+    return same;
+}
+
+/**
+ * 넣기 (정지 화면은 frame을 복사 없이 감쌈)
+ */
+static bool Push(SnapshotHistory* history, const PixelBuffer* frame, float zoom)
+{
+    SnapshotView view = {zoom, frame->width / 2.0f, frame->height / 2.0f};
+    return SnapshotHistory_Push(history, FrameSource_CreateStill(frame), &view);
+}
+
+/**
+ * 개수 한도: 가장 오래된 것부터 버리고 나머지는 순서대로 꺼냄
+ */
+static int CheckEntryLimit(void)
+{
+    enum { MAX_ENTRIES = 4, PUSHES = 7 };
+    PixelBuffer frames[PUSHES] = {{0}};
+    int failures = 0;
+
+    SnapshotHistory* history = SnapshotHistory_Create(MAX_ENTRIES, (size_t)1 << 30);
+    if (!history) {
+        printf("FAIL: could not create history\n");
+        return 1;
+    }
+
+    for (int i = 0; i < PUSHES; i++) {
+        // 크기가 서로 다름 (꺼내기 버퍼를 다시 만드는 경로)
+        if (!PixelBuffer_Alloc(&frames[i], 100 + i * 37, 40 + i * 5)) {
+            printf("FAIL: out of memory\n");
+            failures++;
+            break;
+        }
+        FillContent(&frames[i], (Content)(i % CONTENT_COUNT), 50 + (uint32_t)i);
+        if (!Push(history, &frames[i], (float)i)) {
+            printf("FAIL entries: push %d failed\n", i);
+            failures++;
+        }
+        int expected = i + 1 < MAX_ENTRIES ? i + 1 : MAX_ENTRIES;
+        if (SnapshotHistory_GetCount(history) != expected) {
+            printf("FAIL entries: %d after push %d, expected %d\n", SnapshotHistory_GetCount(history), i, expected);
+            failures++;
+        }
+    }
+
+    // 압축 전이든 후든 같은 화면 (먼저 바로 꺼내고, 압축이 끝난 뒤 다시)
+    for (int pass = 0; pass < 2 && failures == 0; pass++) {
+        if (pass == 1 && !WaitCompressed(history)) {
+            printf("FAIL entries: background compression did not finish\n");
+            failures++;
+            break;
+        }
+        for (int age = 0; age < MAX_ENTRIES; age++) {
+            int index = PUSHES - 1 - age;
+            failures += LoadMatches(history, age, &frames[index], (float)index, pass ? "packed" : "raw") ? 0 : 1;
+        }
+    }
+
+    // 한 번에 하나만 꺼냄, 범위 밖은 없음
+    SnapshotView view;
+    if (SnapshotHistory_Load(history, MAX_ENTRIES, &view) || SnapshotHistory_Load(history, -1, &view)) {
+        printf("FAIL entries: loaded an age outside the history\n");
+        failures++;
+    }
+    if (SnapshotHistory_Load(history, 0, &view)) {
+        if (SnapshotHistory_Load(history, 1, &view)) {
+            printf("FAIL entries: a second load succeeded before release\n");
+            failures++;
+        }
+        SnapshotHistory_Release(history);
+    }
+
+    SnapshotHistoryStats stats;
+    SnapshotHistory_GetStats(history, &stats);
+    if (stats.evictions != PUSHES - MAX_ENTRIES || stats.entries != MAX_ENTRIES || stats.pending != 0) {
+        printf("FAIL entries: %llu evictions, %d entries, %d pending\n",
+               stats.evictions, stats.entries, stats.pending);
+        failures++;
+    }
+
+    SnapshotHistory_Destroy(history);
+    for (int i = 0; i < PUSHES; i++) {
+        PixelBuffer_Free(&frames[i]);
+    }
+
+    if (failures == 0) {
+        printf("ok   entry limit keeps the newest %d of %d snapshots\n", MAX_ENTRIES, PUSHES);
+    }
+    return failures;
+}
+
+/**
+ * 메모리 한도: 압축이 안 되는 화면 3.5장 분량이면 3장만 남고, 한도보다 큰 화면도 하나는 남김
+ */
+static int CheckByteLimit(void)
+{
+    enum { WIDTH = 160, HEIGHT = 120, PUSHES = 8, FIT = 3 };
+    size_t rawBytes = (size_t)WIDTH * HEIGHT * 4;
+    size_t maxBytes = rawBytes * 7 / 2;
+    PixelBuffer frames[PUSHES] = {{0}};
+    PixelBuffer huge = {0};
+    int failures = 0;
+
+    SnapshotHistory* history = SnapshotHistory_Create(SNAPSHOT_HISTORY_MAX_ENTRIES, maxBytes);
+    if (!history) {
+        printf("FAIL: could not create history\n");
+        return 1;
+    }
+
+    for (int i = 0; i < PUSHES && failures == 0; i++) {
+        // 잡음은 압축해도 원본보다 조금 커서 압축 시점과 관계없이 몇 장 남는지 정해짐
+        if (!TestImage_CreateNoise(&frames[i], WIDTH, HEIGHT, 700 + (uint32_t)i)) {
+            printf("FAIL: out of memory\n");
+            failures++;
+            break;
+        }
+        Push(history, &frames[i], (float)i);
+
+        SnapshotHistoryStats stats;
+        SnapshotHistory_GetStats(history, &stats);
+        int expected = i + 1 < FIT ? i + 1 : FIT;
+        if (stats.entries != expected || stats.bytes > maxBytes ||
+            stats.evictions != (unsigned long long)(i + 1 - expected)) {
+            printf("FAIL bytes: after push %d: %d entries (expected %d), %zu bytes (limit %zu), %llu evictions\n",
+                   i, stats.entries, expected, stats.bytes, maxBytes, stats.evictions);
+            failures++;
+        }
+    }
+
+    for (int age = 0; age < FIT && failures == 0; age++) {
+        int index = PUSHES - 1 - age;
+        failures += LoadMatches(history, age, &frames[index], (float)index, "bytes") ? 0 : 1;
+    }
+
+    // 한도보다 큰 화면: 나머지를 모두 버리고 방금 넣은 것은 남김
+    if (failures == 0 && TestImage_CreateNoise(&huge, WIDTH * 2, HEIGHT * 2, 800)) {
+        Push(history, &huge, 99.0f);
+        if (SnapshotHistory_GetCount(history) != 1 || !LoadMatches(history, 0, &huge, 99.0f, "oversized")) {
+            printf("FAIL bytes: a snapshot larger than the limit was not kept alone\n");
+            failures++;
+        }
+    }
+
+    SnapshotHistory_Destroy(history);
+    for (int i = 0; i < PUSHES; i++) {
+        PixelBuffer_Free(&frames[i]);
+    }
+    PixelBuffer_Free(&huge);
+
+    if (failures == 0) {
+        printf("ok   byte limit keeps %d incompressible snapshots and evicts the oldest\n", FIT);
+    }
+    return failures;
+}
+
+int main(void)
+{
+    int failures = CheckRoundTrips();
+    failures += CheckStrides();
+    failures += CheckLimits();
+    failures += CheckEntryLimit();
+    failures += CheckByteLimit();
+
+    printf("%s: %d failure(s)\n", failures ? "FAILED" : "PASSED", failures);
+    return failures ? 1 : 0;
+}
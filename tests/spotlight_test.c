@@ -0,0 +1,214 @@
+/**
+ * spotlight_test.c - 스포트라이트 마스크 테스트
+ *
+ * 무작위 원/둥근 사각형 모양(서브픽셀 중심, 다양한 feather, 레이어 가장자리에 걸리는 경우 포함)을
+ * 명령어 집합(스칼라/SSE2/AVX2)마다 그려 스칼라와 비트 단위로 같은지,
+ * 가장자리 폭 안의 값이 배정밀도로 계산한 smoothstep과 (반올림 차이 안에서) 같은지 확인한다.
+ * 일부 영역만 다시 그리면 그 영역만 바뀌고 전체를 그린 결과와 같아야 한다.
+ *
+ * 사용법: spotlight_test
+ */
+
+#include "spotlight.h"
+#include "test_image.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+// 무작위 모양 수 (원/사각형 각각)
+#define SHAPE_CASES 400
+
+// 배정밀도 기준과의 허용 차이 (float 계산, 알파 단계)
+#define ALPHA_TOLERANCE 1
+
+// 일부 영역 검사에서 덮어쓰지 않아야 하는 값
+#define GUARD_VALUE 0x12345678u
+
+static const char* g_isaNames[] = {"scalar", "sse2", "avx2"};
+static const char* g_shapeNames[] = {"circle", "rect"};
+
+/**
+ * 무작위 모양 (rect이면 반너비/반높이가 있는 둥근 사각형)
+ */
+static SpotlightShape RandomShape(uint32_t* state, bool rect, int width, int height)
+{
+    SpotlightShape shape;
+    // 중심은 레이어 밖 조금까지 (가장자리 영역이 잘리는 경우)
+    shape.centerX = (float)((int)(TestImage_Random(state) % (uint32_t)(width * 16 + 320)) - 160) / 16.0f;
+    shape.centerY = (float)((int)(TestImage_Random(state) % (uint32_t)(height * 16 + 320)) - 160) / 16.0f;
+    shape.halfWidth = rect ? (float)(TestImage_Random(state) % 400) / 8.0f : 0.0f;
+    shape.halfHeight = rect ? (float)(TestImage_Random(state) % 300) / 8.0f : 0.0f;
+    shape.radius = (float)(TestImage_Random(state) % (rect ? 200 : 600)) / 8.0f;
+    shape.feather = 1.0f + (float)(TestImage_Random(state) % 320) / 8.0f;
+    shape.dim = (int)(TestImage_Random(state) % 256);
+    return shape;
+}
+
+/**
+ * 배정밀도 마스크 알파
+ */
+static double ReferenceAlpha(const SpotlightShape* shape, int x, int y, double* t)
+{
+    double dx = fabs(x + 0.5 - shape->centerX) - shape->halfWidth;
+    double dy = fabs(y + 0.5 - shape->centerY) - shape->halfHeight;
+    double ex = dx > 0.0 ? dx : 0.0;
+    double ey = dy > 0.0 ? dy : 0.0;
+    double d = sqrt(ex * ex + ey * ey) - shape->radius;
+    *t = d / (shape->feather > 1.0f ? shape->feather : 1.0);
+    double clamped = *t < 0.0 ? 0.0 : *t > 1.0 ? 1.0 : *t;
+    return clamped * clamped * (3.0 - 2.0 * clamped) * shape->dim;
+}
+
+/**
+ * 배정밀도 기준과 비교 (가장자리 폭 안 픽셀 수를 edgePixels에 더함)
+ */
+static bool MatchesReference(const PixelBuffer* layer, const SpotlightShape* shape, long* edgePixels,
+                             int* failX, int* failY)
+{
+    for (int y = 0; y < layer->height; y++) {
+        const uint32_t* row = PixelBuffer_Row(layer, y);
+        for (int x = 0; x < layer->width; x++) {
+            double t;
+            double expected = ReferenceAlpha(shape, x, y, &t);
+            int alpha = (int)(row[x] >> 24);
+            if ((row[x] & 0x00FFFFFFu) != 0 || fabs(alpha - expected) > ALPHA_TOLERANCE + 0.5) {
+                *failX = x;
+                *failY = y;
+                return false;
+            }
+            if (t > 0.0 && t < 1.0) {
+                (*edgePixels)++;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * 무작위 모양을 명령어 집합마다 그려 비교
+ */
+static int CheckShapes(bool rect)
+{
+    ScalerIsa best = Scaler_DetectIsa();
+    uint32_t state = rect ? 5150 : 1984;
+    int failures = 0;
+    long edgePixels = 0;
+
+    for (int i = 0; i < SHAPE_CASES && failures < 10; i++) {
+        // 홀수 너비 (SIMD 꼬리)
+        int width = 1 + (int)(TestImage_Random(&state) % 160);
+        int height = 1 + (int)(TestImage_Random(&state) % 100);
+        SpotlightShape shape = RandomShape(&state, rect, width, height);
+        FrameRect all = {0, 0, width, height};
+
+        PixelBuffer layers[3] = {{0}};
+        for (int isa = 0; isa <= (int)best; isa++) {
+            if (!PixelBuffer_Alloc(&layers[isa], width, height)) {
+                printf("FAIL: out of memory\n");
+                failures++;
+                break;
+            }
+            Spotlight_Render((ScalerIsa)isa, &layers[isa], &shape, &all);
+        }
+
+        int diffX, diffY;
+        if (layers[0].pixels && !MatchesReference(&layers[0], &shape, &edgePixels, &diffX, &diffY)) {
+            double t;
+            printf("FAIL %s case %d [scalar]: alpha %u at (%d, %d), expected %.2f\n", g_shapeNames[rect], i,
+                   PixelBuffer_Row(&layers[0], diffY)[diffX] >> 24, diffX, diffY,
+                   ReferenceAlpha(&shape, diffX, diffY, &t));
+            failures++;
+        }
+        for (int isa = 1; isa <= (int)best; isa++) {
+            if (layers[isa].pixels && layers[0].pixels &&
+                !TestImage_Equal(&layers[0], &layers[isa], &diffX, &diffY)) {
+                printf("FAIL %s case %d [%s]: differs from scalar at (%d, %d), center (%.4f, %.4f) feather %.3f\n",
+                       g_shapeNames[rect], i, g_isaNames[isa], diffX, diffY, shape.centerX, shape.centerY,
+                       shape.feather);
+                failures++;
+            }
+        }
+
+        for (int isa = 0; isa < 3; isa++) {
+            PixelBuffer_Free(&layers[isa]);
+        }
+    }
+
+    if (failures == 0) {
+        printf("ok   %d %s shapes match scalar up to %s (%ld feather-edge pixels)\n",
+               SHAPE_CASES, g_shapeNames[rect], g_isaNames[best], edgePixels);
+    }
+    return failures;
+}
+
+/**
+ * 일부 영역 다시 그리기: 영역 밖은 그대로, 안은 전체를 그린 결과와 같아야 함
+ */
+static int CheckPartial(ScalerIsa isa)
+{
+    uint32_t state = 99 + (uint32_t)isa;
+    int failures = 0;
+
+    for (int i = 0; i < SHAPE_CASES && failures < 10; i++) {
+        int width = 1 + (int)(TestImage_Random(&state) % 160);
+        int height = 1 + (int)(TestImage_Random(&state) % 100);
+        SpotlightShape shape = RandomShape(&state, i % 2 == 1, width, height);
+
+        // 레이어 밖으로 나가는 영역 포함
+        FrameRect rect;
+        rect.left = (int)(TestImage_Random(&state) % (uint32_t)(width + 20)) - 10;
+        rect.top = (int)(TestImage_Random(&state) % (uint32_t)(height + 20)) - 10;
+        rect.right = rect.left + (int)(TestImage_Random(&state) % (uint32_t)(width + 10));
+        rect.bottom = rect.top + (int)(TestImage_Random(&state) % (uint32_t)(height + 10));
+
+        PixelBuffer full, part;
+        if (!PixelBuffer_Alloc(&full, width, height) || !PixelBuffer_Alloc(&part, width, height)) {
+            printf("FAIL: out of memory\n");
+            PixelBuffer_Free(&full);
+            return failures + 1;
+        }
+        FrameRect all = {0, 0, width, height};
+        Spotlight_Render(isa, &full, &shape, &all);
+        PixelBuffer_Fill(&part, GUARD_VALUE);
+        Spotlight_Render(isa, &part, &shape, &rect);
+
+        bool same = true;
+        for (int y = 0; y < height && same; y++) {
+            for (int x = 0; x < width && same; x++) {
+                bool inside = x >= rect.left && x < rect.right && y >= rect.top && y < rect.bottom;
+                uint32_t expected = inside ? PixelBuffer_Row(&full, y)[x] : GUARD_VALUE;
+                if (PixelBuffer_Row(&part, y)[x] != expected) {
+                    printf("FAIL partial case %d [%s]: (%d, %d) %s rect (%d,%d)-(%d,%d)\n", i, g_isaNames[isa],
+                           x, y, inside ? "differs from a full render in" : "was written outside",
+                           rect.left, rect.top, rect.right, rect.bottom);
+                    same = false;
+                    failures++;
+                }
+            }
+        }
+
+        PixelBuffer_Free(&full);
+        PixelBuffer_Free(&part);
+    }
+
+    if (failures == 0) {
+        printf("ok   %d partial redraws match a full render [%s]\n", SHAPE_CASES, g_isaNames[isa]);
+    }
+    return failures;
+}
+
+int main(void)
+{
+    int failures = CheckShapes(false);
+    failures += CheckShapes(true);
+    for (int isa = 0; isa < 3; isa++) {
+        if (isa > (int)Scaler_DetectIsa()) {
+            printf("skip %s (not supported by this CPU)\n", g_isaNames[isa]);
+            continue;
+        }
+        failures += CheckPartial((ScalerIsa)isa);
+    }
+
+    printf("%s: %d failure(s)\n", failures ? "FAILED" : "PASSED", failures);
+    return failures ? 1 : 0;
+}
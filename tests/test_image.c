@@ -0,0 +1,199 @@
+/**
+ * test_image.c - 테스트/벤치마크용 이미지 구현
+ */
+
+#include "test_image.h"
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * 재현 가능한 난수 (xorshift32)
+ */
+uint32_t TestImage_Random(uint32_t* state)
+{
+    uint32_t x = *state ? *state : 0x9E3779B9u;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+/**
+ * BGRA 픽셀 조합
+ */
+static uint32_t MakePixel(int r, int g, int b, int a)
+{
+    return ((uint32_t)a << 24) | ((uint32_t)r << 16) | ((uint32_t)g << 8) | (uint32_t)b;
+}
+
+/**
+ * 합성 화면 만들기
+ * 위 절반 왼쪽: 흰 바탕에 1픽셀 획 (글자 윤곽), 오른쪽: 경계가 뚜렷한 색 블록
+ * 아래 절반 왼쪽: 가로/세로 그라데이션, 오른쪽: 잡음 (알파 포함)
+ */
+bool TestImage_Create(PixelBuffer* image, int width, int height, uint32_t seed)
+{
+    if (!PixelBuffer_Alloc(image, width, height)) {
+        return false;
+    }
+
+    uint32_t state = seed;
+    int halfX = width / 2;
+    int halfY = height / 2;
+
+    for (int y = 0; y < height; y++) {
+        uint32_t* row = PixelBuffer_Row(image, y);
+        for (int x = 0; x < width; x++) {
+            uint32_t pixel;
+            if (y < halfY && x < halfX) {
+                // 3픽셀 간격의 세로 획과 대각선 획
+                bool ink = (x % 3 == 1 && (y / 4) % 2 == 0) || ((x + y) % 7 == 0);
+                pixel = ink ? MakePixel(16, 16, 24, 255) : MakePixel(255, 255, 255, 255);
+            } else if (y < halfY) {
+                int block = ((x - halfX) / 4 + y / 4) % 4;
+                static const uint32_t colors[4] = {0xFFE81123u, 0xFF107C10u, 0xFF0078D7u, 0xFFFFB900u};
+                pixel = colors[block];
+            } else if (x < halfX) {
+                int r = x * 255 / (halfX > 1 ? halfX - 1 : 1);
+                int g = (y - halfY) * 255 / (height - halfY > 1 ? height - halfY - 1 : 1);
+                pixel = MakePixel(r, g, 128, 255);
+            } else {
+                pixel = TestImage_Random(&state);
+            }
+            row[x] = pixel;
+        }
+    }
+    return true;
+}
+
+/**
+ * 잡음 이미지 만들기
+ */
+bool TestImage_CreateNoise(PixelBuffer* image, int width, int height, uint32_t seed)
+{
+    if (!PixelBuffer_Alloc(image, width, height)) {
+        return false;
+    }
+
+    uint32_t state = seed;
+    for (int y = 0; y < height; y++) {
+        uint32_t* row = PixelBuffer_Row(image, y);
+        for (int x = 0; x < width; x++) {
+            row[x] = TestImage_Random(&state);
+        }
+    }
+    return true;
+}
+
+/**
+ * PAM 헤더의 "키 값" 한 줄 읽기
+ */
+static bool ReadHeaderValue(FILE* file, const char* key, int* value)
+{
+    char name[16];
+    return fscanf(file, "%15s %d ", name, value) == 2 && strcmp(name, key) == 0;
+}
+
+/**
+ * PAM 파일 읽기
+ */
+bool TestImage_Load(const char* path, PixelBuffer* image)
+{
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        return false;
+    }
+
+    int width = 0, height = 0, depth = 0, maxValue = 0;
+    char magic[3] = {0};
+    char tupleType[32] = {0};
+    bool valid = fscanf(file, "%2s ", magic) == 1 && strcmp(magic, "P7") == 0 &&
+                 ReadHeaderValue(file, "WIDTH", &width) &&
+                 ReadHeaderValue(file, "HEIGHT", &height) &&
+                 ReadHeaderValue(file, "DEPTH", &depth) &&
+                 ReadHeaderValue(file, "MAXVAL", &maxValue) &&
+                 fscanf(file, "TUPLTYPE %31s ENDHDR", tupleType) == 1 &&
+                 fgetc(file) == '\n' &&
+                 depth == 4 && maxValue == 255 && strcmp(tupleType, "RGB_ALPHA") == 0;
+
+    if (!valid || !PixelBuffer_Alloc(image, width, height)) {
+        fclose(file);
+        return false;
+    }
+
+    // RGBA → BGRA
+    for (int y = 0; y < height && valid; y++) {
+        uint32_t* row = PixelBuffer_Row(image, y);
+        for (int x = 0; x < width; x++) {
+            uint8_t rgba[4];
+            if (fread(rgba, 1, 4, file) != 4) {
+                valid = false;
+                break;
+            }
+            row[x] = MakePixel(rgba[0], rgba[1], rgba[2], rgba[3]);
+        }
+    }
+
+    fclose(file);
+    if (!valid) {
+        PixelBuffer_Free(image);
+    }
+    return valid;
+}
+
+/**
+ * PAM 파일 쓰기
+ */
+bool TestImage_Save(const char* path, const PixelBuffer* image)
+{
+    FILE* file = fopen(path, "wb");
+    if (!file) {
+        return false;
+    }
+
+    fprintf(file, "P7\nWIDTH %d\nHEIGHT %d\nDEPTH 4\nMAXVAL 255\nTUPLTYPE RGB_ALPHA\nENDHDR\n",
+            image->width, image->height);
+
+    // BGRA → RGBA
+    bool written = true;
+    for (int y = 0; y < image->height && written; y++) {
+        const uint32_t* row = PixelBuffer_Row(image, y);
+        for (int x = 0; x < image->width; x++) {
+            uint8_t rgba[4] = {
+                (uint8_t)(row[x] >> 16), (uint8_t)(row[x] >> 8), (uint8_t)row[x], (uint8_t)(row[x] >> 24)
+            };
+            if (fwrite(rgba, 1, 4, file) != 4) {
+                written = false;
+                break;
+            }
+        }
+    }
+
+    return fclose(file) == 0 && written;
+}
+
+/**
+ * 두 이미지 비교
+ */
+bool TestImage_Equal(const PixelBuffer* a, const PixelBuffer* b, int* diffX, int* diffY)
+{
+    *diffX = -1;
+    *diffY = -1;
+    if (a->width != b->width || a->height != b->height) {
+        return false;
+    }
+
+    for (int y = 0; y < a->height; y++) {
+        const uint32_t* rowA = PixelBuffer_Row(a, y);
+        const uint32_t* rowB = PixelBuffer_Row(b, y);
+        for (int x = 0; x < a->width; x++) {
+            if (rowA[x] != rowB[x]) {
+                *diffX = x;
+                *diffY = y;
+                return false;
+            }
+        }
+    }
+    return true;
+}
@@ -0,0 +1,45 @@
+/**
+ * test_image.h - 테스트/벤치마크용 이미지 (합성 화면 생성, PAM 파일 읽기/쓰기)
+ *
+ * 기준 이미지는 PAM(P7, RGB_ALPHA) 형식으로 저장해 일반 이미지 도구로도 열어 볼 수 있다.
+ */
+
+#ifndef LETSZOOM_TEST_IMAGE_H
+#define LETSZOOM_TEST_IMAGE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "pixel_buffer.h"
+
+/**
+ * 합성 화면 만들기 (1픽셀 선/글자 획, 색 블록, 그라데이션, 잡음이 섞인 내용)
+ * 같은 seed면 항상 같은 이미지
+ */
+bool TestImage_Create(PixelBuffer* image, int width, int height, uint32_t seed);
+
+/**
+ * 잡음 이미지 만들기 (모든 채널이 무작위, 벤치마크/교차 검증용)
+ */
+bool TestImage_CreateNoise(PixelBuffer* image, int width, int height, uint32_t seed);
+
+/**
+ * PAM 파일 읽기 (image를 새로 할당)
+ */
+bool TestImage_Load(const char* path, PixelBuffer* image);
+
+/**
+ * PAM 파일 쓰기
+ */
+bool TestImage_Save(const char* path, const PixelBuffer* image);
+
+/**
+ * 두 이미지가 비트 단위로 같은지 (다르면 처음 다른 위치)
+ */
+bool TestImage_Equal(const PixelBuffer* a, const PixelBuffer* b, int* diffX, int* diffY);
+
+/**
+ * 재현 가능한 난수 (xorshift32)
+ */
+uint32_t TestImage_Random(uint32_t* state);
+
+#endif // LETSZOOM_TEST_IMAGE_H
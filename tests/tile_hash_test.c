@@ -0,0 +1,278 @@
+/**
+ * tile_hash_test.c - 타일 내용 해시 테스트
+ *
+ * 무작위 위치/크기(타일 한 칸 이하)의 해시가 명령어 집합(스칼라/SSE2/AVX2)과 관계없이 같은지,
+ * 그리고 Update가 바뀐 타일만 정확히 돌려주는지 명령어 집합마다 확인한다.
+ * 바뀌지 않은 프레임, 한 픽셀 변경, 64픽셀보다 좁은 가장자리 타일,
+ * 캡처 영역 크기/위치 변경(해시한 범위가 달라짐), 데스크톱보다 큰 프레임, Invalidate, 사각형 수 초과를 다룬다.
+ *
+ * 사용법: tile_hash_test
+ */
+
+#include "tile_hash.h"
+#include "test_image.h"
+#include <stdio.h>
+#include <string.h>
+
+// 무작위 해시 비교 횟수
+#define HASH_CASES 3000
+
+// 가장자리 타일이 좁도록 64의 배수가 아닌 크기 (오른쪽 8픽셀, 아래 22픽셀)
+#define DESKTOP_WIDTH 200
+#define DESKTOP_HEIGHT 150
+
+// 사각형 수 초과 검사용 (20x16 타일)
+#define LARGE_WIDTH 1280
+#define LARGE_HEIGHT 1024
+
+#define MAX_EXPECTED 8
+
+static const char* g_isaNames[] = {"scalar", "sse2", "avx2"};
+
+/**
+ * 무작위 사각형의 해시를 명령어 집합끼리 비교
+ */
+static int CheckHashIsa(void)
+{
+    PixelBuffer image;
+    if (!TestImage_CreateNoise(&image, 300, 200, 99)) {
+        printf("FAIL: out of memory\n");
+        return 1;
+    }
+
+    ScalerIsa best = Scaler_DetectIsa();
+    uint32_t state = 2024;
+    int failures = 0;
+
+    for (int i = 0; i < HASH_CASES && failures < 10; i++) {
+        // 줄무늬(16픽셀) 꼬리만 있는 좁은 너비 포함
+        int width = 1 + (int)(TestImage_Random(&state) % TILE_HASH_SIZE);
+        int height = 1 + (int)(TestImage_Random(&state) % TILE_HASH_SIZE);
+        int x = (int)(TestImage_Random(&state) % (uint32_t)(image.width - width + 1));
+        int y = (int)(TestImage_Random(&state) % (uint32_t)(image.height - height + 1));
+
+        uint64_t expected = TileHasher_HashRect(SCALER_ISA_SCALAR, &image, x, y, width, height);
+        for (int isa = SCALER_ISA_SSE2; isa <= (int)best; isa++) {
+            uint64_t hash = TileHasher_HashRect((ScalerIsa)isa, &image, x, y, width, height);
+            if (hash != expected) {
+                printf("FAIL hash [%s]: %dx%d at (%d, %d) differs from scalar\n",
+                       g_isaNames[isa], width, height, x, y);
+                failures++;
+            }
+        }
+    }
+
+    // 같은 내용은 위치와 관계없이 같은 해시, 한 픽셀만 달라도 다른 해시
+    PixelBuffer copy;
+    if (PixelBuffer_Alloc(&copy, image.width, image.height)) {
+        for (int y = 0; y < image.height; y++) {
+            memcpy(PixelBuffer_Row(&copy, y), PixelBuffer_Row(&image, y), (size_t)image.width * 4);
+        }
+        for (int isa = 0; isa <= (int)best; isa++) {
+            uint64_t before = TileHasher_HashRect((ScalerIsa)isa, &copy, 10, 20, TILE_HASH_SIZE, TILE_HASH_SIZE);
+            PixelBuffer_Row(&copy, 20 + 63)[10 + 63] ^= 0x00000100u;
+            uint64_t after = TileHasher_HashRect((ScalerIsa)isa, &copy, 10, 20, TILE_HASH_SIZE, TILE_HASH_SIZE);
+            PixelBuffer_Row(&copy, 20 + 63)[10 + 63] ^= 0x00000100u;
+            if (before != TileHasher_HashRect((ScalerIsa)isa, &image, 10, 20, TILE_HASH_SIZE, TILE_HASH_SIZE) ||
+                before == after) {
+                printf("FAIL hash [%s]: a one-bit change in the last pixel was not detected\n", g_isaNames[isa]);
+                failures++;
+            }
+        }
+        PixelBuffer_Free(&copy);
+    }
+
+    if (failures == 0) {
+        printf("ok   %d random rects hash the same on every instruction set (up to %s)\n",
+               HASH_CASES, g_isaNames[best]);
+    }
+    PixelBuffer_Free(&image);
+    return failures;
+}
+
+/**
+ * Update 결과가 기대한 사각형 목록과 같은지 (순서 무관)
+ * expectedCount가 -1이면 사각형 수 초과를 기대한다.
+ */
+static int ExpectRects(ScalerIsa isa, const char* name, int count, const FrameRect* changed,
+                       const FrameRect* expected, int expectedCount)
+{
+    bool same = count == expectedCount;
+    for (int i = 0; i < expectedCount && same; i++) {
+        bool found = false;
+        for (int j = 0; j < count && !found; j++) {
+            found = memcmp(&changed[j], &expected[i], sizeof(FrameRect)) == 0;
+        }
+        same = found;
+    }
+    if (same) {
+        return 0;
+    }
+
+    printf("FAIL update [%s] %s: expected %d rect(s), got %d:", g_isaNames[isa], name, expectedCount, count);
+    for (int j = 0; j < count; j++) {
+        printf(" (%d,%d)-(%d,%d)", changed[j].left, changed[j].top, changed[j].right, changed[j].bottom);
+    }
+    printf("\n");
+    return 1;
+}
+
+/**
+ * 한 프레임 해시 (bounds는 pixels가 놓인 데스크톱 위치)
+ */
+static int Update(TileHasher* hasher, const PixelBuffer* pixels, int left, int top, const FrameRect** changed)
+{
+    FrameRect bounds = {left, top, left + pixels->width, top + pixels->height};
+    return TileHasher_Update(hasher, pixels, &bounds, changed);
+}
+
+/**
+ * 바뀐 타일 찾기 (명령어 집합 하나)
+ */
+static int CheckUpdate(ScalerIsa isa)
+{
+    PixelBuffer desktop;
+    if (!TestImage_CreateNoise(&desktop, DESKTOP_WIDTH, DESKTOP_HEIGHT, 5)) {
+        printf("FAIL: out of memory\n");
+        return 1;
+    }
+    TileHasher* hasher = TileHasher_Create(DESKTOP_WIDTH, DESKTOP_HEIGHT);
+    if (!hasher) {
+        printf("FAIL: could not create tile hasher\n");
+        PixelBuffer_Free(&desktop);
+        return 1;
+    }
+    TileHasher_SetIsa(hasher, isa);
+
+    int failures = 0;
+    const FrameRect* changed;
+    FrameRect expected[MAX_EXPECTED];
+    int count;
+
+    // 첫 프레임: 해시가 없으므로 전체 (행마다 한 구간이 아래로 이어져 사각형 하나)
+    count = Update(hasher, &desktop, 0, 0, &changed);
+    expected[0] = (FrameRect){0, 0, DESKTOP_WIDTH, DESKTOP_HEIGHT};
+    failures += ExpectRects(isa, "first frame", count, changed, expected, 1);
+
+    // 같은 프레임: 없음
+    count = Update(hasher, &desktop, 0, 0, &changed);
+    failures += ExpectRects(isa, "unchanged frame", count, changed, expected, 0);
+
+    TileHashStats stats;
+    TileHasher_GetStats(hasher, &stats);
+    if (stats.frames != 2 || stats.framesUnchanged != 1 || stats.lastTiles != 4 * 3 || stats.lastChanged != 0) {
+        printf("FAIL update [%s]: stats after an unchanged frame are wrong\n", g_isaNames[isa]);
+        failures++;
+    }
+
+    // 한 픽셀: 그 타일 하나
+    PixelBuffer_Row(&desktop, 70)[130] ^= 0x00010000u;
+    count = Update(hasher, &desktop, 0, 0, &changed);
+    expected[0] = (FrameRect){128, 64, 192, 128};
+    failures += ExpectRects(isa, "one pixel", count, changed, expected, 1);
+
+    // 오른쪽 아래 가장자리 타일 (8x22)
+    PixelBuffer_Row(&desktop, DESKTOP_HEIGHT - 1)[DESKTOP_WIDTH - 1] ^= 0x00000001u;
+    count = Update(hasher, &desktop, 0, 0, &changed);
+    expected[0] = (FrameRect){192, 128, DESKTOP_WIDTH, DESKTOP_HEIGHT};
+    failures += ExpectRects(isa, "edge tile", count, changed, expected, 1);
+
+    // 같은 행의 떨어진 두 타일 + 아래 행의 같은 범위 (위아래로 합쳐짐)
+    PixelBuffer_Row(&desktop, 0)[0] ^= 0x01000000u;
+    PixelBuffer_Row(&desktop, 10)[150] ^= 0x01000000u;
+    PixelBuffer_Row(&desktop, 100)[20] ^= 0x01000000u;
+    count = Update(hasher, &desktop, 0, 0, &changed);
+    expected[0] = (FrameRect){0, 0, 64, 128};
+    expected[1] = (FrameRect){128, 0, 192, 64};
+    failures += ExpectRects(isa, "two rows", count, changed, expected, 2);
+
+    // 캡처 영역이 150x150으로 줄어듦: 해시한 범위가 달라진 세 번째 열만 (네 번째 열은 해시하지 않음)
+    PixelBuffer crop = PixelBuffer_SubView(&desktop, 0, 0, 150, DESKTOP_HEIGHT);
+    count = Update(hasher, &crop, 0, 0, &changed);
+    expected[0] = (FrameRect){128, 0, 150, DESKTOP_HEIGHT};
+    failures += ExpectRects(isa, "smaller capture", count, changed, expected, 1);
+
+    // 캡처 영역이 오른쪽으로 40 이동: 첫 열은 범위가 줄고 세 번째 열은 다시 늘어남.
+    // 네 번째 열은 마지막으로 해시한 전체 프레임과 같은 범위/내용이므로 바뀌지 않음
+    crop = PixelBuffer_SubView(&desktop, 40, 0, DESKTOP_WIDTH - 40, DESKTOP_HEIGHT);
+    count = Update(hasher, &crop, 40, 0, &changed);
+    expected[0] = (FrameRect){40, 0, 64, DESKTOP_HEIGHT};
+    expected[1] = (FrameRect){128, 0, 192, DESKTOP_HEIGHT};
+    failures += ExpectRects(isa, "moved capture", count, changed, expected, 2);
+
+    // 다시 전체: 첫 열만
+    count = Update(hasher, &desktop, 0, 0, &changed);
+    expected[0] = (FrameRect){0, 0, 64, DESKTOP_HEIGHT};
+    failures += ExpectRects(isa, "full capture again", count, changed, expected, 1);
+
+    // 데스크톱보다 큰 프레임 (해상도 변경 직후): 데스크톱 안쪽만 비교, 내용이 같으면 없음
+    PixelBuffer larger;
+    if (TestImage_CreateNoise(&larger, DESKTOP_WIDTH + 60, DESKTOP_HEIGHT + 20, 6)) {
+        for (int y = 0; y < DESKTOP_HEIGHT; y++) {
+            memcpy(PixelBuffer_Row(&larger, y), PixelBuffer_Row(&desktop, y), (size_t)DESKTOP_WIDTH * 4);
+        }
+        count = Update(hasher, &larger, 0, 0, &changed);
+        failures += ExpectRects(isa, "larger frame", count, changed, expected, 0);
+        PixelBuffer_Free(&larger);
+    }
+
+    // 데스크톱 밖 프레임: 없음
+    count = Update(hasher, &desktop, DESKTOP_WIDTH, 0, &changed);
+    failures += ExpectRects(isa, "frame outside the desktop", count, changed, expected, 0);
+
+    // Invalidate한 영역의 타일은 내용이 같아도 바뀐 것으로
+    FrameRect dirty = {60, 60, 70, 70};
+    TileHasher_Invalidate(hasher, &dirty);
+    count = Update(hasher, &desktop, 0, 0, &changed);
+    expected[0] = (FrameRect){0, 0, 128, 128};
+    failures += ExpectRects(isa, "invalidated", count, changed, expected, 1);
+
+    // Reset 후 전체
+    TileHasher_Reset(hasher);
+    count = Update(hasher, &desktop, 0, 0, &changed);
+    expected[0] = (FrameRect){0, 0, DESKTOP_WIDTH, DESKTOP_HEIGHT};
+    failures += ExpectRects(isa, "reset", count, changed, expected, 1);
+
+    TileHasher_Destroy(hasher);
+    PixelBuffer_Free(&desktop);
+
+    // 바둑판 모양으로 바뀌면 구간이 합쳐지지 않아 사각형 수 초과 (-1)
+    PixelBuffer large;
+    hasher = TileHasher_Create(LARGE_WIDTH, LARGE_HEIGHT);
+    if (!hasher || !TestImage_CreateNoise(&large, LARGE_WIDTH, LARGE_HEIGHT, 8)) {
+        printf("FAIL: out of memory\n");
+        TileHasher_Destroy(hasher);
+        return failures + 1;
+    }
+    TileHasher_SetIsa(hasher, isa);
+    Update(hasher, &large, 0, 0, &changed);
+    for (int ty = 0; ty < LARGE_HEIGHT / TILE_HASH_SIZE; ty++) {
+        for (int tx = ty % 2; tx < LARGE_WIDTH / TILE_HASH_SIZE; tx += 2) {
+            PixelBuffer_Row(&large, ty * TILE_HASH_SIZE)[tx * TILE_HASH_SIZE] ^= 0xFFu;
+        }
+    }
+    count = Update(hasher, &large, 0, 0, &changed);
+    failures += ExpectRects(isa, "checkerboard", count, changed, expected, -1);
+    TileHasher_Destroy(hasher);
+    PixelBuffer_Free(&large);
+
+    if (failures == 0) {
+        printf("ok   update reports exactly the changed tiles [%s]\n", g_isaNames[isa]);
+    }
+    return failures;
+}
+
+int main(void)
+{
+    int failures = CheckHashIsa();
+    for (int isa = 0; isa < 3; isa++) {
+        if (isa > (int)Scaler_DetectIsa()) {
+            printf("skip %s (not supported by this CPU)\n", g_isaNames[isa]);
+            continue;
+        }
+        failures += CheckUpdate((ScalerIsa)isa);
+    }
+
+    printf("%s: %d failure(s)\n", failures ? "FAILED" : "PASSED", failures);
+    return failures ? 1 : 0;
+}
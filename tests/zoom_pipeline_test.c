@@ -0,0 +1,90 @@
+/**
+ * zoom_pipeline_test.c - 확대 파이프라인 타일 캐시 테스트
+ *
+ * 보이는 타일보다 훨씬 작은 타일 캐시로 합성 공급원(움직이는 상자)을 확대하면서,
+ * 모든 타일이 들어가는 캐시로 확대한 결과와 프레임마다 같은지 확인한다.
+ * 바뀐 영역이 캐시에서 이미 밀려난 타일만 덮어도 출력이 갱신되어야 한다.
+ *
+ * 사용법: zoom_pipeline_test
+ */
+
+#include "zoom_pipeline.h"
+#include "test_image.h"
+#include <stdio.h>
+#include <string.h>
+
+#define DESKTOP_WIDTH 640
+#define DESKTOP_HEIGHT 400
+#define OUTPUT_WIDTH 1280
+#define OUTPUT_HEIGHT 800
+#define FRAMES 40
+
+// 보이는 타일은 5x4 이상, 작은 캐시는 2개만
+#define SMALL_CACHE_TILES 2
+#define LARGE_CACHE_TILES 64
+
+typedef struct {
+    FrameSource* source;
+    ZoomPipeline* pipeline;
+    PixelBuffer output;
+} PipelineCase;
+
+/**
+ * 공급원 + 타일 캐시 파이프라인 + 출력 버퍼
+ */
+static bool CreateCase(PipelineCase* test, int cacheTiles)
+{
+    memset(test, 0, sizeof(*test));
+    test->source = FrameSource_CreateSynthetic(DESKTOP_WIDTH, DESKTOP_HEIGHT);
+    if (!test->source) return false;
+    test->pipeline = ZoomPipeline_Create(test->source);
+    return test->pipeline &&
+           ZoomPipeline_EnableTileCache(test->pipeline, (size_t)cacheTiles * TILE_SIZE * TILE_SIZE * 4) &&
+           PixelBuffer_Alloc(&test->output, OUTPUT_WIDTH, OUTPUT_HEIGHT);
+}
+
+static void DestroyCase(PipelineCase* test)
+{
+    ZoomPipeline_Destroy(test->pipeline);
+    FrameSource_Destroy(test->source);
+    PixelBuffer_Free(&test->output);
+}
+
+int main(void)
+{
+    PipelineCase small, large;
+    if (!CreateCase(&small, SMALL_CACHE_TILES) || !CreateCase(&large, LARGE_CACHE_TILES)) {
+        printf("FAIL: could not create pipelines\n");
+        return 1;
+    }
+
+    ZoomView view;
+    memset(&view, 0, sizeof(view));
+    view.zoom = 2.0f;
+    view.centerX = DESKTOP_WIDTH / 2.0f;
+    view.centerY = DESKTOP_HEIGHT / 2.0f;
+    view.filter = SCALE_FILTER_BILINEAR;
+
+    int failures = 0;
+    for (int i = 0; i < FRAMES && !failures; i++) {
+        ZoomPipeline_Render(small.pipeline, &view, &small.output);
+        ZoomPipeline_Render(large.pipeline, &view, &large.output);
+
+        int diffX, diffY;
+        if (!TestImage_Equal(&small.output, &large.output, &diffX, &diffY)) {
+            printf("FAIL frame %d: output with a %d-tile cache is stale at (%d, %d)\n",
+                   i, SMALL_CACHE_TILES, diffX, diffY);
+            failures++;
+        }
+    }
+    if (!failures) {
+        printf("ok   %d frames with a %d-tile cache match a cache holding every visible tile\n",
+               FRAMES, SMALL_CACHE_TILES);
+    }
+
+    DestroyCase(&small);
+    DestroyCase(&large);
+
+    printf("%s: %d failure(s)\n", failures ? "FAILED" : "PASSED", failures);
+    return failures ? 1 : 0;
+}